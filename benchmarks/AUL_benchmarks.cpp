@@ -0,0 +1,8 @@
+#include "containers/Array_map_benchmarks.hpp"
+#include "containers/Circular_array_benchmarks.hpp"
+#include "containers/Packed_vector_benchmarks.hpp"
+#include "containers/Slot_map_benchmarks.hpp"
+
+#include <benchmark/benchmark.h>
+
+BENCHMARK_MAIN();
@@ -0,0 +1,59 @@
+#ifndef AUL_BENCHMARK_UTILITIES_HPP
+#define AUL_BENCHMARK_UTILITIES_HPP
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace aul::benchmarks {
+
+    ///
+    /// Element counts used by all container benchmarks. Covers everything
+    /// from containers which fit in a few cache lines up to ones that are
+    /// much larger than the last level cache.
+    ///
+    /// \param b Benchmark to apply range to
+    inline void container_sizes(::benchmark::internal::Benchmark* b) {
+        b->RangeMultiplier(8)->Range(16, 10'000'000);
+    }
+
+    ///
+    /// Element counts used for operations which have quadratic complexity
+    /// for at least one of the containers being compared, where the full
+    /// range would take unreasonably long to run.
+    ///
+    /// \param b Benchmark to apply range to
+    inline void quadratic_container_sizes(::benchmark::internal::Benchmark* b) {
+        b->RangeMultiplier(8)->Range(16, 1 << 16);
+    }
+
+    ///
+    /// \param n Number of keys to generate
+    /// \return Vector containing the values [0, n) in a random, but
+    ///     reproducible, order
+    inline std::vector<std::uint64_t> shuffled_keys(const std::size_t n) {
+        std::vector<std::uint64_t> ret(n);
+        std::iota(ret.begin(), ret.end(), std::uint64_t{0});
+
+        std::mt19937_64 engine{0x5eed};
+        std::shuffle(ret.begin(), ret.end(), engine);
+
+        return ret;
+    }
+
+    ///
+    /// \param n Number of keys to generate
+    /// \return Vector containing the values [0, n) in ascending order
+    inline std::vector<std::uint64_t> sequential_keys(const std::size_t n) {
+        std::vector<std::uint64_t> ret(n);
+        std::iota(ret.begin(), ret.end(), std::uint64_t{0});
+        return ret;
+    }
+
+}
+
+#endif //AUL_BENCHMARK_UTILITIES_HPP
@@ -0,0 +1,144 @@
+#ifndef AUL_ARRAY_MAP_BENCHMARKS_HPP
+#define AUL_ARRAY_MAP_BENCHMARKS_HPP
+
+#include "Associative_benchmarks.hpp"
+
+#include <aul/containers/Array_map.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace aul::benchmarks {
+
+    template<class K, class V, class C, class A, class S>
+    struct Associative_adapter<aul::Array_map<K, V, C, A, S>> {
+        using container_type = aul::Array_map<K, V, C, A, S>;
+        using handle_type = K;
+
+        static handle_type emplace(container_type& c, const K key, const V value) {
+            c.emplace(key, value);
+            return key;
+        }
+
+        static bool erase(container_type& c, const handle_type& h) {
+            const auto size = c.size();
+            c.erase(h);
+            return c.size() != size;
+        }
+
+        static const V* find(const container_type& c, const handle_type& h) {
+            auto it = c.find(h);
+            return (it == c.end()) ? nullptr : &std::get<1>(*it);
+        }
+
+        static V sum(const container_type& c) {
+            V ret{};
+            for (const auto& v : c.values()) {
+                ret += v;
+            }
+            return ret;
+        }
+    };
+
+    ///
+    /// Measures bulk-loading state.range(0) keys in random order into an empty
+    /// Array_map via insert_range(). Directly comparable to
+    /// BM_associative_emplace.
+    ///
+    template<class C>
+    void BM_array_map_insert_range(::benchmark::State& state) {
+        const auto n = static_cast<std::size_t>(state.range(0));
+        const auto keys = shuffled_keys(n);
+
+        for (auto _ : state) {
+            C c;
+            c.insert_range(keys.begin(), keys.end(), keys.begin());
+            ::benchmark::DoNotOptimize(c);
+            ::benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    ///
+    /// Measures looking up state.range(0) keys in random order through
+    /// find_many(), in batches of 128. Directly comparable to
+    /// BM_associative_find.
+    ///
+    template<class C>
+    void BM_array_map_find_many(::benchmark::State& state) {
+        constexpr std::size_t batch_size = 128;
+
+        const auto n = static_cast<std::size_t>(state.range(0));
+        const auto keys = sequential_keys(n);
+        const auto order = shuffled_keys(n);
+
+        C c;
+        c.insert_sorted(keys.begin(), keys.end(), keys.begin());
+
+        std::vector<typename C::size_type> indices(batch_size);
+
+        for (auto _ : state) {
+            for (std::size_t i = 0; i < n; i += batch_size) {
+                const std::size_t count = std::min(batch_size, n - i);
+                c.find_many(
+                    aul::Span<const std::uint64_t>{order.data() + i, count},
+                    aul::Span<typename C::size_type>{indices.data(), count}
+                );
+                ::benchmark::DoNotOptimize(indices.data());
+                ::benchmark::ClobberMemory();
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    using Array_map = aul::Array_map<std::uint64_t, std::uint64_t>;
+    using Eytzinger_array_map = aul::Array_map<
+        std::uint64_t,
+        std::uint64_t,
+        std::less<std::uint64_t>,
+        std::allocator<std::uint64_t>,
+        aul::Eytzinger_search_policy
+    >;
+
+    template<class S>
+    using Array_map_with_policy = aul::Array_map<
+        std::uint64_t,
+        std::uint64_t,
+        std::less<std::uint64_t>,
+        std::allocator<std::uint64_t>,
+        S
+    >;
+
+    using Exponential_array_map = Array_map_with_policy<aul::Exponential_search_policy>;
+    using Interpolation_array_map = Array_map_with_policy<aul::Interpolation_search_policy>;
+    using Interpolation_sequential_array_map = Array_map_with_policy<aul::Interpolation_sequential_search_policy>;
+
+    // Random insertions and removals shift the tail of both arrays, making
+    // these quadratic in the number of elements
+    BENCHMARK_TEMPLATE(BM_associative_emplace, Array_map)->Apply(quadratic_container_sizes);
+    BENCHMARK_TEMPLATE(BM_associative_erase, Array_map)->Apply(quadratic_container_sizes);
+
+    BENCHMARK_TEMPLATE(BM_array_map_insert_range, Array_map)->Apply(container_sizes);
+
+    BENCHMARK_TEMPLATE(BM_associative_find, Array_map)->Apply(container_sizes);
+    BENCHMARK_TEMPLATE(BM_associative_iterate, Array_map)->Apply(container_sizes);
+
+    BENCHMARK_TEMPLATE(BM_associative_find, Eytzinger_array_map)->Apply(container_sizes);
+
+    // Keys are sequential, the best case for interpolation. Lookups are in
+    // random order, the worst case for exponential search
+    BENCHMARK_TEMPLATE(BM_associative_find, Exponential_array_map)->Apply(container_sizes);
+    BENCHMARK_TEMPLATE(BM_associative_find, Interpolation_array_map)->Apply(container_sizes);
+    BENCHMARK_TEMPLATE(BM_associative_find, Interpolation_sequential_array_map)->Apply(container_sizes);
+
+    BENCHMARK_TEMPLATE(BM_array_map_find_many, Array_map)->Apply(container_sizes);
+    BENCHMARK_TEMPLATE(BM_array_map_find_many, Eytzinger_array_map)->Apply(container_sizes);
+
+}
+
+#endif //AUL_ARRAY_MAP_BENCHMARKS_HPP
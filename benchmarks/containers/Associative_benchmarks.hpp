@@ -0,0 +1,218 @@
+#ifndef AUL_ASSOCIATIVE_BENCHMARKS_HPP
+#define AUL_ASSOCIATIVE_BENCHMARKS_HPP
+
+#include "../Benchmark_utilities.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+namespace aul::benchmarks {
+
+    ///
+    /// Adapter which maps the operations exercised by the associative
+    /// container benchmarks onto a particular container's interface.
+    ///
+    /// Specializations are expected to provide:
+    ///     handle_type - Type used to look up an element after insertion
+    ///     emplace(c, key, value) - Returns handle to new element
+    ///     erase(c, handle) - Returns true if an element was removed
+    ///     find(c, handle) - Returns pointer to value or nullptr
+    ///     sum(c) - Returns sum of all values, in iteration order
+    ///
+    /// \tparam C Container type
+    template<class C>
+    struct Associative_adapter;
+
+    template<class K, class V>
+    struct Associative_adapter<std::map<K, V>> {
+        using container_type = std::map<K, V>;
+        using handle_type = K;
+
+        static handle_type emplace(container_type& c, const K key, const V value) {
+            c.emplace(key, value);
+            return key;
+        }
+
+        static bool erase(container_type& c, const handle_type& h) {
+            return c.erase(h);
+        }
+
+        static const V* find(const container_type& c, const handle_type& h) {
+            auto it = c.find(h);
+            return (it == c.end()) ? nullptr : &it->second;
+        }
+
+        static V sum(const container_type& c) {
+            V ret{};
+            for (const auto& p : c) {
+                ret += p.second;
+            }
+            return ret;
+        }
+    };
+
+    template<class K, class V>
+    struct Associative_adapter<std::unordered_map<K, V>> {
+        using container_type = std::unordered_map<K, V>;
+        using handle_type = K;
+
+        static handle_type emplace(container_type& c, const K key, const V value) {
+            c.emplace(key, value);
+            return key;
+        }
+
+        static bool erase(container_type& c, const handle_type& h) {
+            return c.erase(h);
+        }
+
+        static const V* find(const container_type& c, const handle_type& h) {
+            auto it = c.find(h);
+            return (it == c.end()) ? nullptr : &it->second;
+        }
+
+        static V sum(const container_type& c) {
+            V ret{};
+            for (const auto& p : c) {
+                ret += p.second;
+            }
+            return ret;
+        }
+    };
+
+    //=====================================================
+    // Benchmark implementations
+    //=====================================================
+
+    ///
+    /// Populates c with sequential keys mapping to their own value.
+    ///
+    /// \return Handles to the newly inserted elements, in insertion order
+    template<class C>
+    std::vector<typename Associative_adapter<C>::handle_type> populate(C& c, const std::size_t n) {
+        using adapter = Associative_adapter<C>;
+
+        std::vector<typename adapter::handle_type> handles;
+        handles.reserve(n);
+        for (std::uint64_t i = 0; i < n; ++i) {
+            handles.push_back(adapter::emplace(c, i, i));
+        }
+
+        return handles;
+    }
+
+    ///
+    /// Measures insertion of state.range(0) elements with randomly ordered
+    /// keys into an empty container.
+    ///
+    template<class C>
+    void BM_associative_emplace(::benchmark::State& state) {
+        using adapter = Associative_adapter<C>;
+
+        const auto n = static_cast<std::size_t>(state.range(0));
+        const auto keys = shuffled_keys(n);
+
+        for (auto _ : state) {
+            C c;
+            for (const auto key : keys) {
+                ::benchmark::DoNotOptimize(adapter::emplace(c, key, key));
+            }
+            ::benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    ///
+    /// Measures removal of all elements from a container holding
+    /// state.range(0) elements, in random order.
+    ///
+    template<class C>
+    void BM_associative_erase(::benchmark::State& state) {
+        using adapter = Associative_adapter<C>;
+
+        const auto n = static_cast<std::size_t>(state.range(0));
+        const auto order = shuffled_keys(n);
+
+        for (auto _ : state) {
+            state.PauseTiming();
+            C c;
+            auto handles = populate(c, n);
+            state.ResumeTiming();
+
+            for (const auto i : order) {
+                ::benchmark::DoNotOptimize(adapter::erase(c, handles[i]));
+            }
+            ::benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    ///
+    /// Measures look-up of every element in a container holding
+    /// state.range(0) elements, in random order.
+    ///
+    template<class C>
+    void BM_associative_find(::benchmark::State& state) {
+        using adapter = Associative_adapter<C>;
+
+        const auto n = static_cast<std::size_t>(state.range(0));
+        const auto order = shuffled_keys(n);
+
+        C c;
+        const auto handles = populate(c, n);
+
+        for (auto _ : state) {
+            for (const auto i : order) {
+                ::benchmark::DoNotOptimize(adapter::find(c, handles[i]));
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    ///
+    /// Measures a full traversal of a container holding state.range(0)
+    /// elements.
+    ///
+    template<class C>
+    void BM_associative_iterate(::benchmark::State& state) {
+        using adapter = Associative_adapter<C>;
+
+        const auto n = static_cast<std::size_t>(state.range(0));
+
+        C c;
+        populate(c, n);
+
+        for (auto _ : state) {
+            ::benchmark::DoNotOptimize(adapter::sum(c));
+        }
+
+        state.SetItemsProcessed(state.iterations() * n);
+        state.SetBytesProcessed(state.iterations() * n * sizeof(std::uint64_t));
+    }
+
+    //=====================================================
+    // Baselines
+    //=====================================================
+
+    using Std_map = std::map<std::uint64_t, std::uint64_t>;
+    using Std_unordered_map = std::unordered_map<std::uint64_t, std::uint64_t>;
+
+    BENCHMARK_TEMPLATE(BM_associative_emplace, Std_map)->Apply(container_sizes);
+    BENCHMARK_TEMPLATE(BM_associative_erase, Std_map)->Apply(container_sizes);
+    BENCHMARK_TEMPLATE(BM_associative_find, Std_map)->Apply(container_sizes);
+    BENCHMARK_TEMPLATE(BM_associative_iterate, Std_map)->Apply(container_sizes);
+
+    BENCHMARK_TEMPLATE(BM_associative_emplace, Std_unordered_map)->Apply(container_sizes);
+    BENCHMARK_TEMPLATE(BM_associative_erase, Std_unordered_map)->Apply(container_sizes);
+    BENCHMARK_TEMPLATE(BM_associative_find, Std_unordered_map)->Apply(container_sizes);
+    BENCHMARK_TEMPLATE(BM_associative_iterate, Std_unordered_map)->Apply(container_sizes);
+
+}
+
+#endif //AUL_ASSOCIATIVE_BENCHMARKS_HPP
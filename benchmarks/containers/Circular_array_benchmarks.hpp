@@ -0,0 +1,138 @@
+#ifndef AUL_CIRCULAR_ARRAY_BENCHMARKS_HPP
+#define AUL_CIRCULAR_ARRAY_BENCHMARKS_HPP
+
+#include "Sequence_benchmarks.hpp"
+
+#include <aul/containers/Circular_array.hpp>
+#include <aul/memory/Mirrored_allocator.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace aul::benchmarks {
+
+    using Circular_array = aul::Circular_array<std::uint64_t>;
+
+    BENCHMARK_TEMPLATE(BM_sequence_emplace_back, Circular_array)->Apply(container_sizes);
+    BENCHMARK_TEMPLATE(BM_sequence_pop_front, Circular_array)->Apply(container_sizes);
+    BENCHMARK_TEMPLATE(BM_sequence_pop_back, Circular_array)->Apply(container_sizes);
+    BENCHMARK_TEMPLATE(BM_sequence_find, Circular_array)->Apply(container_sizes);
+    BENCHMARK_TEMPLATE(BM_sequence_iterate, Circular_array)->Apply(container_sizes);
+
+    using Pow2_circular_array = aul::Circular_array<std::uint64_t, std::allocator<std::uint64_t>, aul::Circular_array_pow2_capacity>;
+
+    BENCHMARK_TEMPLATE(BM_sequence_emplace_back, Pow2_circular_array)->Apply(container_sizes);
+    BENCHMARK_TEMPLATE(BM_sequence_pop_front, Pow2_circular_array)->Apply(container_sizes);
+    BENCHMARK_TEMPLATE(BM_sequence_pop_back, Pow2_circular_array)->Apply(container_sizes);
+    BENCHMARK_TEMPLATE(BM_sequence_find, Pow2_circular_array)->Apply(container_sizes);
+    BENCHMARK_TEMPLATE(BM_sequence_iterate, Pow2_circular_array)->Apply(container_sizes);
+
+    using Mirrored_circular_array = aul::Circular_array<std::uint64_t, aul::Mirrored_allocator<std::uint64_t>, aul::Circular_array_mirrored_capacity>;
+
+    BENCHMARK_TEMPLATE(BM_sequence_find, Mirrored_circular_array)->Apply(container_sizes);
+    BENCHMARK_TEMPLATE(BM_sequence_iterate, Mirrored_circular_array)->Apply(container_sizes);
+
+    ///
+    /// Measures copying the contents of a circular array whose elements wrap
+    /// around the end of its allocation out to a separate buffer. Mirrored
+    /// arrays are copied with a single memcpy.
+    ///
+    template<class C>
+    void BM_circular_array_copy_out(::benchmark::State& state) {
+        const auto n = static_cast<std::size_t>(state.range(0));
+
+        C c(n);
+        for (std::size_t i = 0; i < n / 2; ++i) {
+            c.pop_front();
+            c.push_back(i);
+        }
+
+        std::vector<std::uint64_t> out(n);
+
+        for (auto _ : state) {
+            if constexpr (C::capacity_policy::is_mirrored) {
+                std::memcpy(out.data(), c.data(), c.size() * sizeof(std::uint64_t));
+            } else {
+                std::copy(c.begin(), c.end(), out.begin());
+            }
+            ::benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * n);
+        state.SetBytesProcessed(state.iterations() * n * sizeof(std::uint64_t));
+    }
+
+    BENCHMARK_TEMPLATE(BM_circular_array_copy_out, Circular_array)->Apply(container_sizes);
+    BENCHMARK_TEMPLATE(BM_circular_array_copy_out, Mirrored_circular_array)->Apply(container_sizes);
+
+    ///
+    /// Measures copy assigning a circular array whose elements wrap around
+    /// the end of its allocation to another of the same size.
+    ///
+    template<class C>
+    void BM_circular_array_copy_assign(::benchmark::State& state) {
+        const auto n = static_cast<std::size_t>(state.range(0));
+
+        C c(n);
+        for (std::size_t i = 0; i < n / 2; ++i) {
+            c.pop_front();
+            c.push_back(i);
+        }
+
+        C dest(n);
+
+        for (auto _ : state) {
+            dest = c;
+            ::benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * n);
+        state.SetBytesProcessed(state.iterations() * n * sizeof(std::uint64_t));
+    }
+
+    BENCHMARK_TEMPLATE(BM_circular_array_copy_assign, Circular_array)->Apply(container_sizes);
+
+    ///
+    /// Measures pushing state.range(0) samples into a sliding window over the
+    /// last 1024 of them. Unbounded arrays have to pop the oldest element
+    /// first to avoid growing.
+    ///
+    template<class C>
+    void BM_circular_array_sliding_window(::benchmark::State& state) {
+        const auto n = static_cast<std::size_t>(state.range(0));
+        constexpr std::size_t window_size = 1024;
+
+        C c{};
+        c.reserve(window_size);
+        for (std::size_t i = 0; i < window_size; ++i) {
+            c.push_back(i);
+        }
+
+        for (auto _ : state) {
+            for (std::size_t i = 0; i < n; ++i) {
+                if constexpr (!C::capacity_policy::is_bounded) {
+                    c.pop_front();
+                }
+                c.push_back(i);
+            }
+            ::benchmark::DoNotOptimize(c.front());
+        }
+
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    using Bounded_circular_array = aul::Circular_array<std::uint64_t, std::allocator<std::uint64_t>, aul::Circular_array_bounded_capacity<>>;
+    using Bounded_pow2_circular_array = aul::Circular_array<std::uint64_t, std::allocator<std::uint64_t>, aul::Circular_array_bounded_capacity<aul::Circular_array_pow2_capacity>>;
+
+    BENCHMARK_TEMPLATE(BM_circular_array_sliding_window, Circular_array)->Apply(container_sizes);
+    BENCHMARK_TEMPLATE(BM_circular_array_sliding_window, Bounded_circular_array)->Apply(container_sizes);
+    BENCHMARK_TEMPLATE(BM_circular_array_sliding_window, Bounded_pow2_circular_array)->Apply(container_sizes);
+
+}
+
+#endif //AUL_CIRCULAR_ARRAY_BENCHMARKS_HPP
@@ -0,0 +1,24 @@
+#ifndef AUL_PACKED_VECTOR_BENCHMARKS_HPP
+#define AUL_PACKED_VECTOR_BENCHMARKS_HPP
+
+#include "Sequence_benchmarks.hpp"
+
+#include <aul/containers/Packed_vector.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+namespace aul::benchmarks {
+
+    using Packed_vector = aul::Packed_vector<std::uint64_t>;
+
+    // Packed_vector never over-allocates so growing it one element at a time
+    // is quadratic
+    BENCHMARK_TEMPLATE(BM_sequence_resize, Packed_vector)->Apply(quadratic_container_sizes);
+    BENCHMARK_TEMPLATE(BM_sequence_find, Packed_vector)->Apply(container_sizes);
+    BENCHMARK_TEMPLATE(BM_sequence_iterate, Packed_vector)->Apply(container_sizes);
+
+}
+
+#endif //AUL_PACKED_VECTOR_BENCHMARKS_HPP
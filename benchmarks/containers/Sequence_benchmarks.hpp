@@ -0,0 +1,170 @@
+#ifndef AUL_SEQUENCE_BENCHMARKS_HPP
+#define AUL_SEQUENCE_BENCHMARKS_HPP
+
+#include "../Benchmark_utilities.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+namespace aul::benchmarks {
+
+    //=====================================================
+    // Benchmark implementations
+    //=====================================================
+
+    ///
+    /// Measures appending state.range(0) elements to an empty container.
+    ///
+    template<class C>
+    void BM_sequence_emplace_back(::benchmark::State& state) {
+        const auto n = static_cast<std::size_t>(state.range(0));
+
+        for (auto _ : state) {
+            C c;
+            for (std::uint64_t i = 0; i < n; ++i) {
+                c.emplace_back(i);
+            }
+            ::benchmark::DoNotOptimize(c);
+            ::benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    ///
+    /// Measures growing an empty container to state.range(0) elements, one
+    /// element at a time, through resize().
+    ///
+    template<class C>
+    void BM_sequence_resize(::benchmark::State& state) {
+        const auto n = static_cast<std::size_t>(state.range(0));
+
+        for (auto _ : state) {
+            C c;
+            for (std::size_t i = 0; i < n; ++i) {
+                c.resize(i + 1);
+            }
+            ::benchmark::DoNotOptimize(c);
+            ::benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    ///
+    /// Measures removal of all elements from the front of a container
+    /// holding state.range(0) elements.
+    ///
+    template<class C>
+    void BM_sequence_pop_front(::benchmark::State& state) {
+        const auto n = static_cast<std::size_t>(state.range(0));
+
+        for (auto _ : state) {
+            state.PauseTiming();
+            C c;
+            for (std::uint64_t i = 0; i < n; ++i) {
+                c.emplace_back(i);
+            }
+            state.ResumeTiming();
+
+            while (!c.empty()) {
+                c.pop_front();
+            }
+            ::benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    ///
+    /// Measures removal of all elements from the back of a container
+    /// holding state.range(0) elements.
+    ///
+    template<class C>
+    void BM_sequence_pop_back(::benchmark::State& state) {
+        const auto n = static_cast<std::size_t>(state.range(0));
+
+        for (auto _ : state) {
+            state.PauseTiming();
+            C c;
+            for (std::uint64_t i = 0; i < n; ++i) {
+                c.emplace_back(i);
+            }
+            state.ResumeTiming();
+
+            while (!c.empty()) {
+                c.pop_back();
+            }
+            ::benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    ///
+    /// Measures random-access reads of every element in a container holding
+    /// state.range(0) elements, in random order.
+    ///
+    template<class C>
+    void BM_sequence_find(::benchmark::State& state) {
+        const auto n = static_cast<std::size_t>(state.range(0));
+        const auto order = shuffled_keys(n);
+
+        C c(n);
+
+        for (auto _ : state) {
+            for (const auto i : order) {
+                ::benchmark::DoNotOptimize(c[i]);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    ///
+    /// Measures a full traversal of a container holding state.range(0)
+    /// elements.
+    ///
+    template<class C>
+    void BM_sequence_iterate(::benchmark::State& state) {
+        const auto n = static_cast<std::size_t>(state.range(0));
+
+        C c(n);
+
+        for (auto _ : state) {
+            std::uint64_t sum = 0;
+            for (const auto& x : c) {
+                sum += x;
+            }
+            ::benchmark::DoNotOptimize(sum);
+        }
+
+        state.SetItemsProcessed(state.iterations() * n);
+        state.SetBytesProcessed(state.iterations() * n * sizeof(std::uint64_t));
+    }
+
+    //=====================================================
+    // Baselines
+    //=====================================================
+
+    using Std_vector = std::vector<std::uint64_t>;
+    using Std_deque = std::deque<std::uint64_t>;
+
+    BENCHMARK_TEMPLATE(BM_sequence_emplace_back, Std_vector)->Apply(container_sizes);
+    BENCHMARK_TEMPLATE(BM_sequence_resize, Std_vector)->Apply(quadratic_container_sizes);
+    BENCHMARK_TEMPLATE(BM_sequence_pop_back, Std_vector)->Apply(container_sizes);
+    BENCHMARK_TEMPLATE(BM_sequence_find, Std_vector)->Apply(container_sizes);
+    BENCHMARK_TEMPLATE(BM_sequence_iterate, Std_vector)->Apply(container_sizes);
+
+    BENCHMARK_TEMPLATE(BM_sequence_emplace_back, Std_deque)->Apply(container_sizes);
+    BENCHMARK_TEMPLATE(BM_sequence_pop_front, Std_deque)->Apply(container_sizes);
+    BENCHMARK_TEMPLATE(BM_sequence_pop_back, Std_deque)->Apply(container_sizes);
+    BENCHMARK_TEMPLATE(BM_sequence_find, Std_deque)->Apply(container_sizes);
+    BENCHMARK_TEMPLATE(BM_sequence_iterate, Std_deque)->Apply(container_sizes);
+
+}
+
+#endif //AUL_SEQUENCE_BENCHMARKS_HPP
@@ -0,0 +1,301 @@
+#ifndef AUL_SLOT_MAP_BENCHMARKS_HPP
+#define AUL_SLOT_MAP_BENCHMARKS_HPP
+
+#include "Associative_benchmarks.hpp"
+
+#include <aul/containers/Paged_slot_map.hpp>
+#include <aul/containers/Slot_map.hpp>
+#include <aul/containers/Soa_slot_map.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+namespace aul::benchmarks {
+
+    template<class V>
+    struct Associative_adapter<aul::Slot_map<V>> {
+        using container_type = aul::Slot_map<V>;
+        using handle_type = typename container_type::key_type;
+
+        static handle_type emplace(container_type& c, const std::uint64_t, const V value) {
+            return c.emplace(value);
+        }
+
+        static bool erase(container_type& c, const handle_type& h) {
+            return c.erase(h);
+        }
+
+        static const V* find(const container_type& c, const handle_type& h) {
+            return c.get_if(h);
+        }
+
+        static V sum(const container_type& c) {
+            V ret{};
+            for (const auto& v : c) {
+                ret += v;
+            }
+            return ret;
+        }
+    };
+
+    template<class V>
+    struct Associative_adapter<aul::Paged_slot_map<V>> {
+        using container_type = aul::Paged_slot_map<V>;
+        using handle_type = typename container_type::key_type;
+
+        static handle_type emplace(container_type& c, const std::uint64_t, const V value) {
+            return c.emplace(value);
+        }
+
+        static bool erase(container_type& c, const handle_type& h) {
+            return c.erase(h);
+        }
+
+        static const V* find(const container_type& c, const handle_type& h) {
+            return c.contains(h) ? &c[h] : nullptr;
+        }
+
+        static V sum(const container_type& c) {
+            V ret{};
+            for (const auto& v : c) {
+                ret += v;
+            }
+            return ret;
+        }
+    };
+
+    ///
+    /// Measures insertion of state.range(0) elements into an empty container
+    /// one at a time, reporting the slowest single insertion as the
+    /// max_emplace_ns counter
+    ///
+    template<class C>
+    void BM_slot_map_max_emplace_latency(::benchmark::State& state) {
+        using clock = std::chrono::steady_clock;
+
+        const auto n = static_cast<std::size_t>(state.range(0));
+
+        double max_ns = 0.0;
+        for (auto _ : state) {
+            C c;
+            for (std::uint64_t i = 0; i < n; ++i) {
+                const auto t0 = clock::now();
+                ::benchmark::DoNotOptimize(c.emplace(i));
+                const auto t1 = clock::now();
+
+                max_ns = std::max(max_ns, std::chrono::duration<double, std::nano>(t1 - t0).count());
+            }
+            ::benchmark::ClobberMemory();
+        }
+
+        state.counters["max_emplace_ns"] = max_ns;
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    ///
+    /// Measures look-up of every element in a container holding
+    /// state.range(0) elements, in random order, prefetching each key's
+    /// anchor and then its element some iterations before it is looked up.
+    /// Directly comparable to BM_associative_find.
+    ///
+    template<class C>
+    void BM_slot_map_find_prefetched(::benchmark::State& state) {
+        constexpr std::size_t anchor_distance = 16;
+        constexpr std::size_t element_distance = 8;
+
+        const auto n = static_cast<std::size_t>(state.range(0));
+        const auto order = shuffled_keys(n);
+
+        C c;
+        const auto keys = populate(c, n);
+
+        std::vector<typename C::key_type> handles(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            handles[i] = keys[order[i]];
+        }
+
+        for (auto _ : state) {
+            for (std::size_t i = 0; i < n; ++i) {
+                if (i + anchor_distance < n) {
+                    c.prefetch(handles[i + anchor_distance]);
+                }
+                if (i + element_distance < n) {
+                    c.prefetch_element(handles[i + element_distance]);
+                }
+                ::benchmark::DoNotOptimize(c.get_if(handles[i]));
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    ///
+    /// Measures insertion of state.range(0) elements into an empty container
+    /// through a single call to emplace_range(). Directly comparable to
+    /// BM_associative_emplace.
+    ///
+    template<class C>
+    void BM_slot_map_emplace_range(::benchmark::State& state) {
+        const auto n = static_cast<std::size_t>(state.range(0));
+        const auto values = shuffled_keys(n);
+
+        std::vector<typename C::key_type> keys(n);
+
+        for (auto _ : state) {
+            C c;
+            c.emplace_range(values.begin(), values.end(), aul::Span<typename C::key_type>{keys.data(), n});
+            ::benchmark::DoNotOptimize(keys.data());
+            ::benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    ///
+    /// Measures removal of all elements from a container holding
+    /// state.range(0) elements through erase_many(), in random order and in
+    /// batches of 256. Directly comparable to BM_associative_erase.
+    ///
+    template<class C>
+    void BM_slot_map_erase_many(::benchmark::State& state) {
+        constexpr std::size_t batch_size = 256;
+
+        const auto n = static_cast<std::size_t>(state.range(0));
+        const auto order = shuffled_keys(n);
+
+        std::vector<typename C::key_type> handles(n);
+
+        for (auto _ : state) {
+            state.PauseTiming();
+            C c;
+            const auto keys = populate(c, n);
+            for (std::size_t i = 0; i < n; ++i) {
+                handles[i] = keys[order[i]];
+            }
+            state.ResumeTiming();
+
+            for (std::size_t i = 0; i < n; i += batch_size) {
+                const std::size_t count = std::min(batch_size, n - i);
+                ::benchmark::DoNotOptimize(c.erase_many(aul::Span<const typename C::key_type>{handles.data() + i, count}));
+            }
+            ::benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    ///
+    /// Measures reconstruction of a container holding state.range(0)
+    /// elements, with one in four erased, from an image produced by
+    /// snapshot(). Directly comparable to BM_slot_map_emplace_range.
+    ///
+    template<class C>
+    void BM_slot_map_restore(::benchmark::State& state) {
+        const auto n = static_cast<std::size_t>(state.range(0));
+
+        C source;
+        const auto keys = populate(source, n);
+        for (std::size_t i = 0; i < n; i += 4) {
+            source.erase(keys[i]);
+        }
+
+        std::vector<unsigned char> image(source.snapshot_size());
+        source.snapshot_into(image.data());
+
+        for (auto _ : state) {
+            C c = C::restore(image.data(), image.size());
+            ::benchmark::DoNotOptimize(c.data());
+            ::benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * n);
+        state.SetBytesProcessed(state.iterations() * image.size());
+    }
+
+    ///
+    /// Element with one frequently accessed member and a larger, rarely
+    /// accessed payload
+    ///
+    using Entity = std::tuple<std::uint64_t, std::array<std::uint64_t, 7>>;
+
+    ///
+    /// Measures summing the first member of state.range(0) entities stored
+    /// whole in an aul::Slot_map.
+    ///
+    inline void BM_slot_map_sum_member(::benchmark::State& state) {
+        const auto n = static_cast<std::size_t>(state.range(0));
+
+        aul::Slot_map<Entity> c;
+        for (std::uint64_t i = 0; i < n; ++i) {
+            c.emplace(Entity{i, {}});
+        }
+
+        for (auto _ : state) {
+            std::uint64_t sum = 0;
+            for (const auto& e : c) {
+                sum += std::get<0>(e);
+            }
+            ::benchmark::DoNotOptimize(sum);
+        }
+
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    ///
+    /// Measures summing the first member of state.range(0) entities stored in
+    /// an aul::Soa_slot_map, through that member's column. Directly
+    /// comparable to BM_slot_map_sum_member.
+    ///
+    inline void BM_soa_slot_map_sum_member(::benchmark::State& state) {
+        const auto n = static_cast<std::size_t>(state.range(0));
+
+        aul::Soa_slot_map<Entity> c;
+        for (std::uint64_t i = 0; i < n; ++i) {
+            c.emplace(i, std::array<std::uint64_t, 7>{});
+        }
+
+        for (auto _ : state) {
+            std::uint64_t sum = 0;
+            for (const auto v : c.column<0>()) {
+                sum += v;
+            }
+            ::benchmark::DoNotOptimize(sum);
+        }
+
+        state.SetItemsProcessed(state.iterations() * n);
+    }
+
+    using Slot_map = aul::Slot_map<std::uint64_t>;
+
+    BENCHMARK_TEMPLATE(BM_associative_emplace, Slot_map)->Apply(container_sizes);
+    BENCHMARK_TEMPLATE(BM_associative_erase, Slot_map)->Apply(container_sizes);
+    BENCHMARK_TEMPLATE(BM_associative_find, Slot_map)->Apply(container_sizes);
+    BENCHMARK_TEMPLATE(BM_associative_iterate, Slot_map)->Apply(container_sizes);
+
+    BENCHMARK_TEMPLATE(BM_slot_map_find_prefetched, Slot_map)->Apply(container_sizes);
+    BENCHMARK_TEMPLATE(BM_slot_map_emplace_range, Slot_map)->Apply(container_sizes);
+    BENCHMARK_TEMPLATE(BM_slot_map_erase_many, Slot_map)->Apply(container_sizes);
+    BENCHMARK_TEMPLATE(BM_slot_map_restore, Slot_map)->Apply(container_sizes);
+
+    using Paged_slot_map = aul::Paged_slot_map<std::uint64_t>;
+
+    BENCHMARK_TEMPLATE(BM_associative_emplace, Paged_slot_map)->Apply(container_sizes);
+    BENCHMARK_TEMPLATE(BM_associative_erase, Paged_slot_map)->Apply(container_sizes);
+    BENCHMARK_TEMPLATE(BM_associative_find, Paged_slot_map)->Apply(container_sizes);
+    BENCHMARK_TEMPLATE(BM_associative_iterate, Paged_slot_map)->Apply(container_sizes);
+
+    BENCHMARK_TEMPLATE(BM_slot_map_max_emplace_latency, Slot_map)->Apply(container_sizes);
+    BENCHMARK_TEMPLATE(BM_slot_map_max_emplace_latency, Paged_slot_map)->Apply(container_sizes);
+
+    BENCHMARK(BM_slot_map_sum_member)->Apply(container_sizes);
+    BENCHMARK(BM_soa_slot_map_sum_member)->Apply(container_sizes);
+
+}
+
+#endif //AUL_SLOT_MAP_BENCHMARKS_HPP
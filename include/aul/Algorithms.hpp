@@ -2,13 +2,464 @@
 #define AUL_ALGORITHMS_HPP
 
 #include "Bits.hpp"
+#include "memory/Memory.hpp"
 
 #include <iterator>
+#include <algorithm>
 #include <functional>
 #include <memory>
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <immintrin.h>
+#endif
 
 namespace aul {
 
+    namespace impl {
+
+        ///
+        /// \return True if called during constant evaluation. Conservatively
+        ///     true if this cannot be determined
+        constexpr bool is_constant_evaluated() noexcept {
+            #if defined(__GNUC__) || defined(__clang__) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+            return __builtin_is_constant_evaluated();
+            #else
+            return true;
+            #endif
+        }
+
+        enum class Simd_element_kind {
+            unsupported,
+            signed_integer,
+            unsigned_integer,
+            floating_point
+        };
+
+        template<class T>
+        constexpr Simd_element_kind simd_element_kind_v =
+            (std::is_same_v<T, float> || std::is_same_v<T, double>) ? Simd_element_kind::floating_point :
+            (!std::is_integral_v<T> || std::is_same_v<T, bool>) ? Simd_element_kind::unsupported :
+            std::is_signed_v<T> ? Simd_element_kind::signed_integer : Simd_element_kind::unsigned_integer;
+
+        ///
+        /// Evaluates std::less between a block of elements and a broadcast
+        /// value using the widest instruction set enabled at compile time.
+        ///
+        /// Specializations provide:
+        ///     lanes:            Number of elements compared at once
+        ///     broadcast(x):     Vector of x in a form accepted by less_mask()
+        ///     less_mask(p, v):  Bit mask where bit i is set if p[i] < x
+        ///
+        template<Simd_element_kind Kind, std::size_t Size>
+        struct Simd_less {
+            static constexpr bool is_supported = false;
+        };
+
+        #if defined(__AVX512F__)
+
+        template<>
+        struct Simd_less<Simd_element_kind::signed_integer, 4> {
+            static constexpr bool is_supported = true;
+            static constexpr unsigned lanes = 16;
+
+            template<class T>
+            static __m512i broadcast(const T x) noexcept {
+                return _mm512_set1_epi32(static_cast<std::int32_t>(x));
+            }
+
+            template<class T>
+            static unsigned less_mask(const T* p, const __m512i v) noexcept {
+                return _mm512_cmplt_epi32_mask(_mm512_loadu_si512(p), v);
+            }
+        };
+
+        template<>
+        struct Simd_less<Simd_element_kind::unsigned_integer, 4> {
+            static constexpr bool is_supported = true;
+            static constexpr unsigned lanes = 16;
+
+            template<class T>
+            static __m512i broadcast(const T x) noexcept {
+                return _mm512_set1_epi32(static_cast<std::int32_t>(x));
+            }
+
+            template<class T>
+            static unsigned less_mask(const T* p, const __m512i v) noexcept {
+                return _mm512_cmplt_epu32_mask(_mm512_loadu_si512(p), v);
+            }
+        };
+
+        template<>
+        struct Simd_less<Simd_element_kind::signed_integer, 8> {
+            static constexpr bool is_supported = true;
+            static constexpr unsigned lanes = 8;
+
+            template<class T>
+            static __m512i broadcast(const T x) noexcept {
+                return _mm512_set1_epi64(static_cast<std::int64_t>(x));
+            }
+
+            template<class T>
+            static unsigned less_mask(const T* p, const __m512i v) noexcept {
+                return _mm512_cmplt_epi64_mask(_mm512_loadu_si512(p), v);
+            }
+        };
+
+        template<>
+        struct Simd_less<Simd_element_kind::unsigned_integer, 8> {
+            static constexpr bool is_supported = true;
+            static constexpr unsigned lanes = 8;
+
+            template<class T>
+            static __m512i broadcast(const T x) noexcept {
+                return _mm512_set1_epi64(static_cast<std::int64_t>(x));
+            }
+
+            template<class T>
+            static unsigned less_mask(const T* p, const __m512i v) noexcept {
+                return _mm512_cmplt_epu64_mask(_mm512_loadu_si512(p), v);
+            }
+        };
+
+        template<>
+        struct Simd_less<Simd_element_kind::floating_point, 4> {
+            static constexpr bool is_supported = true;
+            static constexpr unsigned lanes = 16;
+
+            static __m512 broadcast(const float x) noexcept {
+                return _mm512_set1_ps(x);
+            }
+
+            static unsigned less_mask(const float* p, const __m512 v) noexcept {
+                return _mm512_cmp_ps_mask(_mm512_loadu_ps(p), v, _CMP_LT_OQ);
+            }
+        };
+
+        template<>
+        struct Simd_less<Simd_element_kind::floating_point, 8> {
+            static constexpr bool is_supported = true;
+            static constexpr unsigned lanes = 8;
+
+            static __m512d broadcast(const double x) noexcept {
+                return _mm512_set1_pd(x);
+            }
+
+            static unsigned less_mask(const double* p, const __m512d v) noexcept {
+                return _mm512_cmp_pd_mask(_mm512_loadu_pd(p), v, _CMP_LT_OQ);
+            }
+        };
+
+        #elif defined(__AVX2__)
+
+        // AVX2 only has signed integer comparisons. Unsigned integers are
+        // compared by flipping their sign bits, which preserves their order
+        // when they are reinterpreted as signed integers.
+
+        template<>
+        struct Simd_less<Simd_element_kind::signed_integer, 4> {
+            static constexpr bool is_supported = true;
+            static constexpr unsigned lanes = 8;
+
+            template<class T>
+            static __m256i broadcast(const T x) noexcept {
+                return _mm256_set1_epi32(static_cast<std::int32_t>(x));
+            }
+
+            template<class T>
+            static unsigned less_mask(const T* p, const __m256i v) noexcept {
+                const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+                return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(v, x)));
+            }
+        };
+
+        template<>
+        struct Simd_less<Simd_element_kind::unsigned_integer, 4> {
+            static constexpr bool is_supported = true;
+            static constexpr unsigned lanes = 8;
+
+            template<class T>
+            static __m256i broadcast(const T x) noexcept {
+                return _mm256_set1_epi32(static_cast<std::int32_t>(x ^ sign_bit));
+            }
+
+            template<class T>
+            static unsigned less_mask(const T* p, const __m256i v) noexcept {
+                const __m256i bias = _mm256_set1_epi32(static_cast<std::int32_t>(sign_bit));
+                const __m256i x = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)), bias);
+                return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(v, x)));
+            }
+
+        private:
+            static constexpr std::uint32_t sign_bit = std::uint32_t{1} << 31;
+        };
+
+        template<>
+        struct Simd_less<Simd_element_kind::signed_integer, 8> {
+            static constexpr bool is_supported = true;
+            static constexpr unsigned lanes = 4;
+
+            template<class T>
+            static __m256i broadcast(const T x) noexcept {
+                return _mm256_set1_epi64x(static_cast<std::int64_t>(x));
+            }
+
+            template<class T>
+            static unsigned less_mask(const T* p, const __m256i v) noexcept {
+                const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+                return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(v, x)));
+            }
+        };
+
+        template<>
+        struct Simd_less<Simd_element_kind::unsigned_integer, 8> {
+            static constexpr bool is_supported = true;
+            static constexpr unsigned lanes = 4;
+
+            template<class T>
+            static __m256i broadcast(const T x) noexcept {
+                return _mm256_set1_epi64x(static_cast<std::int64_t>(x ^ sign_bit));
+            }
+
+            template<class T>
+            static unsigned less_mask(const T* p, const __m256i v) noexcept {
+                const __m256i bias = _mm256_set1_epi64x(static_cast<std::int64_t>(sign_bit));
+                const __m256i x = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)), bias);
+                return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(v, x)));
+            }
+
+        private:
+            static constexpr std::uint64_t sign_bit = std::uint64_t{1} << 63;
+        };
+
+        template<>
+        struct Simd_less<Simd_element_kind::floating_point, 4> {
+            static constexpr bool is_supported = true;
+            static constexpr unsigned lanes = 8;
+
+            static __m256 broadcast(const float x) noexcept {
+                return _mm256_set1_ps(x);
+            }
+
+            static unsigned less_mask(const float* p, const __m256 v) noexcept {
+                return _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(p), v, _CMP_LT_OQ));
+            }
+        };
+
+        template<>
+        struct Simd_less<Simd_element_kind::floating_point, 8> {
+            static constexpr bool is_supported = true;
+            static constexpr unsigned lanes = 4;
+
+            static __m256d broadcast(const double x) noexcept {
+                return _mm256_set1_pd(x);
+            }
+
+            static unsigned less_mask(const double* p, const __m256d v) noexcept {
+                return _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(p), v, _CMP_LT_OQ));
+            }
+        };
+
+        #elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+
+        // SSE2 only has signed integer comparisons. Unsigned integers are
+        // compared by flipping their sign bits, which preserves their order
+        // when they are reinterpreted as signed integers. 64-bit integer
+        // comparisons require SSE4.2.
+
+        template<>
+        struct Simd_less<Simd_element_kind::signed_integer, 4> {
+            static constexpr bool is_supported = true;
+            static constexpr unsigned lanes = 4;
+
+            template<class T>
+            static __m128i broadcast(const T x) noexcept {
+                return _mm_set1_epi32(static_cast<std::int32_t>(x));
+            }
+
+            template<class T>
+            static unsigned less_mask(const T* p, const __m128i v) noexcept {
+                const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+                return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(x, v)));
+            }
+        };
+
+        template<>
+        struct Simd_less<Simd_element_kind::unsigned_integer, 4> {
+            static constexpr bool is_supported = true;
+            static constexpr unsigned lanes = 4;
+
+            template<class T>
+            static __m128i broadcast(const T x) noexcept {
+                return _mm_set1_epi32(static_cast<std::int32_t>(x ^ sign_bit));
+            }
+
+            template<class T>
+            static unsigned less_mask(const T* p, const __m128i v) noexcept {
+                const __m128i bias = _mm_set1_epi32(static_cast<std::int32_t>(sign_bit));
+                const __m128i x = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), bias);
+                return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(x, v)));
+            }
+
+        private:
+            static constexpr std::uint32_t sign_bit = std::uint32_t{1} << 31;
+        };
+
+        #if defined(__SSE4_2__)
+
+        template<>
+        struct Simd_less<Simd_element_kind::signed_integer, 8> {
+            static constexpr bool is_supported = true;
+            static constexpr unsigned lanes = 2;
+
+            template<class T>
+            static __m128i broadcast(const T x) noexcept {
+                return _mm_set1_epi64x(static_cast<std::int64_t>(x));
+            }
+
+            template<class T>
+            static unsigned less_mask(const T* p, const __m128i v) noexcept {
+                const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+                return _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(v, x)));
+            }
+        };
+
+        template<>
+        struct Simd_less<Simd_element_kind::unsigned_integer, 8> {
+            static constexpr bool is_supported = true;
+            static constexpr unsigned lanes = 2;
+
+            template<class T>
+            static __m128i broadcast(const T x) noexcept {
+                return _mm_set1_epi64x(static_cast<std::int64_t>(x ^ sign_bit));
+            }
+
+            template<class T>
+            static unsigned less_mask(const T* p, const __m128i v) noexcept {
+                const __m128i bias = _mm_set1_epi64x(static_cast<std::int64_t>(sign_bit));
+                const __m128i x = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), bias);
+                return _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(v, x)));
+            }
+
+        private:
+            static constexpr std::uint64_t sign_bit = std::uint64_t{1} << 63;
+        };
+
+        #endif
+
+        template<>
+        struct Simd_less<Simd_element_kind::floating_point, 4> {
+            static constexpr bool is_supported = true;
+            static constexpr unsigned lanes = 4;
+
+            static __m128 broadcast(const float x) noexcept {
+                return _mm_set1_ps(x);
+            }
+
+            static unsigned less_mask(const float* p, const __m128 v) noexcept {
+                return _mm_movemask_ps(_mm_cmplt_ps(_mm_loadu_ps(p), v));
+            }
+        };
+
+        template<>
+        struct Simd_less<Simd_element_kind::floating_point, 8> {
+            static constexpr bool is_supported = true;
+            static constexpr unsigned lanes = 2;
+
+            static __m128d broadcast(const double x) noexcept {
+                return _mm_set1_pd(x);
+            }
+
+            static unsigned less_mask(const double* p, const __m128d v) noexcept {
+                return _mm_movemask_pd(_mm_cmplt_pd(_mm_loadu_pd(p), v));
+            }
+        };
+
+        #endif
+
+        template<class T>
+        using simd_less_for = Simd_less<simd_element_kind_v<T>, sizeof(T)>;
+
+        ///
+        /// True if a search over a range of It for a value of type T using
+        /// a comparator of type C may use a Simd_less kernel
+        ///
+        template<class It, class T, class C>
+        constexpr bool is_simd_searchable_v = [] {
+            if constexpr (std::is_pointer_v<It>) {
+                using element_type = std::remove_cv_t<std::remove_pointer_t<It>>;
+                return
+                    std::is_same_v<element_type, T> &&
+                    (std::is_same_v<C, std::less<T>> || std::is_same_v<C, std::less<>>) &&
+                    simd_less_for<T>::is_supported;
+            } else {
+                return false;
+            }
+        }();
+
+        ///
+        /// Vectorized linear_search
+        ///
+        /// \param begin Pointer to beginning of range
+        /// \param end Pointer to end of range
+        /// \param val Value to compare against
+        /// \return Pointer to first element which is not less than val
+        template<class T>
+        const T* simd_linear_search(const T* begin, const T* end, const T val) noexcept {
+            using kernel = simd_less_for<T>;
+            constexpr unsigned full_mask = (1u << kernel::lanes) - 1;
+
+            const auto v = kernel::broadcast(val);
+            for (; (end - begin) >= std::ptrdiff_t{kernel::lanes}; begin += kernel::lanes) {
+                const unsigned mask = kernel::less_mask(begin, v);
+                if (mask != full_mask) {
+                    return begin + aul::countr_zero(~mask);
+                }
+            }
+
+            while ((begin != end) && (*begin < val)) {
+                ++begin;
+            }
+            return begin;
+        }
+
+        ///
+        /// Vectorized search of a sorted range which counts the elements less
+        /// than val instead of stopping at the first which isn't, keeping the
+        /// loop free of data-dependent branches
+        ///
+        /// \param begin Pointer to beginning of sorted range
+        /// \param end Pointer to end of sorted range
+        /// \param val Value to compare against
+        /// \return Pointer to first element which is not less than val
+        template<class T>
+        const T* simd_sorted_search(const T* begin, const T* end, const T val) noexcept {
+            using kernel = simd_less_for<T>;
+
+            const auto v = kernel::broadcast(val);
+            std::size_t count = 0;
+
+            const T* p = begin;
+            for (; (end - p) >= std::ptrdiff_t{kernel::lanes}; p += kernel::lanes) {
+                count += aul::pop_cnt(kernel::less_mask(p, v));
+            }
+            for (; p != end; ++p) {
+                count += static_cast<std::size_t>(*p < val);
+            }
+
+            return begin + count;
+        }
+
+    }
+
+    ///
+    /// Searches for the first element which does not compare less than val.
+    ///
+    /// When searching a range of pointers to a supported arithmetic type
+    /// using std::less, multiple elements are compared at once using the
+    /// widest of SSE2, AVX2, or AVX-512 that's enabled at compile time.
     ///
     /// \tparam F_iter
     /// \tparam T
@@ -18,6 +469,12 @@ namespace aul {
     /// \return
     template<typename F_iter, typename T, typename C = std::less<T>>
     constexpr F_iter linear_search(F_iter begin, F_iter end, const T& val, const C c = {}) {
+        if constexpr (impl::is_simd_searchable_v<F_iter, T, C>) {
+            if (!impl::is_constant_evaluated()) {
+                return begin + (impl::simd_linear_search<T>(begin, end, val) - begin);
+            }
+        }
+
         while ((begin != end) && c(*begin, val)) {
             ++begin;
         }
@@ -51,6 +508,10 @@ namespace aul {
     /// \param c Comparator object
     /// \return Iterator to location where val is expected to be, even if it's
     ///     found at that location.
+    ///
+    /// When searching a range of pointers to a supported arithmetic type
+    /// using std::less, the final elements are searched using vector
+    /// instructions. See linear_search.
     template<class R_iter, class T, class C = std::less<T>>
     [[nodiscard]]
     constexpr R_iter binary_search(R_iter begin, R_iter end, const T& val, C c = {}) {
@@ -60,56 +521,276 @@ namespace aul {
         constexpr diff_type threshold = 128 / sizeof(T);
 
         diff_type size = (end - begin);
-        R_iter pivot;
 
         while (size >= threshold) {
             diff_type half = (size >> 1);
-            pivot = begin + half;
+            const R_iter pivot = begin + half;
             begin = begin + ((size - half) & -diff_type(c(*pivot, val)));
 
             size = half;
         }
 
+        if constexpr (impl::is_simd_searchable_v<R_iter, T, C>) {
+            if (!impl::is_constant_evaluated()) {
+                return begin + (impl::simd_sorted_search<T>(begin, begin + size, val) - begin);
+            }
+        }
+
         return linear_search(begin, begin + size, val, c);
     }
 
-    /*
     ///
-    /// \tparam R_iter Randomc access iterator type
+    /// Performs a binary search for each value in [vals_begin, vals_end) over
+    /// the same sorted range.
+    ///
+    /// The searches are advanced in lockstep, in groups, with the elements
+    /// that each search may compare against next being prefetched. The cache
+    /// misses of the searches in a group therefore overlap instead of forming
+    /// one serialized chain per value.
+    ///
+    /// \tparam R_iter Random-access iterator
+    /// \tparam In_iter Random-access iterator over values to search for
+    /// \tparam Out_iter Output iterator accepting R_iter
+    /// \tparam C Comparator object type
+    /// \param begin Iterator to beginning of sorted range
+    /// \param end Iterator to end of sorted range
+    /// \param vals_begin Iterator to beginning of values to search for
+    /// \param vals_end Iterator to end of values to search for
+    /// \param out Iterator to beginning of output range. Receives, for each
+    ///     value, the iterator binary_search would return for it
+    /// \param c Comparator object
+    /// \return Iterator to end of output range
+    template<class R_iter, class In_iter, class Out_iter, class C = std::less<>>
+    Out_iter batch_binary_search(R_iter begin, R_iter end, In_iter vals_begin, In_iter vals_end, Out_iter out, C c = {}) {
+        using diff_type = typename std::iterator_traits<R_iter>::difference_type;
+
+        // Enough independent searches to saturate the memory system's
+        // capacity for outstanding misses
+        constexpr diff_type group_size = 16;
+
+        const diff_type n = (end - begin);
+        if (n == 0) {
+            for (; vals_begin != vals_end; ++vals_begin, ++out) {
+                *out = begin;
+            }
+            return out;
+        }
+
+        R_iter bases[group_size];
+
+        while (vals_begin != vals_end) {
+            const diff_type m = std::min(group_size, diff_type(vals_end - vals_begin));
+            for (diff_type j = 0; j < m; ++j) {
+                bases[j] = begin;
+            }
+
+            // Each step narrows every search in the group to the half of its
+            // current range in which its value is expected
+            diff_type size = n;
+            while (size > 1) {
+                const diff_type half = (size >> 1);
+                const diff_type next_half = ((size - half) >> 1);
+
+                if (next_half != 0) {
+                    for (diff_type j = 0; j < m; ++j) {
+                        aul::prefetch(std::addressof(bases[j][next_half - 1]));
+                        aul::prefetch(std::addressof(bases[j][half + next_half - 1]));
+                    }
+                }
+
+                for (diff_type j = 0; j < m; ++j) {
+                    bases[j] = bases[j] + (half & -diff_type(c(bases[j][half - 1], vals_begin[j])));
+                }
+
+                size -= half;
+            }
+
+            for (diff_type j = 0; j < m; ++j, ++out) {
+                *out = bases[j] + diff_type(c(*bases[j], vals_begin[j]));
+            }
+
+            vals_begin += m;
+        }
+
+        return out;
+    }
+
+    ///
+    /// Searches a sorted range by probing positions at exponentially
+    /// increasing distances from its beginning before binary searching the
+    /// last interval probed. Takes O(log i) comparisons where i is the
+    /// position of the result, so it's preferable to binary_search when the
+    /// value is expected to be near the beginning of the range.
+    ///
+    /// \tparam R_iter Random access iterator type
     /// \tparam T Object Type to compare to
     /// \tparam C Comparator type
-    /// \param begin Iterator to begining of range
+    /// \param begin Iterator to beginning of range
     /// \param end Iterator to end of range
     /// \param val Value to compare against
     /// \param c Comparator object
+    /// \return Iterator to location where val is expected to be, even if it's
+    ///     found at that location.
     template<class R_iter, class T, class C = std::less<T>>
     [[nodiscard]]
     constexpr R_iter exponential_search(R_iter begin, R_iter end, const T& val, C c = {}) {
-        using diff_type = std::iterator_traits<R_iter>::difference_type;
+        using diff_type = typename std::iterator_traits<R_iter>::difference_type;
 
-        diff_type size = (end - begin);
-        diff_type offset = 1;
+        const diff_type size = (end - begin);
+
+        // Result lies within (begin + lo, begin + hi]
+        diff_type lo = -1;
+        diff_type hi = 0;
+        while (hi < size && c(begin[hi], val)) {
+            lo = hi;
+            hi = (hi < (size - 1) / 2) ? 2 * hi + 1 : size;
+        }
+
+        return aul::binary_search(begin + (lo + 1), begin + hi, val, c);
+    }
 
-        R_iter a = begin;
-        R_iter b = begin;
-        while (b != end) {
-            if (c(val, *b)) {
-                return binary_search(a, b, val, c);
+    namespace impl {
+
+        ///
+        /// Estimates the position of val within a sorted range, assuming
+        /// its elements are evenly distributed between its endpoints.
+        ///
+        /// \param first First element of range
+        /// \param last Last element of range. Must differ from first
+        /// \param val Value to locate. Must lie within [first, last]
+        /// \param size Number of elements in range
+        /// \return Estimated index in [0, size - 1]
+        template<class U, class T, class diff_type>
+        diff_type interpolate(const U& first, const U& last, const T& val, const diff_type size) {
+            double fraction =
+                (static_cast<double>(val) - static_cast<double>(first)) /
+                (static_cast<double>(last) - static_cast<double>(first));
+
+            // Distinct values may become equal when converted to double,
+            // making the fraction NaN
+            if (!(fraction >= 0.0)) {
+                fraction = 0.0;
+            } else if (fraction > 1.0) {
+                fraction = 1.0;
+            }
+
+            const diff_type pos = static_cast<diff_type>(fraction * static_cast<double>(size - 1));
+            return std::min(pos, size - 1);
+        }
+
+    }
+
+    ///
+    /// Searches a sorted range by estimating the position of val through
+    /// linear interpolation between the endpoints of the interval which is
+    /// known to contain it. Takes O(log log n) probes when the elements are
+    /// evenly distributed.
+    ///
+    /// The range is bisected whenever an interpolation step fails to halve
+    /// the interval, bounding the worst case to O(log n) probes.
+    ///
+    /// Elements and val must be explicitly convertible to double in a manner
+    /// consistent with the ordering imposed by c.
+    ///
+    /// \tparam R_iter Random access iterator type
+    /// \tparam T Object Type to compare to
+    /// \tparam C Comparator type
+    /// \param begin Iterator to beginning of range
+    /// \param end Iterator to end of range
+    /// \param val Value to compare against
+    /// \param c Comparator object
+    /// \return Iterator to location where val is expected to be, even if it's
+    ///     found at that location.
+    template<class R_iter, class T, class C = std::less<T>>
+    [[nodiscard]]
+    R_iter interpolation_search(R_iter begin, R_iter end, const T& val, C c = {}) {
+        using diff_type = typename std::iterator_traits<R_iter>::difference_type;
+
+        // Below this size interpolation no longer pays for its arithmetic
+        constexpr diff_type threshold = 128 / sizeof(T);
+
+        // Result lies within [begin + lo, begin + hi]
+        diff_type lo = 0;
+        diff_type hi = (end - begin);
+
+        while ((hi - lo) > threshold) {
+            if (!c(begin[lo], val)) {
+                return begin + lo;
+            }
+
+            if (c(begin[hi - 1], val)) {
+                return begin + hi;
             }
 
-            a = b;
-            b = b + offset;
+            // begin[lo] < val <= begin[hi - 1]
+            const diff_type size = hi - lo;
+            const diff_type pos = lo + impl::interpolate(begin[lo], begin[hi - 1], val, size);
 
-            if ((size / 2) < offset) {
-                offset = size;
+            if (c(begin[pos], val)) {
+                lo = pos + 1;
             } else {
-                offset *= 2;
+                hi = pos;
             }
+
+            if ((hi - lo) > (size / 2)) {
+                const diff_type mid = lo + (hi - lo) / 2;
+                if (c(begin[mid], val)) {
+                    lo = mid + 1;
+                } else {
+                    hi = mid;
+                }
+            }
+        }
+
+        return aul::binary_search(begin + lo, begin + hi, val, c);
+    }
+
+    ///
+    /// Searches a sorted range by making a single interpolated estimate of
+    /// val's position and then scanning sequentially from it. Suited to
+    /// ranges whose elements are very evenly distributed, such as
+    /// timestamps or sequential IDs, where the estimate is typically only a
+    /// few elements off.
+    ///
+    /// Degrades to O(n) comparisons when the estimate is poor.
+    ///
+    /// Elements and val must be explicitly convertible to double in a manner
+    /// consistent with the ordering imposed by c.
+    ///
+    /// \tparam R_iter Random access iterator type
+    /// \tparam T Object Type to compare to
+    /// \tparam C Comparator type
+    /// \param begin Iterator to beginning of range
+    /// \param end Iterator to end of range
+    /// \param val Value to compare against
+    /// \param c Comparator object
+    /// \return Iterator to location where val is expected to be, even if it's
+    ///     found at that location.
+    template<class R_iter, class T, class C = std::less<T>>
+    [[nodiscard]]
+    R_iter interpolation_sequential_search(R_iter begin, R_iter end, const T& val, C c = {}) {
+        using diff_type = typename std::iterator_traits<R_iter>::difference_type;
+
+        const diff_type size = (end - begin);
+        if (size == 0 || !c(begin[0], val)) {
+            return begin;
+        }
+
+        if (c(begin[size - 1], val)) {
+            return end;
         }
 
-        return end;
+        diff_type pos = impl::interpolate(begin[0], begin[size - 1], val, size);
+
+        if (c(begin[pos], val)) {
+            return aul::linear_search(begin + (pos + 1), end, val, c);
+        }
+
+        while (pos != 0 && !c(begin[pos - 1], val)) {
+            --pos;
+        }
+        return begin + pos;
     }
-    */
 
     ///
     /// Remove consecutive elements in the range specified by [begin, end) when
@@ -84,14 +84,73 @@ namespace aul {
         return v && !(v & (v - 1));
     }
 
+    ///
+    /// \tparam T An unsigned integral type
+    /// \param x Value to inspect
+    /// \return Number of set bits in x
     template<class T>
     [[nodiscard]]
-    constexpr inline unsigned pop_cnt(const T x) {
+    constexpr inline unsigned pop_cnt(T x) {
+        #if defined(__GNUC__) || defined(__clang__)
+        return static_cast<unsigned>(__builtin_popcountll(static_cast<unsigned long long>(x)));
+        #else
         unsigned sum = 0;
         for (; x; sum++) {
             x &= x - 1;
         }
         return sum;
+        #endif
+    }
+
+    ///
+    /// \tparam T An unsigned integral type
+    /// \param x Value to inspect
+    /// \return Number of consecutive zero bits in x, starting from the least
+    ///     significant bit. Equal to the width of T if x is zero
+    template<class T>
+    [[nodiscard]]
+    constexpr inline unsigned countr_zero(T x) {
+        constexpr unsigned bits = CHAR_BIT * sizeof(T);
+
+        if (x == 0) {
+            return bits;
+        }
+
+        #if defined(__GNUC__) || defined(__clang__)
+        return static_cast<unsigned>(__builtin_ctzll(static_cast<unsigned long long>(x)));
+        #else
+        unsigned ret = 0;
+        for (; !(x & 1); x >>= 1) {
+            ++ret;
+        }
+        return ret;
+        #endif
+    }
+
+    ///
+    /// \tparam T An unsigned integral type
+    /// \param x Value to inspect
+    /// \return Number of consecutive zero bits in x, starting from the most
+    ///     significant bit. Equal to the width of T if x is zero
+    template<class T>
+    [[nodiscard]]
+    constexpr inline unsigned countl_zero(T x) {
+        constexpr unsigned bits = CHAR_BIT * sizeof(T);
+
+        if (x == 0) {
+            return bits;
+        }
+
+        #if defined(__GNUC__) || defined(__clang__)
+        constexpr unsigned extra_bits = CHAR_BIT * sizeof(unsigned long long) - bits;
+        return static_cast<unsigned>(__builtin_clzll(static_cast<unsigned long long>(x))) - extra_bits;
+        #else
+        unsigned ret = 0;
+        for (T mask = T{1} << (bits - 1); !(x & mask); mask >>= 1) {
+            ++ret;
+        }
+        return ret;
+        #endif
     }
 
     template<class T>
@@ -108,17 +167,19 @@ namespace aul {
 
     ///
     /// \tparam T An unsigned integral type
-    /// \param v Value to round
-    /// \return v rounded to the nearest power of two equal or greater to it
+    /// \param x Value to round. Must be no greater than the largest power of
+    ///     two representable by T
+    /// \return x rounded to the nearest power of two equal or greater to it
     template<class T>
     [[nodiscard]]
     constexpr inline T ceil2(T x) {
-        constexpr unsigned bits = CHAR_BIT * sizeof(T);
+        static_assert(std::is_unsigned<T>::value, "");
+        constexpr unsigned bits = std::numeric_limits<T>::digits;
 
         x--;
 
-        for (int i = 0; i < bits; ++i) {
-            x |= (x >> (1 << i));
+        for (unsigned s = 1; s < bits; s <<= 1) {
+            x |= (x >> s);
         }
 
         return x + 1;
@@ -126,15 +187,16 @@ namespace aul {
 
     ///
     /// \tparam T An unsigned integral type
-    /// \param v Value to round
-    /// \return v rounded to the nearest power of two equal or less to it
+    /// \param x Value to round
+    /// \return x rounded to the nearest power of two equal or less to it
     template<class T>
     [[nodiscard]]
     constexpr inline T floor2(T x) {
-        constexpr unsigned bits = CHAR_BIT * sizeof(T);
+        static_assert(std::is_unsigned<T>::value, "");
+        constexpr unsigned bits = std::numeric_limits<T>::digits;
 
-        for (int i = 0; i < bits; ++i) {
-            x |= (x >> (1 << i));
+        for (unsigned s = 1; s < bits; s <<= 1) {
+            x |= (x >> s);
         }
 
         return x - (x >> 1);
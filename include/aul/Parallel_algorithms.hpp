@@ -0,0 +1,236 @@
+#ifndef AUL_PARALLEL_ALGORITHMS_HPP
+#define AUL_PARALLEL_ALGORITHMS_HPP
+
+#include "concurrency/Thread_pool.hpp"
+#include "containers/Circular_array.hpp"
+#include "Span.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace aul {
+
+    namespace impl {
+
+        ///
+        /// Contiguous run of elements within a container
+        ///
+        template<class T>
+        struct Contiguous_segment {
+            T* ptr = nullptr;
+            std::size_t size = 0;
+
+            ///
+            /// Logical index of ptr[0] within the container
+            ///
+            std::size_t first_index = 0;
+        };
+
+        ///
+        /// \param c Container with contiguous storage exposed through data()
+        /// \return Segments covering the container's elements in order
+        template<class C>
+        auto contiguous_segments_of(C& c) {
+            using element_type = std::remove_pointer_t<decltype(aul::to_raw_pointer(c.data()))>;
+
+            const std::size_t n = c.size();
+            return std::array<Contiguous_segment<element_type>, 2>{{
+                {aul::to_raw_pointer(c.data()), n, 0},
+                {nullptr, 0, n}
+            }};
+        }
+
+        ///
+        /// \param spans Spans over a container's elements, in order, as
+        ///     returned by aul::Circular_array::as_spans()
+        /// \return Segments covering the same elements
+        template<class T>
+        std::array<Contiguous_segment<T>, 2> segments_of_spans(const std::array<aul::Span<T>, 2>& spans) {
+            const std::size_t n0 = spans[0].size();
+            return {{
+                {spans[0].data(), n0, 0},
+                {spans[1].data(), spans[1].size(), n0}
+            }};
+        }
+
+        template<class T, class A, class P>
+        std::array<Contiguous_segment<T>, 2> contiguous_segments_of(Circular_array<T, A, P>& c) {
+            return segments_of_spans(c.as_spans());
+        }
+
+        template<class T, class A, class P>
+        std::array<Contiguous_segment<const T>, 2> contiguous_segments_of(const Circular_array<T, A, P>& c) {
+            return segments_of_spans(c.as_spans());
+        }
+
+        ///
+        /// Chunks smaller than this are not worth handing to another thread
+        ///
+        constexpr std::size_t parallel_min_chunk_bytes = 16 * 1024;
+
+        ///
+        /// Target number of chunks per participating thread, leaving room
+        /// for stealing to balance uneven workloads
+        ///
+        constexpr std::size_t parallel_chunks_per_thread = 4;
+
+        constexpr std::size_t cache_line_size = 64;
+
+        ///
+        /// Splits segments into chunks which never span more than one
+        /// segment. Where the element size allows, chunk boundaries fall on
+        /// cache line boundaries so that no two threads write to the same
+        /// line.
+        ///
+        /// \param segments Segments to split
+        /// \param concurrency Number of threads which will process chunks
+        /// \return List of chunks
+        template<class T>
+        std::vector<Contiguous_segment<T>> make_chunks(const std::array<Contiguous_segment<T>, 2>& segments, const std::size_t concurrency) {
+            constexpr std::size_t elements_per_line = (cache_line_size % sizeof(T) == 0) ? cache_line_size / sizeof(T) : 1;
+
+            const std::size_t total = segments[0].size + segments[1].size;
+            const std::size_t target_chunks = concurrency * parallel_chunks_per_thread;
+
+            std::size_t chunk_size = (total + target_chunks - 1) / target_chunks;
+            chunk_size = std::max<std::size_t>(chunk_size, parallel_min_chunk_bytes / sizeof(T));
+            chunk_size = std::max<std::size_t>(chunk_size, 1);
+            chunk_size = (chunk_size + elements_per_line - 1) / elements_per_line * elements_per_line;
+
+            std::vector<Contiguous_segment<T>> ret;
+            ret.reserve(total / chunk_size + 4);
+
+            for (const Contiguous_segment<T>& segment : segments) {
+                if (segment.size == 0) {
+                    continue;
+                }
+
+                // Lengthen first chunk so that the following ones start on a
+                // cache line boundary
+                std::size_t head = 0;
+                const std::size_t misalignment = reinterpret_cast<std::uintptr_t>(segment.ptr) % cache_line_size;
+                const std::size_t bytes_to_boundary = (cache_line_size - misalignment) % cache_line_size;
+                if (bytes_to_boundary % sizeof(T) == 0) {
+                    head = bytes_to_boundary / sizeof(T);
+                }
+
+                std::size_t i = 0;
+                while (i < segment.size) {
+                    const std::size_t count = std::min(segment.size - i, (i == 0 ? head : 0) + chunk_size);
+                    ret.push_back({segment.ptr + i, count, segment.first_index + i});
+                    i += count;
+                }
+            }
+
+            return ret;
+        }
+
+        ///
+        /// Invokes f(chunk) for each chunk of a container's elements on the
+        /// given pool
+        ///
+        template<class C, class F>
+        void parallel_for_each_chunk(Thread_pool& pool, C& c, F f) {
+            const auto segments = contiguous_segments_of(c);
+            if (segments[0].size == 0) {
+                return;
+            }
+
+            const auto chunks = make_chunks(segments, pool.concurrency());
+            aul::parallel_for(pool, 0, chunks.size(), 1, [&] (const std::size_t i) {
+                f(chunks[i]);
+            });
+        }
+
+    }
+
+    ///
+    /// Applies f to every element of c, in parallel across the threads of
+    /// pool. Elements are processed in contiguous chunks; the order in which
+    /// chunks are processed is unspecified.
+    ///
+    /// Supports aul::Circular_array as well as any container exposing
+    /// contiguous storage through data() and size(), such as aul::Slot_map
+    /// and aul::Packed_vector.
+    ///
+    /// If f throws, the exception is propagated to the caller once all
+    /// chunks have been processed.
+    ///
+    /// \tparam C Container type
+    /// \tparam F Invocable with a reference to C's elements
+    /// \param pool Pool to run on
+    /// \param c Container
+    /// \param f Function to apply to each element
+    template<class C, class F>
+    void parallel_for_each(Thread_pool& pool, C& c, F f) {
+        impl::parallel_for_each_chunk(pool, c, [&f] (const auto& chunk) {
+            for (std::size_t i = 0; i < chunk.size; ++i) {
+                f(chunk.ptr[i]);
+            }
+        });
+    }
+
+    ///
+    /// Applies f to every element of c using the process-wide pool
+    ///
+    /// \tparam C Container type
+    /// \tparam F Invocable with a reference to C's elements
+    /// \param c Container
+    /// \param f Function to apply to each element
+    template<class C, class F>
+    void parallel_for_each(C& c, F f) {
+        parallel_for_each(Thread_pool::instance(), c, std::move(f));
+    }
+
+    ///
+    /// Writes op(e) for every element e of c to the corresponding position
+    /// in the range beginning at d_first, in parallel across the threads of
+    /// pool. Supports the same containers as parallel_for_each().
+    ///
+    /// \tparam C Container type
+    /// \tparam Out Random access iterator type
+    /// \tparam F Invocable with a reference to C's elements
+    /// \param pool Pool to run on
+    /// \param c Container
+    /// \param d_first Beginning of destination range
+    /// \param op Transformation to apply to each element
+    /// \return Iterator to end of destination range
+    template<class C, class Out, class F>
+    Out parallel_transform(Thread_pool& pool, C& c, Out d_first, F op) {
+        using difference_type = typename std::iterator_traits<Out>::difference_type;
+
+        impl::parallel_for_each_chunk(pool, c, [&op, &d_first] (const auto& chunk) {
+            Out out = d_first + static_cast<difference_type>(chunk.first_index);
+            for (std::size_t i = 0; i < chunk.size; ++i, ++out) {
+                *out = op(chunk.ptr[i]);
+            }
+        });
+
+        return d_first + static_cast<difference_type>(c.size());
+    }
+
+    ///
+    /// Transforms the elements of c using the process-wide pool
+    ///
+    /// \tparam C Container type
+    /// \tparam Out Random access iterator type
+    /// \tparam F Invocable with a reference to C's elements
+    /// \param c Container
+    /// \param d_first Beginning of destination range
+    /// \param op Transformation to apply to each element
+    /// \return Iterator to end of destination range
+    template<class C, class Out, class F>
+    Out parallel_transform(C& c, Out d_first, F op) {
+        return parallel_transform(Thread_pool::instance(), c, std::move(d_first), std::move(op));
+    }
+
+}
+
+#endif //AUL_PARALLEL_ALGORITHMS_HPP
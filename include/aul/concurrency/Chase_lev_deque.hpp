@@ -0,0 +1,238 @@
+#ifndef AUL_CHASE_LEV_DEQUE_HPP
+#define AUL_CHASE_LEV_DEQUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace aul {
+
+    ///
+    /// Unbounded work-stealing deque as described by Chase and Lev, using
+    /// the memory orderings of Lê et al., "Correct and Efficient
+    /// Work-Stealing for Weak Memory Models".
+    ///
+    /// A single owner thread pushes and pops elements at the bottom, while
+    /// any number of other threads may concurrently steal elements from the
+    /// top. Only the owner may call push() and pop().
+    ///
+    /// The ring buffer backing the deque is grown by the owner when full.
+    /// Since thieves may still be reading from an outgrown buffer, outgrown
+    /// buffers are only released when the deque is destroyed. As each buffer
+    /// is twice the size of the previous one, this at most doubles memory
+    /// usage.
+    ///
+    /// \tparam T Trivially copyable element type, typically a pointer
+    template<class T>
+    class Chase_lev_deque {
+        static_assert(std::is_trivially_copyable<T>::value, "aul::Chase_lev_deque requires a trivially copyable element type");
+
+    public:
+
+        //=================================================
+        // Type aliases
+        //=================================================
+
+        using value_type = T;
+        using size_type = std::size_t;
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+        ///
+        /// \param initial_capacity Number of elements which can be held before
+        ///     the deque must grow. Rounded up to a power of two
+        explicit Chase_lev_deque(const size_type initial_capacity = 64) {
+            size_type capacity = 1;
+            while (capacity < initial_capacity) {
+                capacity *= 2;
+            }
+
+            buffers.emplace_back(new Buffer{capacity});
+            buffer.store(buffers.back().get(), std::memory_order_relaxed);
+        }
+
+        Chase_lev_deque(const Chase_lev_deque&) = delete;
+        Chase_lev_deque(Chase_lev_deque&&) = delete;
+        ~Chase_lev_deque() = default;
+
+        //=================================================
+        // Assignment operators
+        //=================================================
+
+        Chase_lev_deque& operator=(const Chase_lev_deque&) = delete;
+        Chase_lev_deque& operator=(Chase_lev_deque&&) = delete;
+
+        //=================================================
+        // Owner methods
+        //=================================================
+
+        ///
+        /// Adds an element to the bottom of the deque. Must only be called by
+        /// the owner.
+        ///
+        /// \param x Element to push
+        void push(const T x) {
+            const std::int64_t b = bottom.load(std::memory_order_relaxed);
+            const std::int64_t t = top.load(std::memory_order_acquire);
+            Buffer* a = buffer.load(std::memory_order_relaxed);
+
+            if (b - t > static_cast<std::int64_t>(a->mask)) {
+                a = grow(a, t, b);
+            }
+
+            // A release store rather than a release fence followed by a
+            // relaxed store, as the paper has it, which race detectors
+            // understand and costs the same on common hardware
+            a->store(b, x);
+            bottom.store(b + 1, std::memory_order_release);
+        }
+
+        ///
+        /// Removes the most recently pushed element. Must only be called by
+        /// the owner.
+        ///
+        /// \return Element at the bottom of the deque or an empty optional if
+        ///     the deque was empty
+        [[nodiscard]]
+        std::optional<T> pop() noexcept {
+            const std::int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+            Buffer* a = buffer.load(std::memory_order_relaxed);
+            bottom.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t t = top.load(std::memory_order_relaxed);
+
+            if (t > b) {
+                bottom.store(b + 1, std::memory_order_relaxed);
+                return std::nullopt;
+            }
+
+            std::optional<T> ret{a->load(b)};
+            if (t == b) {
+                // Last element may be contended by a thief
+                if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                    ret.reset();
+                }
+                bottom.store(b + 1, std::memory_order_relaxed);
+            }
+
+            return ret;
+        }
+
+        //=================================================
+        // Thief methods
+        //=================================================
+
+        ///
+        /// Removes the least recently pushed element. May be called from any
+        /// thread. May fail spuriously if it races with another thread
+        /// removing an element.
+        ///
+        /// \return Element at the top of the deque or an empty optional if
+        ///     the deque was empty or the steal lost a race
+        [[nodiscard]]
+        std::optional<T> steal() noexcept {
+            std::int64_t t = top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const std::int64_t b = bottom.load(std::memory_order_acquire);
+
+            if (t >= b) {
+                return std::nullopt;
+            }
+
+            Buffer* a = buffer.load(std::memory_order_acquire);
+            const T x = a->load(t);
+            if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                return std::nullopt;
+            }
+
+            return x;
+        }
+
+        ///
+        /// \return Approximate number of elements in the deque
+        [[nodiscard]]
+        size_type size() const noexcept {
+            const std::int64_t b = bottom.load(std::memory_order_relaxed);
+            const std::int64_t t = top.load(std::memory_order_relaxed);
+            return static_cast<size_type>(b > t ? b - t : 0);
+        }
+
+        [[nodiscard]]
+        bool empty() const noexcept {
+            return size() == 0;
+        }
+
+        ///
+        /// \return Number of elements which can be held before the deque must
+        ///     grow. Must only be called by the owner
+        [[nodiscard]]
+        size_type capacity() const noexcept {
+            return buffer.load(std::memory_order_relaxed)->mask + 1;
+        }
+
+    private:
+
+        //=================================================
+        // Helper classes
+        //=================================================
+
+        struct Buffer {
+
+            explicit Buffer(const size_type capacity):
+                mask(capacity - 1),
+                elements(new std::atomic<T>[capacity]) {}
+
+            size_type mask;
+            std::unique_ptr<std::atomic<T>[]> elements;
+
+            [[nodiscard]]
+            T load(const std::int64_t i) const noexcept {
+                return elements[static_cast<size_type>(i) & mask].load(std::memory_order_relaxed);
+            }
+
+            void store(const std::int64_t i, const T x) noexcept {
+                elements[static_cast<size_type>(i) & mask].store(x, std::memory_order_relaxed);
+            }
+
+        };
+
+        //=================================================
+        // Instance members
+        //=================================================
+
+        alignas(64) std::atomic<std::int64_t> top{0};
+        alignas(64) std::atomic<std::int64_t> bottom{0};
+        alignas(64) std::atomic<Buffer*> buffer{nullptr};
+
+        ///
+        /// Current and outgrown buffers. Only accessed by the owner
+        ///
+        std::vector<std::unique_ptr<Buffer>> buffers;
+
+        //=================================================
+        // Helper functions
+        //=================================================
+
+        Buffer* grow(Buffer* old, const std::int64_t t, const std::int64_t b) {
+            buffers.emplace_back(new Buffer{(old->mask + 1) * 2});
+            Buffer* a = buffers.back().get();
+
+            for (std::int64_t i = t; i < b; ++i) {
+                a->store(i, old->load(i));
+            }
+
+            buffer.store(a, std::memory_order_release);
+            return a;
+        }
+
+    };
+
+}
+
+#endif //AUL_CHASE_LEV_DEQUE_HPP
@@ -0,0 +1,529 @@
+#ifndef AUL_THREAD_POOL_HPP
+#define AUL_THREAD_POOL_HPP
+
+#include "Chase_lev_deque.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace aul {
+
+    class Task_group;
+
+    namespace impl {
+
+        ///
+        /// Type-erased unit of work belonging to a Task_group
+        ///
+        struct Pool_task {
+
+            explicit Pool_task(Task_group* group) noexcept:
+                group(group) {}
+
+            virtual ~Pool_task() = default;
+
+            virtual void execute() = 0;
+
+            Task_group* group = nullptr;
+
+        };
+
+        template<class F>
+        struct Pool_task_impl final : Pool_task {
+
+            template<class G>
+            Pool_task_impl(Task_group* group, G&& g):
+                Pool_task(group),
+                f(std::forward<G>(g)) {}
+
+            void execute() override {
+                f();
+            }
+
+            F f;
+
+        };
+
+    }
+
+    ///
+    /// Work-stealing thread pool.
+    ///
+    /// Each worker thread owns an aul::Chase_lev_deque of tasks. Tasks
+    /// spawned from within a worker are pushed onto that worker's deque and
+    /// are executed in LIFO order by their owner, keeping recently touched
+    /// data in cache, while idle workers steal the oldest tasks from the
+    /// other end of a random victim's deque. Tasks spawned from threads
+    /// outside the pool are placed on a shared injection queue.
+    ///
+    /// Work is submitted through an aul::Task_group, or through
+    /// aul::parallel_for(). Threads waiting on a Task_group execute pending
+    /// tasks in the meantime, so a pool without any workers still makes
+    /// progress, and nested parallelism cannot deadlock.
+    ///
+    /// All task groups using a pool must have been waited on before it is
+    /// destroyed.
+    ///
+    class Thread_pool {
+    public:
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+        ///
+        /// \param worker_count Number of threads to spawn
+        explicit Thread_pool(const std::size_t worker_count = default_worker_count()) {
+            workers.reserve(worker_count);
+            for (std::size_t i = 0; i < worker_count; ++i) {
+                workers.emplace_back(new Worker{});
+            }
+
+            // Threads are only started once every deque exists so that they
+            // can safely look for victims
+            for (auto& worker : workers) {
+                Worker* w = worker.get();
+                w->thread = std::thread{[this, w] { worker_loop(w); }};
+            }
+        }
+
+        Thread_pool(const Thread_pool&) = delete;
+        Thread_pool(Thread_pool&&) = delete;
+
+        ~Thread_pool() {
+            {
+                std::lock_guard<std::mutex> lock{sleep_mutex};
+                stopping = true;
+            }
+            wake.notify_all();
+
+            for (auto& worker : workers) {
+                worker->thread.join();
+            }
+        }
+
+        //=================================================
+        // Assignment operators
+        //=================================================
+
+        Thread_pool& operator=(const Thread_pool&) = delete;
+        Thread_pool& operator=(Thread_pool&&) = delete;
+
+        //=================================================
+        // Static methods
+        //=================================================
+
+        ///
+        /// \return One less than the number of hardware threads, leaving room
+        ///     for the thread which submits work
+        [[nodiscard]]
+        static std::size_t default_worker_count() noexcept {
+            return std::max(std::thread::hardware_concurrency(), 1u) - 1;
+        }
+
+        ///
+        /// \return Process-wide pool with default_worker_count() workers
+        [[nodiscard]]
+        static Thread_pool& instance() {
+            static Thread_pool pool{};
+            return pool;
+        }
+
+        //=================================================
+        // Accessors
+        //=================================================
+
+        [[nodiscard]]
+        std::size_t worker_count() const noexcept {
+            return workers.size();
+        }
+
+        ///
+        /// \return Number of threads executing tasks while another thread
+        ///     waits on a Task_group, including that thread
+        [[nodiscard]]
+        std::size_t concurrency() const noexcept {
+            return workers.size() + 1;
+        }
+
+        ///
+        /// \return True if the calling thread is one of this pool's workers
+        [[nodiscard]]
+        bool is_worker_thread() const noexcept {
+            return this_worker() != nullptr;
+        }
+
+    private:
+
+        friend class Task_group;
+
+        //=================================================
+        // Helper classes
+        //=================================================
+
+        struct alignas(64) Worker {
+            Chase_lev_deque<impl::Pool_task*> deque{};
+            std::thread thread{};
+            std::uint32_t rng_state = 0;
+        };
+
+        struct Thread_state {
+            const Thread_pool* pool = nullptr;
+            Worker* worker = nullptr;
+        };
+
+        //=================================================
+        // Instance members
+        //=================================================
+
+        std::vector<std::unique_ptr<Worker>> workers;
+
+        std::mutex injection_mutex;
+        std::deque<impl::Pool_task*> injected;
+
+        ///
+        /// Number of tasks which have been submitted but not yet taken
+        ///
+        std::atomic<std::size_t> queued{0};
+
+        std::atomic<std::size_t> sleeping{0};
+
+        std::mutex sleep_mutex;
+        std::condition_variable wake;
+        bool stopping = false;
+
+        //=================================================
+        // Helper functions
+        //=================================================
+
+        [[nodiscard]]
+        static Thread_state& thread_state() noexcept {
+            thread_local Thread_state state{};
+            return state;
+        }
+
+        [[nodiscard]]
+        Worker* this_worker() const noexcept {
+            const Thread_state& state = thread_state();
+            return (state.pool == this) ? state.worker : nullptr;
+        }
+
+        void submit(impl::Pool_task* task) {
+            queued.fetch_add(1, std::memory_order_seq_cst);
+
+            // The count is raised before the task is visible so that a worker
+            // which takes it can never decrement the count below zero
+            try {
+                if (Worker* self = this_worker()) {
+                    self->deque.push(task);
+                } else {
+                    std::lock_guard<std::mutex> lock{injection_mutex};
+                    injected.push_back(task);
+                }
+            } catch (...) {
+                // Otherwise idle workers would never go back to sleep
+                queued.fetch_sub(1, std::memory_order_seq_cst);
+                throw;
+            }
+
+            if (sleeping.load(std::memory_order_seq_cst) != 0) {
+                std::lock_guard<std::mutex> lock{sleep_mutex};
+                wake.notify_one();
+            }
+        }
+
+        [[nodiscard]]
+        impl::Pool_task* find_task(Worker* self) {
+            if (queued.load(std::memory_order_relaxed) == 0) {
+                return nullptr;
+            }
+
+            if (self) {
+                if (auto task = self->deque.pop()) {
+                    return *task;
+                }
+            }
+
+            const std::size_t n = workers.size();
+            if (n != 0) {
+                std::uint32_t& r = self ? self->rng_state : thread_rng_state();
+                r ^= r << 13;
+                r ^= r >> 17;
+                r ^= r << 5;
+
+                const std::size_t start = r % n;
+                for (std::size_t i = 0; i < n; ++i) {
+                    Worker* victim = workers[(start + i) % n].get();
+                    if (victim == self) {
+                        continue;
+                    }
+
+                    if (auto task = victim->deque.steal()) {
+                        return *task;
+                    }
+                }
+            }
+
+            std::lock_guard<std::mutex> lock{injection_mutex};
+            if (injected.empty()) {
+                return nullptr;
+            }
+
+            impl::Pool_task* task = injected.front();
+            injected.pop_front();
+            return task;
+        }
+
+        ///
+        /// Executes one pending task, if any, on the calling thread
+        ///
+        /// \return True if a task was executed
+        bool run_one() {
+            impl::Pool_task* task = find_task(this_worker());
+            if (!task) {
+                return false;
+            }
+
+            queued.fetch_sub(1, std::memory_order_relaxed);
+            execute(task);
+            return true;
+        }
+
+        static void execute(impl::Pool_task* task) noexcept;
+
+        [[nodiscard]]
+        static std::uint32_t& thread_rng_state() noexcept {
+            thread_local std::uint32_t state = static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(&state) >> 4) | 1;
+            return state;
+        }
+
+        void worker_loop(Worker* self) {
+            thread_state() = Thread_state{this, self};
+            self->rng_state = static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(self) >> 6) | 1;
+
+            while (true) {
+                if (run_one()) {
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock{sleep_mutex};
+                sleeping.fetch_add(1, std::memory_order_seq_cst);
+                wake.wait(lock, [&] { return stopping || queued.load(std::memory_order_seq_cst) != 0; });
+                sleeping.fetch_sub(1, std::memory_order_relaxed);
+
+                if (stopping) {
+                    return;
+                }
+            }
+        }
+
+    };
+
+    ///
+    /// Set of tasks which are run on an aul::Thread_pool and may be waited on
+    /// together, providing fork/join parallelism.
+    ///
+    /// Tasks may themselves add further tasks to the group. If any task
+    /// throws, the first exception is rethrown by wait().
+    ///
+    class Task_group {
+    public:
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+        explicit Task_group(Thread_pool& pool = Thread_pool::instance()) noexcept:
+            pool(&pool) {}
+
+        Task_group(const Task_group&) = delete;
+        Task_group(Task_group&&) = delete;
+
+        ///
+        /// Waits for all tasks to complete. Exceptions which have not been
+        /// observed through wait() are discarded.
+        ///
+        ~Task_group() {
+            wait_for_tasks();
+        }
+
+        //=================================================
+        // Assignment operators
+        //=================================================
+
+        Task_group& operator=(const Task_group&) = delete;
+        Task_group& operator=(Task_group&&) = delete;
+
+        //=================================================
+        // Instance methods
+        //=================================================
+
+        ///
+        /// Schedules f() to be invoked on some thread of the pool
+        ///
+        /// \tparam F Nullary invocable type
+        /// \param f Function object to invoke
+        template<class F>
+        void run(F&& f) {
+            using task_type = impl::Pool_task_impl<std::decay_t<F>>;
+
+            pending.fetch_add(1, std::memory_order_relaxed);
+            std::unique_ptr<task_type> task{new task_type{this, std::forward<F>(f)}};
+            try {
+                pool->submit(task.get());
+            } catch (...) {
+                pending.fetch_sub(1, std::memory_order_relaxed);
+                throw;
+            }
+            task.release();
+        }
+
+        ///
+        /// Blocks until all tasks in the group have completed, executing
+        /// pending tasks from the pool in the meantime. Afterwards, the group
+        /// may be reused.
+        ///
+        void wait() {
+            wait_for_tasks();
+
+            if (failed.load(std::memory_order_relaxed)) {
+                std::exception_ptr e = std::move(error);
+                error = nullptr;
+                failed.store(false, std::memory_order_relaxed);
+                std::rethrow_exception(e);
+            }
+        }
+
+    private:
+
+        friend class Thread_pool;
+
+        //=================================================
+        // Instance members
+        //=================================================
+
+        Thread_pool* pool = nullptr;
+
+        std::atomic<std::size_t> pending{0};
+
+        std::atomic<bool> failed{false};
+        std::exception_ptr error{};
+
+        //=================================================
+        // Helper functions
+        //=================================================
+
+        void wait_for_tasks() noexcept {
+            while (pending.load(std::memory_order_acquire) != 0) {
+                if (!pool->run_one()) {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        void record_exception(std::exception_ptr e) noexcept {
+            if (!failed.exchange(true, std::memory_order_relaxed)) {
+                error = std::move(e);
+            }
+        }
+
+    };
+
+    inline void Thread_pool::execute(impl::Pool_task* task) noexcept {
+        Task_group* group = task->group;
+
+        try {
+            task->execute();
+        } catch (...) {
+            group->record_exception(std::current_exception());
+        }
+
+        // The task's captures may refer to state the group's owner destroys
+        // as soon as the group is done, so they're destroyed first
+        delete task;
+        group->pending.fetch_sub(1, std::memory_order_release);
+    }
+
+    namespace impl {
+
+        template<class F>
+        void parallel_for_split(Task_group& group, std::size_t first, std::size_t last, const std::size_t grain, F& f) {
+            while (last - first > grain) {
+                const std::size_t mid = first + (last - first) / 2;
+                group.run([&group, mid, last, grain, &f] {
+                    parallel_for_split(group, mid, last, grain, f);
+                });
+                last = mid;
+            }
+
+            for (std::size_t i = first; i < last; ++i) {
+                f(i);
+            }
+        }
+
+    }
+
+    ///
+    /// Invokes f(i) for every i in [first, last) using the threads of a
+    /// pool. The range is split recursively in halves until pieces are no
+    /// larger than grain, with one half being offered to other threads at
+    /// each step. If f throws, the first exception is rethrown once all
+    /// invocations have finished.
+    ///
+    /// \tparam F Invocable with a std::size_t
+    /// \param pool Pool to run on
+    /// \param first Beginning of index range
+    /// \param last End of index range
+    /// \param grain Largest number of indices to process serially. Chosen
+    ///     from the size of the range and pool if 0
+    /// \param f Function to invoke
+    template<class F>
+    void parallel_for(Thread_pool& pool, const std::size_t first, const std::size_t last, std::size_t grain, F f) {
+        if (first >= last) {
+            return;
+        }
+
+        const std::size_t n = last - first;
+        if (grain == 0) {
+            grain = std::max<std::size_t>(n / (8 * pool.concurrency()), 1);
+        }
+
+        if (n <= grain || pool.worker_count() == 0) {
+            for (std::size_t i = first; i < last; ++i) {
+                f(i);
+            }
+            return;
+        }
+
+        Task_group group{pool};
+        impl::parallel_for_split(group, first, last, grain, f);
+        group.wait();
+    }
+
+    ///
+    /// Invokes f(i) for every i in [first, last) using the process-wide
+    /// pool
+    ///
+    /// \tparam F Invocable with a std::size_t
+    /// \param first Beginning of index range
+    /// \param last End of index range
+    /// \param f Function to invoke
+    template<class F>
+    void parallel_for(const std::size_t first, const std::size_t last, F f) {
+        parallel_for(Thread_pool::instance(), first, last, 0, std::move(f));
+    }
+
+}
+
+#endif //AUL_THREAD_POOL_HPP
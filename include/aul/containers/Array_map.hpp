@@ -3,6 +3,7 @@
 
 #include "Zipper_iterator.hpp"
 #include "Allocator_aware_base.hpp"
+#include "Search_policies.hpp"
 #include "../Span.hpp"
 
 #include "../memory/Memory.hpp"
@@ -16,6 +17,8 @@
 #include <tuple>
 #include <stdexcept>
 #include <utility>
+#include <vector>
+#include <numeric>
 
 namespace aul {
 
@@ -27,7 +30,8 @@ namespace aul {
     /// \tparam V Element type
     /// \tparam C Comparator type
     /// \tparam A Allocator type
-    template<typename K, typename V, typename C = std::less<K>, typename A = std::allocator<V>>
+    /// \tparam S Search policy type. See Search_policies.hpp
+    template<typename K, typename V, typename C = std::less<K>, typename A = std::allocator<V>, typename S = Binary_search_policy>
     class Array_map : public Allocator_aware_base<A> {
         using base = Allocator_aware_base<A>;
 
@@ -53,6 +57,8 @@ namespace aul {
         using value_compare = Value_comparator;
         using key_compare = C;
 
+        using search_policy = S;
+
         using value_pointer = typename std::allocator_traits<value_allocator_type>::pointer;
         using const_value_pointer = typename std::allocator_traits<value_allocator_type>::const_pointer;
 
@@ -104,6 +110,8 @@ namespace aul {
                 deallocate(allocation);
                 elem_count = 0;
             }
+
+            update_search_index();
         }
 
         ///
@@ -121,6 +129,8 @@ namespace aul {
                 deallocate(allocation);
                 elem_count = 0;
             }
+
+            update_search_index();
         }
 
         ///
@@ -133,7 +143,11 @@ namespace aul {
             base{arr.get_allocator()},
             allocation{std::move(arr.allocation)},
             comparator{std::move(arr.comparator)},
-            elem_count(std::exchange(arr.elem_count, 0)) {}
+            elem_count(std::exchange(arr.elem_count, 0)),
+            search_index(std::move(arr.search_index)) {
+
+            arr.update_search_index();
+        }
 
         ///
         /// Allocator-extended move constructor. If new allocator does not
@@ -153,6 +167,9 @@ namespace aul {
             }
 
             arr.elem_count = 0;
+
+            update_search_index();
+            arr.update_search_index();
         }
 
         template<class Zip_it>
@@ -189,6 +206,8 @@ namespace aul {
             if (duplicate_it != keys_end) {
                 throw std::runtime_error("Duplicate keys passed to Array_map constructor.");
             }
+
+            update_search_index();
         }
 
         template<class Zip_it>
@@ -243,6 +262,8 @@ namespace aul {
             comparator = rhs.comparator;
             elem_count = rhs.elem_count;
 
+            update_search_index();
+
             return *this;
         }
 
@@ -282,6 +303,9 @@ namespace aul {
                 rhs.elem_count = 0;
             }
 
+            search_index = std::move(rhs.search_index);
+            rhs.update_search_index();
+
             return *this;
         }
 
@@ -359,7 +383,7 @@ namespace aul {
 
         [[nodiscard]]
         V& at(const key_type& key) {
-            const key_pointer pos = aul::binary_search(allocation.keys, allocation.keys + elem_count, key, comparator);
+            const key_pointer pos = lower_bound_key(key);
 
             if (!elem_count || !pos || pos == (allocation.keys + elem_count) || *pos != key) {
                 throw std::out_of_range("aul::Array_map::at() called with invalid key");
@@ -370,7 +394,7 @@ namespace aul {
 
         [[nodiscard]]
         const V& at(const key_type& key) const {
-            const key_pointer pos = aul::binary_search(allocation.keys, allocation.keys + elem_count, key, comparator);
+            const key_pointer pos = lower_bound_key(key);
 
             if (!elem_count || !pos || pos == (allocation.keys + elem_count) || *pos != key) {
                 throw std::out_of_range("aul::Array_map::at() called with invalid key");
@@ -381,7 +405,7 @@ namespace aul {
 
         [[nodiscard]]
         V& at(key_type&& key) {
-            const key_pointer pos = aul::binary_search(allocation.keys, allocation.keys + elem_count, key, comparator);
+            const key_pointer pos = lower_bound_key(key);
 
             if (!elem_count || !pos || pos == (allocation.keys + elem_count) || *pos != key) {
                 throw std::out_of_range("aul::Array_map::at() called with invalid key");
@@ -392,7 +416,7 @@ namespace aul {
 
         [[nodiscard]]
         const V& at(const key_type&& key) const {
-            const key_pointer pos = aul::binary_search(allocation.keys, allocation.keys + elem_count, key, comparator);
+            const key_pointer pos = lower_bound_key(key);
 
             if (!elem_count || !pos || pos == (allocation.keys + elem_count) || *pos != key) {
                 throw std::out_of_range("aul::Array_map::at() called with invalid key");
@@ -405,25 +429,25 @@ namespace aul {
 
         [[nodiscard]]
         V& operator[](const key_type& key) noexcept {
-            const key_pointer key_ptr = aul::binary_search(allocation.keys, allocation.keys + elem_count, key, comparator);
+            const key_pointer key_ptr = lower_bound_key(key);
             return allocation.vals[key_ptr - allocation.keys];
         }
 
         [[nodiscard]]
         const V& operator[](const key_type& key) const noexcept {
-            const key_pointer key_ptr = aul::binary_search(allocation.keys, allocation.keys + elem_count, key, comparator);
+            const key_pointer key_ptr = lower_bound_key(key);
             return allocation.vals[key_ptr - allocation.keys];
         }
 
         [[nodiscard]]
         V& operator[](key_type&& key) noexcept {
-            const key_pointer key_ptr = aul::binary_search(allocation.keys, allocation.keys + elem_count, key, comparator);
+            const key_pointer key_ptr = lower_bound_key(key);
             return allocation.vals[key_ptr - allocation.keys];
         }
 
         [[nodiscard]]
         const V& operator[](key_type&& key) const noexcept {
-            const key_pointer key_ptr = aul::binary_search(allocation.keys, allocation.keys + elem_count, key, comparator);
+            const key_pointer key_ptr = lower_bound_key(key);
             return allocation.vals[key_ptr - allocation.keys];
         }
 
@@ -472,12 +496,14 @@ namespace aul {
             }
 
             //Check if element with key already exists
-            key_pointer key_ptr = aul::binary_search(allocation.keys, allocation.keys + elem_count, key, comparator);
+            key_pointer key_ptr = lower_bound_key(key);
             if (key_ptr && !empty() && (key_ptr != allocation.keys + elem_count) && compare_keys(*key_ptr, key)) {
                 value_pointer ptr = allocation.vals + (key_ptr - allocation.keys);
                 return std::make_pair(iterator{key_ptr, ptr}, false);
             }
 
+            Search_index_updater updater{*this};
+
             if (size() + 1 <= capacity()) {
                 key_pointer keys_end = allocation.keys + elem_count;
                 value_pointer vals_end = allocation.vals + elem_count;
@@ -579,12 +605,14 @@ namespace aul {
             }
 
             //Check if element with key already exists
-            key_pointer key_ptr = aul::binary_search(allocation.keys, allocation.keys + elem_count, key, comparator);
+            key_pointer key_ptr = lower_bound_key(key);
             if (key_ptr && !empty() && (key_ptr != allocation.keys + elem_count) && compare_keys(*key_ptr, key)) {
                 value_pointer val_ptr = allocation.vals + (key_ptr - allocation.keys);
                 return std::make_pair(iterator{key_ptr, val_ptr}, false);
             }
 
+            Search_index_updater updater{*this};
+
             if (size() + 1 <= capacity()) {
                 key_pointer keys_end = allocation.keys + elem_count;
                 value_pointer vals_end = allocation.vals + elem_count;
@@ -682,7 +710,7 @@ namespace aul {
             }
 
             //Check if element already exists
-            key_pointer key_ptr = aul::binary_search(allocation.keys, allocation.keys + elem_count, key, comparator);
+            key_pointer key_ptr = lower_bound_key(key);
             if (key_ptr && !empty() && (key_ptr != allocation.keys + elem_count) && compare_keys(*key_ptr, key)) {
                 value_pointer element_ptr = allocation.vals + (key_ptr - allocation.keys);
                 value_type temp{args...};
@@ -690,6 +718,8 @@ namespace aul {
                 return std::pair<iterator, bool>{iterator{key_ptr, element_ptr}, false};
             }
 
+            Search_index_updater updater{*this};
+
             if (size() + 1 <= capacity()) {
                 key_pointer keys_end = allocation.keys + elem_count;
                 value_pointer vals_end = allocation.vals + elem_count;
@@ -790,7 +820,7 @@ namespace aul {
             }
 
             //Check if element already exists
-            key_pointer key_ptr = aul::binary_search(allocation.keys, allocation.keys + elem_count, key, comparator);
+            key_pointer key_ptr = lower_bound_key(key);
             if (key_ptr && !empty() && compare_keys(*key_ptr, key)) {
                 value_pointer element_ptr = allocation.vals + (key_ptr - allocation.keys);
                 value_type temp{args...};
@@ -798,6 +828,8 @@ namespace aul {
                 return std::pair<iterator, bool>{iterator{key_ptr, element_ptr}, false};
             }
 
+            Search_index_updater updater{*this};
+
             if (size() + 1 <= capacity()) {
                 //Current allocation suffices
 
@@ -886,6 +918,72 @@ namespace aul {
 
         }
 
+        ///
+        /// Inserts the key-value pairs from the parallel ranges
+        /// [keys_begin, keys_end) and [values_begin, values_begin + n) in bulk.
+        ///
+        /// Keys which are already present in the container, and repeated keys
+        /// after their first occurrence in the input, are skipped.
+        ///
+        /// The input is sorted through a permutation rather than being inserted
+        /// one element at a time, so that loading n elements into a container
+        /// of size m costs O(n log n + m) rather than O(n * (n + m)). If the
+        /// keys are already sorted, the sort is skipped.
+        ///
+        /// Provides the strong exception guarantee if the key and value types
+        /// are both nothrow move constructible, or both copy constructible.
+        /// The new elements are only merged into the existing allocation if
+        /// doing so cannot throw.
+        ///
+        /// \tparam Key_iter Random access iterator over keys
+        /// \tparam Value_iter Random access iterator over values
+        /// \param keys_begin Iterator to beginning of key range
+        /// \param keys_end Iterator to end of key range
+        /// \param values_begin Iterator to beginning of value range
+        /// \return Number of elements which were inserted
+        template<class Key_iter, class Value_iter>
+        size_type insert_range(Key_iter keys_begin, Key_iter keys_end, Value_iter values_begin) {
+            const size_type n = static_cast<size_type>(keys_end - keys_begin);
+
+            std::vector<size_type> order(n);
+            std::iota(order.begin(), order.end(), size_type{0});
+
+            auto key_at = [&] (const size_type i) -> decltype(auto) {
+                return keys_begin[i];
+            };
+
+            if (!std::is_sorted(keys_begin, keys_end, comparator)) {
+                // A stable sort ensures that the first occurrence of a repeated
+                // key is the one which is retained
+                std::stable_sort(order.begin(), order.end(), [&] (const size_type a, const size_type b) {
+                    return comparator(key_at(a), key_at(b));
+                });
+            }
+
+            return merge_sorted_range(keys_begin, values_begin, order);
+        }
+
+        ///
+        /// Equivalent to insert_range() but with the precondition that the
+        /// keys are already sorted according to the container's comparator,
+        /// making the operation O(n + m).
+        ///
+        /// \tparam Key_iter Random access iterator over keys
+        /// \tparam Value_iter Random access iterator over values
+        /// \param keys_begin Iterator to beginning of sorted key range
+        /// \param keys_end Iterator to end of sorted key range
+        /// \param values_begin Iterator to beginning of value range
+        /// \return Number of elements which were inserted
+        template<class Key_iter, class Value_iter>
+        size_type insert_sorted(Key_iter keys_begin, Key_iter keys_end, Value_iter values_begin) {
+            const size_type n = static_cast<size_type>(keys_end - keys_begin);
+
+            std::vector<size_type> order(n);
+            std::iota(order.begin(), order.end(), size_type{0});
+
+            return merge_sorted_range(keys_begin, values_begin, order);
+        }
+
         //=================================================
         // Erasure methods
         //=================================================
@@ -897,6 +995,8 @@ namespace aul {
             key_pointer key_ptr = get<0>(pos);
             value_pointer val_ptr = get<1>(pos);
 
+            Search_index_updater updater{*this};
+
             std::move(key_ptr + 1, allocation.keys + elem_count, key_ptr);
             std::move(val_ptr + 1, allocation.vals + elem_count, val_ptr);
 
@@ -931,7 +1031,7 @@ namespace aul {
         ///     element exists
         [[nodiscard]]
         iterator find(const key_type& key) noexcept {
-            key_pointer key_ptr = {aul::binary_search(allocation.keys, allocation.keys + elem_count, key, comparator)};
+            key_pointer key_ptr = lower_bound_key(key);
 
             if (key_ptr && (key_ptr != allocation.keys + elem_count) && compare_keys(*key_ptr, key)) {
                 return iterator{key_ptr, allocation.vals + (key_ptr - allocation.keys)};
@@ -945,7 +1045,7 @@ namespace aul {
         /// \return Iterator to element. end() if not found
         [[nodiscard]]
         const_iterator find(const key_type& key) const noexcept {
-            key_pointer key_ptr = {aul::binary_search(allocation.keys, allocation.keys + elem_count, key, comparator)};
+            key_pointer key_ptr = lower_bound_key(key);
 
             if (key_ptr && (key_ptr != allocation.keys + elem_count) && compare_keys(*key_ptr, key)) {
                 return const_iterator{key_ptr, allocation.vals + (key_ptr - allocation.keys)};
@@ -957,7 +1057,7 @@ namespace aul {
         template<class K2>
         [[nodiscard]]
         iterator find(const K2& key) noexcept {
-            key_pointer key_ptr = {aul::binary_search(allocation.keys, allocation.keys + elem_count, key, comparator)};
+            key_pointer key_ptr = lower_bound_key(key);
 
             if (key_ptr && (key_ptr != allocation.keys + elem_count) && compare_keys(*key_ptr, key)) {
                 return iterator{key_ptr, allocation.vals + (key_ptr - allocation.keys)};
@@ -969,7 +1069,7 @@ namespace aul {
         template<class K2>
         [[nodiscard]]
         const_iterator find(const K2& key) const noexcept {
-            key_pointer key_ptr = {aul::binary_search(allocation.keys, allocation.keys + elem_count, key, comparator)};
+            key_pointer key_ptr = lower_bound_key(key);
 
             if (key_ptr && (key_ptr != allocation.keys + elem_count) && compare_keys(*key_ptr, key)) {
                 return const_iterator{key_ptr, allocation.vals + (key_ptr - allocation.keys)};
@@ -983,8 +1083,62 @@ namespace aul {
         /// \returns True if key maps to an element
         [[nodiscard]]
         bool contains(const key_type& key) const noexcept {
-            key_pointer ptr = aul::binary_search(allocation.keys, allocation.keys + elem_count, key, comparator);
-            return (ptr && size() && compare_keys(*ptr, key));
+            key_pointer ptr = lower_bound_key(key);
+            return (ptr && (ptr != allocation.keys + elem_count) && compare_keys(*ptr, key));
+        }
+
+        ///
+        /// Looks up multiple keys at once. The searches for the different keys
+        /// are interleaved so that their cache misses overlap, making this
+        /// considerably faster than calling find() for each key when the
+        /// container does not fit in cache.
+        ///
+        /// \param keys Keys to search for
+        /// \param out Span to write an iterator to the element corresponding
+        ///     to each key to. end() is written for keys which aren't present
+        void find_many(aul::Span<const key_type> keys, aul::Span<iterator> out) {
+            check_batch_output_size(keys, out.size());
+
+            search_many(keys, [&] (const size_type i, const key_pointer key_ptr, const bool is_found) {
+                out[i] = is_found ? iterator{key_ptr, allocation.vals + (key_ptr - allocation.keys)} : end();
+            });
+        }
+
+        ///
+        /// \param keys Keys to search for
+        /// \param out Span to write an iterator to the element corresponding
+        ///     to each key to. cend() is written for keys which aren't present
+        void find_many(aul::Span<const key_type> keys, aul::Span<const_iterator> out) const {
+            check_batch_output_size(keys, out.size());
+
+            search_many(keys, [&] (const size_type i, const key_pointer key_ptr, const bool is_found) {
+                out[i] = is_found ? const_iterator{key_ptr, allocation.vals + (key_ptr - allocation.keys)} : cend();
+            });
+        }
+
+        ///
+        /// \param keys Keys to search for
+        /// \param out Span to write the index of the element corresponding to
+        ///     each key to. size() is written for keys which aren't present
+        void find_many(aul::Span<const key_type> keys, aul::Span<size_type> out) const {
+            check_batch_output_size(keys, out.size());
+
+            search_many(keys, [&] (const size_type i, const key_pointer key_ptr, const bool is_found) {
+                out[i] = is_found ? static_cast<size_type>(key_ptr - allocation.keys) : elem_count;
+            });
+        }
+
+        ///
+        /// Checks for the presence of multiple keys at once. See find_many().
+        ///
+        /// \param keys Keys to search for
+        /// \param out Span to write whether each key maps to an element to
+        void contains_many(aul::Span<const key_type> keys, aul::Span<bool> out) const {
+            check_batch_output_size(keys, out.size());
+
+            search_many(keys, [&] (const size_type i, const key_pointer, const bool is_found) {
+                out[i] = is_found;
+            });
         }
 
         [[nodiscard]]
@@ -1019,6 +1173,7 @@ namespace aul {
             std::swap(elem_count, rhs.elem_count);
             std::swap(allocation, rhs.allocation);
             std::swap(comparator, rhs.comparator);
+            std::swap(search_index, rhs.search_index);
         }
 
         friend void swap(Array_map& lhs, Array_map& rhs) noexcept(noexcept(lhs.swap)) {
@@ -1082,6 +1237,8 @@ namespace aul {
 
             elem_count = 0;
             deallocate(allocation);
+
+            update_search_index();
         }
 
         ///
@@ -1100,6 +1257,9 @@ namespace aul {
             Allocation new_allocation = allocate(n);
             move_elements(allocation, new_allocation, elem_count);
 
+            destroy_elements(allocation, elem_count);
+            deallocate(allocation);
+
             allocation = std::move(new_allocation);
         }
 
@@ -1123,15 +1283,13 @@ namespace aul {
             return value_compare{};
         }
 
-        /*
         ///
         /// \return Pointer to internal value array
         ///
         [[nodiscard]]
-        pointer data() const noexcept {
+        value_pointer data() const noexcept {
             return allocation.vals;
         }
-        */
 
         ///
         ///
@@ -1202,6 +1360,8 @@ namespace aul {
         key_compare comparator{};
         size_type   elem_count{};
 
+        typename search_policy::template Index<K, C, key_allocator_type> search_index{key_allocator_type{base::get_allocator()}};
+
         //=================================================
         // (de)allocation helper functions
         //=================================================
@@ -1350,10 +1510,298 @@ namespace aul {
             aul::destroy_n(source.keys, n, key_alloc);
         }
 
+        //=================================================
+        // Bulk insertion helpers
+        //=================================================
+
+        ///
+        /// Merges new elements, visited in sorted order, into the container
+        ///
+        /// \tparam Key_iter Random access iterator over keys
+        /// \tparam Value_iter Random access iterator over values
+        /// \param keys Iterator to beginning of key range
+        /// \param values Iterator to beginning of value range
+        /// \param order Indices into the key and value ranges, ordered such
+        ///     that the keys they refer to are sorted. Modified to hold only
+        ///     the indices of the elements which are to be inserted
+        /// \return Number of elements which were inserted
+        template<class Key_iter, class Value_iter>
+        size_type merge_sorted_range(Key_iter keys, Value_iter values, std::vector<size_type>& order) {
+            // Drop repeated keys, and keys which are already present, while
+            // recording how many existing elements precede each new element
+            std::vector<size_type> preceding;
+            preceding.reserve(order.size());
+
+            size_type m = 0;
+            size_type i = 0;
+            for (size_type j = 0; j < order.size(); ++j) {
+                const auto& key = keys[order[j]];
+
+                if (m != 0 && !comparator(keys[order[m - 1]], key)) {
+                    continue;
+                }
+
+                while (i < elem_count && comparator(allocation.keys[i], key)) {
+                    ++i;
+                }
+
+                if (i < elem_count && !comparator(key, allocation.keys[i])) {
+                    continue;
+                }
+
+                order[m++] = order[j];
+                preceding.push_back(i);
+            }
+            order.resize(m);
+
+            if (m == 0) {
+                return 0;
+            }
+
+            Search_index_updater updater{*this};
+
+            if (max_size() - m < elem_count) {
+                throw std::length_error("aul::Array_map grew too big");
+            }
+
+            using key_reference = decltype(keys[0]);
+            using value_reference = decltype(values[0]);
+
+            constexpr bool is_nothrow_mergeable =
+                std::is_nothrow_constructible_v<key_type, key_reference> &&
+                std::is_nothrow_assignable_v<key_type&, key_reference> &&
+                std::is_nothrow_constructible_v<value_type, value_reference> &&
+                std::is_nothrow_assignable_v<value_type&, value_reference> &&
+                std::is_nothrow_move_constructible_v<key_type> &&
+                std::is_nothrow_move_assignable_v<key_type> &&
+                std::is_nothrow_move_constructible_v<value_type> &&
+                std::is_nothrow_move_assignable_v<value_type>;
+
+            if (is_nothrow_mergeable && elem_count + m <= capacity()) {
+                merge_within_capacity(keys, values, order);
+            } else {
+                merge_with_new_allocation(keys, values, order, preceding);
+            }
+
+            return m;
+        }
+
+        ///
+        /// Merges new elements into the current allocation by filling it from
+        /// the back. Elements are placed in uninitialized slots via
+        /// construction and in initialized slots via assignment.
+        ///
+        /// \param keys Iterator to beginning of key range
+        /// \param values Iterator to beginning of value range
+        /// \param order Sorted indices of elements to insert. None may be
+        ///     equivalent to an existing key
+        template<class Key_iter, class Value_iter>
+        void merge_within_capacity(Key_iter keys, Value_iter values, const std::vector<size_type>& order) noexcept {
+            size_type i = elem_count;
+            size_type j = order.size();
+            size_type w = elem_count + order.size();
+
+            while (j != 0) {
+                --w;
+
+                if (i != 0 && comparator(keys[order[j - 1]], allocation.keys[i - 1])) {
+                    --i;
+                    if (w < elem_count) {
+                        allocation.keys[w] = std::move(allocation.keys[i]);
+                        allocation.vals[w] = std::move(allocation.vals[i]);
+                    } else {
+                        construct_key(allocation.keys + w, std::move(allocation.keys[i]));
+                        construct_val(allocation.vals + w, std::move(allocation.vals[i]));
+                    }
+                } else {
+                    --j;
+                    if (w < elem_count) {
+                        allocation.keys[w] = keys[order[j]];
+                        allocation.vals[w] = values[order[j]];
+                    } else {
+                        construct_key(allocation.keys + w, keys[order[j]]);
+                        construct_val(allocation.vals + w, values[order[j]]);
+                    }
+                }
+            }
+
+            elem_count += order.size();
+        }
+
+        ///
+        /// Merges new elements with the existing elements in a new allocation.
+        /// New elements are constructed first so that the container is left
+        /// unmodified if any of them throw.
+        ///
+        /// \param keys Iterator to beginning of key range
+        /// \param values Iterator to beginning of value range
+        /// \param order Sorted indices of elements to insert. None may be
+        ///     equivalent to an existing key
+        /// \param preceding Number of existing elements which precede each of
+        ///     the new elements
+        template<class Key_iter, class Value_iter>
+        void merge_with_new_allocation(Key_iter keys, Value_iter values, const std::vector<size_type>& order, const std::vector<size_type>& preceding) {
+            const size_type m = order.size();
+            const size_type new_size = elem_count + m;
+
+            Allocation new_allocation = allocate(grow_size(new_size));
+
+            auto val_alloc = get_allocator();
+            auto key_alloc = key_allocator_type{val_alloc};
+
+            // Construct new elements in their final positions
+            size_type j = 0;
+            try {
+                for (; j < m; ++j) {
+                    const size_type w = j + preceding[j];
+                    construct_key(new_allocation.keys + w, keys[order[j]]);
+                    try {
+                        construct_val(new_allocation.vals + w, values[order[j]]);
+                    } catch (...) {
+                        destroy_key(new_allocation.keys + w);
+                        throw;
+                    }
+                }
+            } catch (...) {
+                for (size_type k = 0; k < j; ++k) {
+                    destroy_key(new_allocation.keys + k + preceding[k]);
+                    destroy_val(new_allocation.vals + k + preceding[k]);
+                }
+                deallocate(new_allocation);
+                throw;
+            }
+
+            // Existing elements are only moved if neither their keys nor their
+            // values can throw while doing so. Otherwise a failure part way
+            // through could leave some moved-from pairs behind in the current
+            // allocation
+            constexpr bool is_move_safe =
+                (std::is_nothrow_move_constructible_v<key_type> && std::is_nothrow_move_constructible_v<value_type>) ||
+                !(std::is_copy_constructible_v<key_type> && std::is_copy_constructible_v<value_type>);
+
+            auto relocate = [] (auto& x) -> decltype(auto) {
+                if constexpr (is_move_safe) {
+                    return std::move(x);
+                } else {
+                    return std::as_const(x);
+                }
+            };
+
+            // Fill the gaps between them with the existing elements
+            size_type i = 0;
+            try {
+                for (j = 0; j <= m; ++j) {
+                    const size_type gap_end = (j == m) ? elem_count : preceding[j];
+                    for (; i < gap_end; ++i) {
+                        const size_type w = i + j;
+                        construct_key(new_allocation.keys + w, relocate(allocation.keys[i]));
+                        try {
+                            construct_val(new_allocation.vals + w, relocate(allocation.vals[i]));
+                        } catch (...) {
+                            destroy_key(new_allocation.keys + w);
+                            throw;
+                        }
+                    }
+                }
+            } catch (...) {
+                // Every slot before the failed element has been constructed,
+                // as have the new elements after it
+                const size_type failed = i + j;
+                aul::destroy_n(new_allocation.keys, failed, key_alloc);
+                aul::destroy_n(new_allocation.vals, failed, val_alloc);
+                for (; j < m; ++j) {
+                    destroy_key(new_allocation.keys + j + preceding[j]);
+                    destroy_val(new_allocation.vals + j + preceding[j]);
+                }
+                deallocate(new_allocation);
+                throw;
+            }
+
+            destroy_elements(allocation, elem_count);
+            deallocate(allocation);
+
+            allocation = std::move(new_allocation);
+            elem_count = new_size;
+        }
+
         //=================================================
         // Misc. helper functions
         //=================================================
 
+        ///
+        /// Brings the search index up to date with the current keys
+        ///
+        void update_search_index() noexcept {
+            search_index.rebuild(allocation.keys, elem_count);
+        }
+
+        ///
+        /// Invalidates the search index for the duration of a modification to
+        /// the keys, and rebuilds it once the modification is complete,
+        /// including when the modification exits through an exception
+        ///
+        struct Search_index_updater {
+
+            explicit Search_index_updater(Array_map& map) noexcept:
+                map(map) {
+                map.search_index.invalidate();
+            }
+
+            Search_index_updater(const Search_index_updater&) = delete;
+
+            ~Search_index_updater() {
+                map.update_search_index();
+            }
+
+            Array_map& map;
+
+        };
+
+        ///
+        /// \param key Key to search for
+        /// \return Pointer to the first key which does not compare less than
+        ///     key. Pointer to end of keys if no such key exists
+        template<class K2>
+        [[nodiscard]]
+        key_pointer lower_bound_key(const K2& key) const {
+            return search_index.lower_bound(allocation.keys, elem_count, key, comparator);
+        }
+
+        ///
+        /// Searches for keys in batches, invoking f with the index of each
+        /// key, a pointer to where it's expected, and whether it was found
+        ///
+        /// \param keys Keys to search for
+        /// \param f Callback object
+        template<class F>
+        void search_many(aul::Span<const key_type> keys, F f) const {
+            constexpr size_type batch_size = 64;
+
+            const key_type* key_ptrs = keys.data();
+            const key_pointer keys_end = allocation.keys + elem_count;
+
+            key_pointer results[batch_size];
+            for (size_type i = 0; i < keys.size(); i += batch_size) {
+                const size_type n = std::min(batch_size, keys.size() - i);
+                search_index.lower_bound_many(allocation.keys, elem_count, key_ptrs + i, key_ptrs + i + n, results, comparator);
+
+                for (size_type j = 0; j < n; ++j) {
+                    const key_pointer key_ptr = results[j];
+                    const bool is_found = (key_ptr != keys_end) && compare_keys(*key_ptr, key_ptrs[i + j]);
+                    f(i + j, key_ptr, is_found);
+                }
+            }
+        }
+
+        ///
+        /// \param keys Keys passed to a batched lookup
+        /// \param out_size Size of the output span passed alongside them
+        static void check_batch_output_size(aul::Span<const key_type> keys, const size_type out_size) {
+            if (out_size < keys.size()) {
+                throw std::length_error("aul::Array_map batched lookup given output span smaller than key span");
+            }
+        }
+
         ///
         /// \param n Minimum number of new elements
         /// \return Size the Array_map should grow to accommodate
@@ -1375,8 +1823,8 @@ namespace aul {
 
     };
 
-    template<typename K, typename T, typename C, typename A>
-    class Array_map<K, T, C, A>::Value_comparator {
+    template<typename K, typename T, typename C, typename A, typename S>
+    class Array_map<K, T, C, A, S>::Value_comparator {
     public:
 
         ///
@@ -1392,8 +1840,8 @@ namespace aul {
 
     };
 
-    template<typename K, typename T, typename C, typename A>
-    class Array_map<K, T, C, A>::Allocation {
+    template<typename K, typename T, typename C, typename A, typename S>
+    class Array_map<K, T, C, A, S>::Allocation {
     public:
 
         //=================================================
@@ -1,6 +1,7 @@
 #ifndef AUL_CIRCULAR_ARRAY_HPP
 #define AUL_CIRCULAR_ARRAY_HPP
 
+#include <array>
 #include <memory>
 #include <tuple>
 #include <stdexcept>
@@ -9,11 +10,14 @@
 #include <algorithm>
 #include <iterator>
 #include <utility>
+#include <cstring>
+#include <type_traits>
 
 #include <aul/containers/Allocator_aware_base.hpp>
 #include <aul/memory/Allocation.hpp>
 #include <aul/Algorithms.hpp>
 #include <aul/memory/Memory.hpp>
+#include <aul/Span.hpp>
 
 namespace aul {
 
@@ -204,6 +208,288 @@ namespace aul {
 
     };
 
+    ///
+    /// Class meant to be used as aul::Circular_array::iterator when the
+    /// container's capacity is always a power of two.
+    ///
+    /// Holds a pointer to the start of the allocation, the capacity minus
+    /// one, and a logical offset from the start of the allocation. The
+    /// offset may lie outside of the allocation in either direction, as it's
+    /// reduced with a single mask on dereference.
+    ///
+    /// \tparam P Pointer type
+    template<class P>
+    class Circular_array_mask_iterator {
+    public:
+
+        //=================================================
+        // Type aliases
+        //=================================================
+
+        using value_type = typename std::iterator_traits<P>::value_type;
+        using difference_type = typename std::iterator_traits<P>::difference_type;
+        using reference = value_type&;
+        using pointer = P;
+        using iterator_category = std::random_access_iterator_tag;
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+        ///
+        /// \param offset Offset of element from start of allocation
+        /// \param a Pointer to start of allocation
+        /// \param b Pointer to end of allocation. b - a must be a power of two
+        ///     or zero
+        Circular_array_mask_iterator(const difference_type offset, pointer a, pointer b):
+            base(a),
+            mask((b - a) - 1),
+            offset(offset) {}
+
+        Circular_array_mask_iterator() = default;
+        Circular_array_mask_iterator(const Circular_array_mask_iterator& it) = default;
+        Circular_array_mask_iterator(Circular_array_mask_iterator&& it) noexcept = default;
+        ~Circular_array_mask_iterator() = default;
+
+        //=================================================
+        // Assignment operators/methods
+        //=================================================
+
+        Circular_array_mask_iterator& operator=(const Circular_array_mask_iterator& it) = default;
+        Circular_array_mask_iterator& operator=(Circular_array_mask_iterator&& it) noexcept = default;
+
+        //=================================================
+        // Comparison operators
+        //=================================================
+
+        [[nodiscard]]
+        bool operator==(const Circular_array_mask_iterator it) const {
+            return (offset == it.offset) && (base == it.base);
+        }
+
+        [[nodiscard]]
+        bool operator!=(const Circular_array_mask_iterator it) const {
+            return (offset != it.offset) || (base != it.base);
+        }
+
+        [[nodiscard]]
+        bool operator<(const Circular_array_mask_iterator it) const {
+            return offset < it.offset;
+        }
+
+        [[nodiscard]]
+        bool operator>(const Circular_array_mask_iterator it) const {
+            return offset > it.offset;
+        }
+
+        [[nodiscard]]
+        bool operator<=(const Circular_array_mask_iterator it) const {
+            return offset <= it.offset;
+        }
+
+        [[nodiscard]]
+        bool operator>=(const Circular_array_mask_iterator it) const {
+            return offset >= it.offset;
+        }
+
+        //=================================================
+        // Increment/Decrement operators
+        //=================================================
+
+        Circular_array_mask_iterator& operator++() {
+            ++offset;
+            return *this;
+        }
+
+        Circular_array_mask_iterator operator++(int) {
+            auto temp = *this;
+            ++offset;
+            return temp;
+        }
+
+        Circular_array_mask_iterator& operator--() {
+            --offset;
+            return *this;
+        }
+
+        Circular_array_mask_iterator operator--(int) {
+            auto temp = *this;
+            --offset;
+            return temp;
+        }
+
+        //=================================================
+        // Arithmetic operators
+        //=================================================
+
+        [[nodiscard]]
+        Circular_array_mask_iterator operator+(const difference_type x) const {
+            auto temp = *this;
+            temp.offset += x;
+            return temp;
+        }
+
+        [[nodiscard]]
+        Circular_array_mask_iterator operator-(const difference_type x) const {
+            auto temp = *this;
+            temp.offset -= x;
+            return temp;
+        }
+
+        [[nodiscard]]
+        friend Circular_array_mask_iterator operator+(const difference_type x, Circular_array_mask_iterator it) {
+            it.offset += x;
+            return it;
+        }
+
+        [[nodiscard]]
+        difference_type operator-(const Circular_array_mask_iterator it) const {
+            return offset - it.offset;
+        }
+
+        //=================================================
+        // Arithmetic assignment operators
+        //=================================================
+
+        Circular_array_mask_iterator& operator+=(const difference_type x) {
+            offset += x;
+            return *this;
+        }
+
+        Circular_array_mask_iterator& operator-=(const difference_type x) {
+            offset -= x;
+            return *this;
+        }
+
+        //=================================================
+        // Dereference operators
+        //=================================================
+
+        [[nodiscard]]
+        reference operator*() const {
+            return *operator->();
+        }
+
+        [[nodiscard]]
+        reference operator[](const difference_type x) const {
+            return base[(offset + x) & mask];
+        }
+
+        [[nodiscard]]
+        pointer operator->() const {
+            return base + (offset & mask);
+        }
+
+        //=================================================
+        // Conversion operators
+        //=================================================
+
+        ///
+        /// Implicit conversion from iterator from non-const to iterator to
+        /// const
+        ///
+        /// \return Iterator to const which points to same location as this object
+        [[nodiscard]]
+        operator Circular_array_mask_iterator<typename std::pointer_traits<P>::template rebind<const value_type>>() const {
+            return {offset, base, base + (mask + 1)};
+        }
+
+    private:
+
+        //=================================================
+        // Instance members
+        //=================================================
+
+        pointer base{};
+        difference_type mask{};
+        difference_type offset{};
+
+    };
+
+    ///
+    /// Capacity policy under which aul::Circular_array allocates exactly as
+    /// much space as it needs to hold the requested number of elements.
+    ///
+    struct Circular_array_exact_capacity {
+
+        static constexpr bool is_power_of_two = false;
+
+        static constexpr bool is_mirrored = false;
+
+        static constexpr bool is_bounded = false;
+
+        template<class P>
+        using iterator = Circular_array_iterator<P>;
+
+    };
+
+    ///
+    /// Capacity policy under which aul::Circular_array's capacity is always
+    /// rounded up to a power of two, or zero. Wrapping around the end of the
+    /// allocation then reduces to a single mask, and iterators are a base
+    /// pointer, a mask and an offset.
+    ///
+    struct Circular_array_pow2_capacity {
+
+        static constexpr bool is_power_of_two = true;
+
+        static constexpr bool is_mirrored = false;
+
+        static constexpr bool is_bounded = false;
+
+        template<class P>
+        using iterator = Circular_array_mask_iterator<P>;
+
+    };
+
+    ///
+    /// Capacity policy under which aul::Circular_array's allocation is
+    /// immediately followed by a mirror of itself, so that its elements are
+    /// always contiguous in memory even when they wrap around the end of the
+    /// allocation. data() then returns a pointer to all of them.
+    ///
+    /// Must be paired with an allocator which creates such mirrored
+    /// allocations and exposes a static allocation_granularity() method, such
+    /// as aul::Mirrored_allocator. Capacity is rounded up to a multiple of
+    /// that granularity, i.e. a whole number of pages.
+    ///
+    struct Circular_array_mirrored_capacity {
+
+        static constexpr bool is_power_of_two = false;
+
+        static constexpr bool is_mirrored = true;
+
+        static constexpr bool is_bounded = false;
+
+        template<class P>
+        using iterator = Circular_array_iterator<P>;
+
+    };
+
+    ///
+    /// Capacity policy under which aul::Circular_array never grows its
+    /// allocation when elements are added to either end. Instead, once the
+    /// container is full, pushing an element to the back destroys the first
+    /// element to make room for it, and pushing an element to the front
+    /// destroys the last. This turns the container into a fixed-size sliding
+    /// window over the most recently pushed elements.
+    ///
+    /// The size of the window is the container's capacity. It's set by the
+    /// number of elements the container is constructed with, or explicitly
+    /// through reserve(), and is preserved by copies, moves, assign(), and
+    /// push_back_n(), which keep only the last capacity() elements they're
+    /// given. Insertions at any other position through insert() or emplace()
+    /// still grow the allocation as usual, widening the window.
+    ///
+    /// \tparam P Underlying capacity policy which determines how the
+    ///     allocation's size is rounded
+    template<class P = Circular_array_exact_capacity>
+    struct Circular_array_bounded_capacity : public P {
+
+        static constexpr bool is_bounded = true;
+
+    };
+
     ///
     /// A vector-like container which allows for unused space at both before and
     /// after the elements in the allocation, potentially making insertions
@@ -212,7 +498,11 @@ namespace aul {
     ///
     /// \tparam T Element type
     /// \tparam A Allocator type
-    template<class T, class A = std::allocator<T>>
+    /// \tparam P Capacity policy. One of aul::Circular_array_exact_capacity,
+    ///     aul::Circular_array_pow2_capacity or
+    ///     aul::Circular_array_mirrored_capacity, optionally wrapped in
+    ///     aul::Circular_array_bounded_capacity
+    template<class T, class A = std::allocator<T>, class P = Circular_array_exact_capacity>
     class Circular_array : public aul::Allocator_aware_base<A> {
         using base = aul::Allocator_aware_base<A>;
     public:
@@ -234,8 +524,10 @@ namespace aul {
         using pointer = typename std::allocator_traits<A>::pointer;
         using const_pointer = typename std::allocator_traits<A>::const_pointer;
 
-        using iterator = Circular_array_iterator<pointer>;
-        using const_iterator = Circular_array_iterator<pointer>;
+        using capacity_policy = P;
+
+        using iterator = typename P::template iterator<pointer>;
+        using const_iterator = typename P::template iterator<pointer>;
 
         using reverse_iterator = std::reverse_iterator<iterator>;
         using const_reverse_iterator = std::reverse_iterator<const_iterator>;
@@ -272,11 +564,10 @@ namespace aul {
         /// \param arr Source object to copy from
         Circular_array(const Circular_array& arr):
             base(std::allocator_traits<A>::select_on_container_copy_construction(arr.get_allocator())),
-            allocation(allocate(arr.size())),
+            allocation(allocate(required_capacity(arr))),
             elem_count(arr.elem_count) {
 
-            auto allocator = get_allocator();
-            aul::uninitialized_copy(arr.cbegin(), arr.cend(), allocation.ptr, allocator);
+            uninitialized_copy_elements(arr, allocation.ptr);
         }
 
         ///
@@ -287,19 +578,18 @@ namespace aul {
         /// \param alloc Allocator copy should use
         Circular_array(const Circular_array& arr, const A& alloc):
             base(alloc),
-            allocation(allocate(arr.size())),
+            allocation(allocate(required_capacity(arr))),
             elem_count(arr.elem_count) {
 
-            auto allocator = get_allocator();
-            aul::uninitialized_copy(arr.cbegin(), arr.cend(), allocation.ptr, allocator);
+            uninitialized_copy_elements(arr, allocation.ptr);
         }
 
         ///
         /// Move constructor
         /// \param arr T Object to move resources from
         Circular_array(Circular_array&& arr) noexcept:
-            base(std::move(arr.allocator)),
-            allocation(std::move(allocation)),
+            base(arr.get_allocator()),
+            allocation(std::exchange(arr.allocation, {})),
             elem_count(arr.elem_count),
             head_offset(arr.head_offset) {
 
@@ -312,11 +602,11 @@ namespace aul {
         /// \param alloc Allocator container should copy
         Circular_array(Circular_array&& arr, const A& alloc):
             base(alloc),
-            allocation(get_allocator() == arr.allocator ? std::move(arr.allocation) : allocate(arr.size())),
+            allocation(alloc == arr.get_allocator() ? std::exchange(arr.allocation, {}) : allocate(required_capacity(arr))),
             elem_count(arr.elem_count),
-            head_offset(get_allocator() == arr.allocator ? arr.head_offset : 0) {
+            head_offset(alloc == arr.get_allocator() ? arr.head_offset : 0) {
 
-            if (get_allocator() == arr.allocator) {
+            if (alloc == arr.get_allocator()) {
                 arr.elem_count = 0;
                 arr.head_offset = 0;
             } else {
@@ -387,11 +677,38 @@ namespace aul {
         ///
         /// Copy assignment operator
         ///
+        /// If rhs's elements fit within the current allocation and their copy
+        /// constructor cannot throw, the allocation is reused.
+        ///
         /// Invalidates iterators
         ///
         /// \param rhs Object to copy resources from
         /// \return *this
         Circular_array& operator=(const Circular_array& rhs) {
+            if (this == &rhs) {
+                return *this;
+            }
+
+            constexpr bool can_reuse_allocation =
+                std::is_nothrow_copy_constructible_v<T> && (
+                    std::allocator_traits<A>::is_always_equal::value ||
+                    !std::allocator_traits<A>::propagate_on_container_copy_assignment::value
+                );
+
+            if constexpr (can_reuse_allocation) {
+                const bool fits = P::is_bounded ?
+                    rhs.capacity() == capacity() :
+                    rhs.size() <= capacity();
+
+                if (fits) {
+                    clear();
+                    head_offset = 0;
+                    uninitialized_copy_elements(rhs, allocation.ptr);
+                    elem_count = rhs.elem_count;
+                    return *this;
+                }
+            }
+
             Circular_array temp{rhs};
            this->swap(temp);
 
@@ -410,22 +727,36 @@ namespace aul {
                 std::allocator_traits<A>::is_always_equal::value ||
                 std::allocator_traits<A>::propagate_on_container_move_assignment::value;
 
-            if (should_propagate) {
-                base::operator=(rhs);
-                allocation = std::move(rhs.allocation);
+            if (this == &rhs) {
+                return *this;
+            }
+
+            if constexpr (should_propagate) {
+                clear();
+                deallocate(allocation);
+
+                base::operator=(std::move(rhs));
+                allocation = std::exchange(rhs.allocation, {});
                 elem_count = std::exchange(rhs.elem_count, 0);
                 head_offset = std::exchange(rhs.head_offset, 0);
             } else {
-                base::operator=(rhs);
-
-                auto new_allocation = allocate(rhs.elem_count);
+                auto new_allocation = allocate(required_capacity(rhs));
                 auto allocator = get_allocator();
-                aul::uninitialized_move(rhs.begin(), rhs.end(), new_allocation.ptr, allocator);
 
+                try {
+                    aul::uninitialized_move(rhs.begin(), rhs.end(), new_allocation.ptr, allocator);
+                } catch (...) {
+                    deallocate(new_allocation);
+                    throw;
+                }
+
+                clear();
+                deallocate(allocation);
+                allocation = new_allocation;
+                elem_count = rhs.elem_count;
+
+                rhs.clear();
                 rhs.deallocate(rhs.allocation);
-                head_offset = 0;
-                rhs.head_offset = 0;
-                elem_count = std::exchange(rhs.elem_count, 0);
             }
             return *this;
         }
@@ -449,6 +780,9 @@ namespace aul {
         /// Replaces the current contents of the container with copies of the
         /// elements in the range of [a, b].
         ///
+        /// Under a bounded capacity policy, the capacity is left unchanged and
+        /// only the last capacity() elements of the range are kept.
+        ///
         /// Provides the strong exception guarantee.
         ///
         /// Invalidates iterators.
@@ -458,15 +792,35 @@ namespace aul {
         /// \param b Iterator to end of range
         template<class Iter>
         void assign(Iter a, Iter b) {
-            auto range_size = std::distance(a, b);
+            auto range_size = static_cast<size_type>(std::distance(a, b));
+
+            if constexpr (P::is_bounded) {
+                if (capacity() < range_size) {
+                    std::advance(a, range_size - capacity());
+                    range_size = capacity();
+                }
+            }
 
             if (range_size > max_size()) {
                 throw std::length_error("aul::Circular_array grew beyond max size");
             }
 
-            auto new_allocation = allocate(range_size);
-
             auto allocator = get_allocator();
+
+            // Reuse the current allocation when constructing the new elements
+            // can't fail part way through
+            if constexpr (std::is_nothrow_copy_constructible_v<T>) {
+                if (range_size <= capacity()) {
+                    clear();
+                    head_offset = 0;
+                    aul::uninitialized_copy(a, b, allocation.ptr, allocator);
+                    elem_count = range_size;
+                    return;
+                }
+            }
+
+            auto new_allocation = allocate(P::is_bounded ? capacity() : range_size);
+
             try {
                 aul::uninitialized_copy(a, b, new_allocation.ptr, allocator);
             } catch (...) {
@@ -495,7 +849,10 @@ namespace aul {
         }
 
         ///
-        /// Replace the current contents of the container with n copies of n.
+        /// Replace the current contents of the container with n copies of val.
+        ///
+        /// Under a bounded capacity policy, the capacity is left unchanged and
+        /// at most capacity() copies are made.
         ///
         /// Provides the strong exception guarantee.
         ///
@@ -503,9 +860,13 @@ namespace aul {
         ///
         /// \param n   Number of elements to fill container with
         /// \param val Value to fill container with
-        void assign(const size_type n, const T& val) {
+        void assign(size_type n, const T& val) {
+            if constexpr (P::is_bounded) {
+                n = std::min(n, capacity());
+            }
+
             auto allocator = get_allocator();
-            auto new_allocation = allocate(n);
+            auto new_allocation = allocate(P::is_bounded ? capacity() : n);
 
             try {
                 aul::uninitialized_fill_n(new_allocation.ptr, n, val, allocator);
@@ -746,7 +1107,7 @@ namespace aul {
                 throw std::length_error("Circular_array grew too big");
             }
 
-            if (elem_count + n < allocation.capacity) {
+            if (elem_count + n <= allocation.capacity) {
                 return insert_within_capacity_n(it, n, val);
             } else {
                 return insert_with_new_allocation_n(it, n, val);
@@ -764,17 +1125,17 @@ namespace aul {
         /// \return Iterator to first of newly inserted elements
         template<class Iter>
         iterator insert(const_iterator pos, Iter from, Iter to) {
-            auto d = std::distance(to, from);
+            const auto d = static_cast<size_type>(std::distance(from, to));
 
             if (max_size() - d < elem_count) {
                 throw std::runtime_error("Circular_array grew beyond max size");
             }
 
-            iterator it = begin() + (pos - cbegin());
-            if (elem_count + d < capacity()) {
-                return insert_within_capacity(it, from, to, d);
+            const auto i = static_cast<size_type>(pos - cbegin());
+            if (elem_count + d <= capacity()) {
+                return insert_within_capacity(i, from, d);
             } else {
-                return insert_with_new_allocation(it, from, to, d);
+                return insert_with_new_allocation(i, from, d);
             }
         }
 
@@ -793,12 +1154,22 @@ namespace aul {
         /// Constructs a new element as the new first element in the array using
         /// the specified parameters.
         ///
+        /// Under a bounded capacity policy, if the container is full, the last
+        /// element is destroyed to make room for the new one.
+        ///
         /// Provides strong-exception guarantee.
         ///
         /// \tparam Args Types taken by object constructor
         /// \param args Arguments to constructor of new object
         template<class...Args>
         void emplace_front(Args...args) {
+            if constexpr (P::is_bounded) {
+                if (elem_count == allocation.capacity) {
+                    emplace_front_overwriting(std::forward<Args>(args)...);
+                    return;
+                }
+            }
+
             if (max_size() -  1 < size()) {
                 throw std::length_error("Circular_array grew too big");
             }
@@ -830,12 +1201,23 @@ namespace aul {
         /// Constructs a new element at the end of the logical array using the
         /// specified parameters.
         ///
+        /// Under a bounded capacity policy, if the container is full, the first
+        /// element is destroyed to make room for the new one, in constant time
+        /// and without allocating.
+        ///
         /// Provides strong-exception guarantee
         ///
         /// \tparam Args Parameter types for new element's constructor
         /// \param args Parameter types for new element's constructor
         template<class...Args>
         void emplace_back(Args...args) {
+            if constexpr (P::is_bounded) {
+                if (elem_count == allocation.capacity) {
+                    emplace_back_overwriting(std::forward<Args>(args)...);
+                    return;
+                }
+            }
+
             if (max_size() -  1 < size()) {
                 throw std::length_error("Circular_array grew too big");
             }
@@ -863,6 +1245,54 @@ namespace aul {
             emplace_back(std::forward<T&&>(val));
         }
 
+        ///
+        /// Copy-inserts n elements from the range beginning at first at the end
+        /// of the logical array. The new elements are constructed one
+        /// contiguous segment of the allocation at a time.
+        ///
+        /// Under a bounded capacity policy, as many elements as necessary are
+        /// first destroyed from the front of the container to make room, so
+        /// the container never allocates. If n exceeds capacity(), only the
+        /// last capacity() elements of the range are kept.
+        ///
+        /// Provides the basic exception guarantee.
+        ///
+        /// \tparam Iter Forward iterator type
+        /// \param first Iterator to beginning of range of elements to insert
+        /// \param n Number of elements in range
+        template<class Iter>
+        void push_back_n(Iter first, const size_type n) {
+            if constexpr (P::is_bounded) {
+                const size_type c = capacity();
+                if (c <= n) {
+                    clear();
+                    uninitialized_copy_wrapped(0, std::next(first, n - c), c);
+                    elem_count = c;
+                    return;
+                }
+
+                if (c - n < elem_count) {
+                    const size_type excess = elem_count - (c - n);
+
+                    auto allocator = get_allocator();
+                    aul::destroy(begin(), begin() + excess, allocator);
+                    increase_head_offset(excess);
+                    elem_count -= excess;
+                }
+            } else {
+                if (max_size() - n < elem_count) {
+                    throw std::length_error("Circular_array grew too big");
+                }
+
+                if (capacity() - elem_count < n) {
+                    reserve(grow_size(elem_count + n));
+                }
+            }
+
+            uninitialized_copy_wrapped(elem_count, first, n);
+            elem_count += n;
+        }
+
         //=================================================
         // Element removal
         //=================================================
@@ -969,9 +1399,15 @@ namespace aul {
                 throw std::length_error("aul::Circular_array::reserve() called with excessive allocation size");
             }
 
+            if constexpr (can_grow_in_place) {
+                grow_in_place(n);
+                return;
+            }
+
             auto allocator = get_allocator();
             allocation_type new_allocation = allocate(n);
-            aul::uninitialized_move(begin(), end(), new_allocation.ptr, allocator);
+            uninitialized_move_elements(0, elem_count, new_allocation.ptr);
+            aul::destroy(begin(), end(), allocator);
 
             deallocate(allocation);
             allocation = new_allocation;
@@ -1022,7 +1458,18 @@ namespace aul {
             auto allocator = get_allocator();
             const size_type max_allocation = std::allocator_traits<A>::max_size(allocator);
 
-            return std::min(max_allocation, type_max);
+            const size_type m = std::min(max_allocation, type_max);
+            if constexpr (P::is_mirrored) {
+                return m - m % A::allocation_granularity();
+            } else if constexpr (P::is_power_of_two) {
+                size_type ret = 1;
+                while (ret <= m / 2) {
+                    ret *= 2;
+                }
+                return ret;
+            } else {
+                return m;
+            }
         }
 
         ///
@@ -1040,25 +1487,53 @@ namespace aul {
             return base::get_allocator();
         }
 
-        /*
         ///
-        /// \return
+        /// The container's elements occupy at most two contiguous segments of
+        /// its allocation: one from the first element up to the end of the
+        /// allocation, and one from the start of the allocation, if they wrap
+        /// around. Under aul::Circular_array_mirrored_capacity the second is
+        /// always empty.
+        ///
+        /// Invalidated along with iterators.
+        ///
+        /// \return Spans over the container's elements, in order. The second
+        ///     is empty unless the elements wrap around
         [[nodiscard]]
-        std::tuple<pointer, pointer, pointer, pointer> data() {
-            const auto segment0 = first_segment();
-            const auto segment1 = second_segment();
-            return {segment0.first, segment0.second, segment1.first, segment1.second};
+        std::array<aul::Span<T>, 2> as_spans() noexcept {
+            return {make_span(first_segment()), make_span(second_segment())};
         }
 
         ///
-        /// \return
+        /// \return Spans over the container's elements, in order. The second
+        ///     is empty unless the elements wrap around
         [[nodiscard]]
-        std::tuple<const_pointer, const_pointer, const_pointer, const_pointer> data() const {
-            const auto segment0 = first_segment();
-            const auto segment1 = second_segment();
-            return {segment0.first, segment0.second, segment1.first, segment1.second};
+        std::array<aul::Span<const T>, 2> as_spans() const noexcept {
+            return {make_span(first_segment()), make_span(second_segment())};
+        }
+
+        ///
+        /// Only available under aul::Circular_array_mirrored_capacity. The
+        /// pointer remains valid until the next operation which invalidates
+        /// iterators.
+        ///
+        /// \return Pointer to first element. The container's elements are
+        ///     located at [data(), data() + size())
+        [[nodiscard]]
+        pointer data() noexcept {
+            static_assert(P::is_mirrored, "aul::Circular_array::data() requires a mirrored capacity policy");
+            return allocation.ptr + head_offset;
+        }
+
+        ///
+        /// Only available under aul::Circular_array_mirrored_capacity.
+        ///
+        /// \return Pointer to first element. The container's elements are
+        ///     located at [data(), data() + size())
+        [[nodiscard]]
+        const_pointer data() const noexcept {
+            static_assert(P::is_mirrored, "aul::Circular_array::data() requires a mirrored capacity policy");
+            return allocation.ptr + head_offset;
         }
-        */
 
         //=================================================
         // Misc. methods
@@ -1100,6 +1575,14 @@ namespace aul {
         ///
         size_type elem_count{};
 
+        ///
+        /// True if the allocator can resize allocations in place and elements
+        /// may be relocated by copying their bytes
+        ///
+        static constexpr bool can_grow_in_place =
+            aul::allocator_supports_reallocation_v<A> &&
+            aul::is_trivially_relocatable_v<T>;
+
         //=================================================
         // Helper functions
         //=================================================
@@ -1108,6 +1591,14 @@ namespace aul {
         /// \param n Index of object to get pointer to
         /// \return Pointer to nth element
         pointer index_to_ptr(const size_type n) const {
+            if constexpr (P::is_mirrored) {
+                return allocation.ptr + (head_offset + n);
+            }
+
+            if constexpr (P::is_power_of_two) {
+                return allocation.ptr + ((head_offset + n) & (allocation.capacity - 1));
+            }
+
             size_type index = 0;
 
             if (n < allocation.capacity - head_offset) {
@@ -1136,16 +1627,21 @@ namespace aul {
 
         ///
         /// \return True if elements wrap around after reaching end of
-        /// allocation.
+        /// allocation. Never the case under a mirrored capacity policy, as
+        /// the elements instead continue into the mirror.
         [[nodiscard]]
         bool is_segmented() const {
+            if constexpr (P::is_mirrored) {
+                return false;
+            }
+
             auto s = static_cast<difference_type>(size());
             return s > (capacity() - head_offset);
         }
 
-        /*
         ///
-        /// \return
+        /// \return Range of elements from the first element up to the end of
+        ///     the allocation or the last element, whichever comes first
         [[nodiscard]]
         std::pair<pointer, pointer> first_segment() {
             if (is_segmented()) {
@@ -1153,7 +1649,7 @@ namespace aul {
             }
             else {
                 return {allocation.ptr + head_offset, allocation.ptr + head_offset + size()};
-            };
+            }
         }
 
         [[nodiscard]]
@@ -1163,8 +1659,12 @@ namespace aul {
             }
             else {
                 return {allocation.ptr + head_offset, allocation.ptr + head_offset + size()};
-            };
+            }
         }
+
+        ///
+        /// \return Range of elements which wrapped around to the start of the
+        ///     allocation. Empty if there are none
         [[nodiscard]]
         std::pair<pointer, pointer> second_segment() {
             if (is_segmented()) {
@@ -1189,15 +1689,80 @@ namespace aul {
                 return { pointer{}, pointer{} };
             }
         }
-        */
+
+        template<class Ptr>
+        [[nodiscard]]
+        static auto make_span(const std::pair<Ptr, Ptr> segment) noexcept {
+            using element_type = std::remove_pointer_t<decltype(aul::to_raw_pointer(segment.first))>;
+            if (segment.first == segment.second) {
+                return aul::Span<element_type>{};
+            }
+            return aul::Span<element_type>{aul::to_raw_pointer(segment.first), std::size_t(segment.second - segment.first)};
+        }
+
+        ///
+        /// \param i Logical index. Must not exceed capacity()
+        /// \return Offset from start of allocation of the slot which the
+        ///     element with logical index i does or would occupy
+        [[nodiscard]]
+        size_type physical_index(const size_type i) const noexcept {
+            if constexpr (P::is_power_of_two) {
+                return (head_offset + i) & (allocation.capacity - 1);
+            }
+
+            if (i < allocation.capacity - head_offset) {
+                return head_offset + i;
+            } else {
+                return head_offset + i - allocation.capacity;
+            }
+        }
 
         //=================================================
         // Allocation methods
         //=================================================
 
+        ///
+        /// \param n Minimum number of elements
+        /// \return Capacity of allocation made to hold n elements
+        [[nodiscard]]
+        size_type allocation_size(const size_type n) const {
+            if constexpr (P::is_mirrored) {
+                const size_type granularity = A::allocation_granularity();
+                return (n + granularity - 1) / granularity * granularity;
+            } else if constexpr (P::is_power_of_two) {
+                if (n == 0) {
+                    return 0;
+                }
+
+                size_type ret = 1;
+                while (ret < n) {
+                    ret *= 2;
+                }
+                return ret;
+            } else {
+                return n;
+            }
+        }
+
+        ///
+        /// \param arr Container whose elements are to be copied or moved into
+        ///     a new allocation
+        /// \return Number of elements the new allocation should hold. Under a
+        ///     bounded capacity policy this is arr's capacity so that the size
+        ///     of the window is preserved
+        [[nodiscard]]
+        static size_type required_capacity(const Circular_array& arr) {
+            if constexpr (P::is_bounded) {
+                return arr.capacity();
+            } else {
+                return arr.size();
+            }
+        }
+
         [[nodiscard]]
-        allocation_type allocate(const size_type n) {
+        allocation_type allocate(size_type n) {
             allocation_type alloc{};
+            n = allocation_size(n);
 
             try {
                 auto allocator = get_allocator();
@@ -1212,8 +1777,9 @@ namespace aul {
         }
 
         [[nodiscard]]
-        allocation_type allocate(const size_type n, const allocation_type& hint) {
+        allocation_type allocate(size_type n, const allocation_type& hint) {
             allocation_type alloc{};
+            n = allocation_size(n);
 
             try {
                 auto allocator = get_allocator();
@@ -1233,122 +1799,158 @@ namespace aul {
             alloc = {};
         }
 
+        ///
+        /// Grows the current allocation in place through the allocator's
+        /// reallocate() method. If the elements wrapped around the end of the
+        /// old allocation, the smaller of the two segments is relocated so
+        /// that they're contiguous modulo the new capacity.
+        ///
+        /// Should only be called if can_grow_in_place is true.
+        ///
+        /// \param new_capacity Capacity to grow allocation to
+        void grow_in_place(size_type new_capacity) {
+            new_capacity = allocation_size(new_capacity);
+            const size_type old_capacity = allocation.capacity;
+            if (new_capacity <= old_capacity) {
+                return;
+            }
+
+            const bool segmented = is_segmented();
+
+            auto allocator = get_allocator();
+            allocation.ptr = allocator.reallocate(allocation.ptr, old_capacity, new_capacity);
+            allocation.capacity = new_capacity;
+
+            if (!segmented) {
+                return;
+            }
+
+            auto* data = aul::to_raw_pointer(allocation.ptr);
+
+            const size_type head_count = old_capacity - head_offset;
+            const size_type tail_count = elem_count - head_count;
+            const size_type growth = new_capacity - old_capacity;
+
+            if (tail_count <= head_count && tail_count <= growth) {
+                // Append the wrapped-around elements to the first segment
+                std::memcpy(data + old_capacity, data, tail_count * sizeof(T));
+            } else {
+                // Shift the first segment to the end of the new allocation
+                std::memmove(data + new_capacity - head_count, data + head_offset, head_count * sizeof(T));
+                head_offset = new_capacity - head_count;
+            }
+        }
+
         //=================================================
         // Element construction/destruction
         //=================================================
 
         ///
-        /// Copy-insert elements from a range under the assumption that the
-        /// container currently has enough capacity for them.
+        /// Copy-constructs the elements of arr into the uninitialized storage
+        /// beginning at dest, one contiguous segment at a time.
         ///
-        /// \tparam Iter Iterator type
-        /// \tparam Diff_type Iterator difference type
-        /// \param pos Position to insert new range of elements
-        /// \param a Iterator to beginning of range of source objects
-        /// \param b Iterator to end of range of source objects
-        /// \param d Distance from a to b
-        /// \return Iterator to first element that was newly inserted
-        template<class Iter, class Diff_type = typename std::iterator_traits<Iter>::difference_type>
-        iterator insert_within_capacity(iterator pos, Iter a, Iter b, Diff_type d) {
-            auto left  = (pos - begin());
-            auto right = (end() - pos);
+        /// \param arr Container to copy elements from
+        /// \param dest Pointer to beginning of destination range
+        void uninitialized_copy_elements(const Circular_array& arr, pointer dest) {
+            auto allocator = get_allocator();
 
-            if (left < right) {
-                return insert_within_capacity_nudge_left(pos, a, b, d);
-            } else {
-                return insert_within_capacity_nudge_right(pos, a, b, d);
+            const auto segment0 = arr.first_segment();
+            const auto segment1 = arr.second_segment();
+
+            pointer p = aul::uninitialized_copy(segment0.first, segment0.second, dest, allocator);
+            try {
+                aul::uninitialized_copy(segment1.first, segment1.second, p, allocator);
+            } catch (...) {
+                aul::destroy(dest, p, allocator);
+                throw;
             }
         }
 
         ///
-        /// Copy-insert elements from a range under the assumption that the
-        /// container currently has enough capacity for them.
+        /// Move-constructs the elements with logical indices in [i, j) into
+        /// the uninitialized storage beginning at dest, one contiguous segment
+        /// at a time. The source elements are left in a moved-from state.
         ///
-        /// All elements to the left of pos are shifted left to make space for
-        /// the new elements.
+        /// \param i Logical index of first element to move
+        /// \param j Logical index one past the last element to move
+        /// \param dest Pointer to beginning of destination range
+        /// \return Pointer to end of destination range
+        pointer uninitialized_move_elements(const size_type i, const size_type j, pointer dest) {
+            if (i == j) {
+                return dest;
+            }
+
+            auto allocator = get_allocator();
+
+            const size_type p = physical_index(i);
+            const size_type n = j - i;
+            const size_type head_count = std::min(n, allocation.capacity - p);
+
+            pointer src = allocation.ptr + p;
+            dest = aul::uninitialized_move(src, src + head_count, dest, allocator);
+            return aul::uninitialized_move(allocation.ptr, allocation.ptr + (n - head_count), dest, allocator);
+        }
+
+        ///
+        /// Copy-constructs n elements from the range beginning at a into
+        /// unused slots of the allocation, starting at the slot which logical
+        /// index i maps to and wrapping around the end of the allocation at
+        /// most once.
         ///
-        /// \tparam Iter Iterator type
-        /// \tparam Diff_type Iterator difference type
-        /// \param pos Iterator to position to insert new elements at
+        /// \tparam Iter Forward iterator type
+        /// \param i Logical index of first slot. Must not exceed capacity()
         /// \param a Iterator to beginning of source range
-        /// \param b Iterator to end of source range
-        /// \param d Distance from a to b
-        /// \return Iterator to first newly inserted element
-        template<class Iter, class Diff_type = typename std::iterator_traits<Iter>::difference_type>
-        iterator insert_within_capacity_nudge_left(iterator pos, Iter a, Iter b, Diff_type d) {
+        /// \param n Number of elements to copy
+        template<class Iter>
+        void uninitialized_copy_wrapped(const size_type i, Iter a, const size_type n) {
             auto allocator = get_allocator();
 
-            iterator w{
-                difference_type(head_offset - is_segmented() * allocation.capacity - d),
-                allocation.ptr,
-                allocation.ptr + allocation.capacity
-            };
-
-            iterator x = begin();
-            iterator y = pos + 1;
+            const size_type p = physical_index(i);
+            const size_type head_count = std::min(n, allocation.capacity - p);
 
-            // Move elements left to make room for new elements
-            iterator z = aul::uninitialized_destructive_move_elements_left(
-                w, x, y, allocator
-            );
+            pointer dest = allocation.ptr + p;
+            Iter b = std::next(a, head_count);
+            aul::uninitialized_copy(a, b, dest, allocator);
 
-            // Try to construct new elements
             try {
-                aul::uninitialized_copy_n(a, d, z, allocator);
+                aul::uninitialized_copy(b, std::next(b, n - head_count), allocation.ptr, allocator);
             } catch (...) {
-                //Move elements back to original positions
-                aul::uninitialized_destructive_move_elements_right(
-                    w, x, y, allocator
-                );
-
+                aul::destroy(dest, dest + head_count, allocator);
                 throw;
             }
-
-            head_offset -= d;
-            elem_count += d;
-
-            return z;
         }
 
         ///
         /// Copy-insert elements from a range under the assumption that the
         /// container currently has enough capacity for them.
         ///
-        /// All elements to the right of pos are shifted right to make space for
-        /// the new elements.
+        /// The new elements are constructed in the unused slots adjacent to
+        /// whichever end of the container is closer to the insertion point,
+        /// one contiguous segment at a time, and then rotated into place.
         ///
-        /// \tparam Iter Iterator type
-        /// \tparam DIff_type Iterator difference type
-        /// \param pos Iterator to position to insert new elements at
-        /// \param a Iterator to beginning of source range
-        /// \param b Iterator to end of source range
-        /// \param d Distance from a to b
-        /// \return Iterator to first newly inserted element
-        template<class Iter, class Diff_type = typename std::iterator_traits<Iter>::difference_type>
-        iterator insert_within_capacity_nudge_right(iterator pos, Iter a, Iter b, Diff_type d) {
-            auto allocator = get_allocator();
+        /// \tparam Iter Forward iterator type
+        /// \param i Index to insert new range of elements at
+        /// \param a Iterator to beginning of range of source objects
+        /// \param d Number of elements in source range
+        /// \return Iterator to first element that was newly inserted
+        template<class Iter>
+        iterator insert_within_capacity(const size_type i, Iter a, const size_type d) {
+            const size_type old_count = elem_count;
 
-            iterator w = pos;
-            iterator x = end();
-            iterator y = end() + d;
+            if (i < old_count - i) {
+                uninitialized_copy_wrapped(allocation.capacity - d, a, d);
+                decrease_head_offset(d);
+                elem_count += d;
 
-            iterator z = aul::uninitialized_destructive_move_elements_right(
-                w, x, y, allocator
-            );
-
-            try {
-                aul::uninitialized_copy_n(a, d, pos, allocator);
-            } catch (...) {
-                // Move elements back
-                aul::uninitialized_destructive_move_elements_left(w, z, y, allocator);
+                std::rotate(begin(), begin() + d, begin() + (d + i));
+            } else {
+                uninitialized_copy_wrapped(old_count, a, d);
+                elem_count += d;
 
-                throw;
+                std::rotate(begin() + i, begin() + old_count, end());
             }
 
-            head_offset -= d;
-            elem_count += d;
-
-            return pos;
+            return begin() + i;
         }
 
         ///
@@ -1357,32 +1959,33 @@ namespace aul {
         ///
         /// A new allocation is made.
         ///
-        /// \tparam Iter Iterator type
-        /// \tparam Diff_type Iterator difference type
-        /// \param pos Iterator to position to insert new elements
+        /// \tparam Iter Forward iterator type
+        /// \param i Index to insert new range of elements at
         /// \param a Iterator to beginning of source range
-        /// \param b Iterator to end of source range
-        /// \param d Distance from a to b
+        /// \param d Number of elements in source range
         /// \return Iterator to first newly inserted element
-        template<class Iter, class Diff_type = typename std::iterator_traits<Iter>::difference_type>
-        iterator insert_with_new_allocation(iterator pos, Iter a, Iter b, Diff_type d) {
+        template<class Iter>
+        iterator insert_with_new_allocation(const size_type i, Iter a, const size_type d) {
+            if constexpr (can_grow_in_place) {
+                grow_in_place(grow_size(elem_count + d));
+                return insert_within_capacity(i, a, d);
+            }
+
             auto allocator = get_allocator();
 
             auto new_capacity = grow_size(elem_count + d);
             auto new_allocation = allocate(new_capacity);
 
-            pointer p1{};
-            auto o = pos - begin();
+            pointer p = new_allocation.ptr + i;
             try {
-                auto p = new_allocation.ptr + o;
-                p1 = aul::uninitialized_copy(a, b, p, allocator);
+                aul::uninitialized_copy(a, std::next(a, d), p, allocator);
             } catch (...) {
                 deallocate(new_allocation);
                 throw;
             }
 
-            aul::uninitialized_move(begin(), pos, new_allocation, allocator);
-            aul::uninitialized_move(pos, end(), p1, allocator);
+            uninitialized_move_elements(0, i, new_allocation.ptr);
+            uninitialized_move_elements(i, elem_count, p + d);
 
             aul::destroy(begin(), end(), allocator);
             deallocate(allocation);
@@ -1392,7 +1995,7 @@ namespace aul {
             elem_count += d;
             head_offset = 0;
 
-            return {o, allocation.ptr, allocation.ptr + allocation.capacity};
+            return begin() + i;
         }
 
         ///
@@ -1417,6 +2020,12 @@ namespace aul {
 
         template<class...Args>
         void emplace_front_with_new_allocation(Args&&...args) {
+            if constexpr (can_grow_in_place) {
+                grow_in_place(grow_size(elem_count + 1));
+                emplace_front_within_capacity(std::forward<Args>(args)...);
+                return;
+            }
+
             auto new_capacity = grow_size(elem_count + 1);
             auto new_allocation = allocate(new_capacity);
 
@@ -1432,7 +2041,7 @@ namespace aul {
                 throw;
             }
 
-            aul::uninitialized_move(begin(), end(), new_allocation.ptr + 1, allocator);
+            uninitialized_move_elements(0, elem_count, new_allocation.ptr + 1);
             aul::destroy(begin(), end(), allocator);
             deallocate(allocation);
             allocation = new_allocation;
@@ -1462,6 +2071,12 @@ namespace aul {
 
         template<class...Args>
         void emplace_back_with_new_allocation(Args&&...args) {
+            if constexpr (can_grow_in_place) {
+                grow_in_place(grow_size(elem_count + 1));
+                emplace_back_within_capacity(std::forward<Args>(args)...);
+                return;
+            }
+
             size_type new_capacity = grow_size(elem_count + 1);
             allocation_type new_allocation = allocate(new_capacity);
 
@@ -1478,7 +2093,7 @@ namespace aul {
                 throw;
             }
 
-            aul::uninitialized_move(begin(), end(), new_allocation.ptr, allocator);
+            uninitialized_move_elements(0, elem_count, new_allocation.ptr);
             aul::destroy(begin(), end(), allocator);
             deallocate(allocation);
             allocation = new_allocation;
@@ -1487,6 +2102,67 @@ namespace aul {
             ++elem_count;
         }
 
+        ///
+        /// Replaces the first element with a new element which becomes the
+        /// last, under the assumption that size() == capacity(). Used by
+        /// bounded capacity policies.
+        ///
+        /// The new element is constructed before the first is destroyed so
+        /// that args may refer to it. If moving the new element into place
+        /// throws, the first element is still removed.
+        ///
+        /// \tparam Args Parameter types for new element's constructor
+        /// \param args Parameters for new element's constructor
+        template<class...Args>
+        void emplace_back_overwriting(Args&&...args) {
+            if (allocation.capacity == 0) {
+                // Element would be evicted as soon as it's added
+                return;
+            }
+
+            T value(std::forward<Args>(args)...);
+
+            auto allocator = get_allocator();
+            pointer ptr = allocation.ptr + head_offset;
+            std::allocator_traits<allocator_type>::destroy(allocator, ptr);
+
+            increment_head_offset();
+            try {
+                std::allocator_traits<allocator_type>::construct(allocator, ptr, std::move(value));
+            } catch (...) {
+                --elem_count;
+                throw;
+            }
+        }
+
+        ///
+        /// Replaces the last element with a new element which becomes the
+        /// first, under the assumption that size() == capacity(). Used by
+        /// bounded capacity policies.
+        ///
+        /// \tparam Args Parameter types for new element's constructor
+        /// \param args Parameters for new element's constructor
+        template<class...Args>
+        void emplace_front_overwriting(Args&&...args) {
+            if (allocation.capacity == 0) {
+                return;
+            }
+
+            T value(std::forward<Args>(args)...);
+
+            auto allocator = get_allocator();
+            pointer ptr = allocation.ptr + physical_index(elem_count - 1);
+            std::allocator_traits<allocator_type>::destroy(allocator, ptr);
+
+            try {
+                std::allocator_traits<allocator_type>::construct(allocator, ptr, std::move(value));
+            } catch (...) {
+                --elem_count;
+                throw;
+            }
+            decrement_head_offset();
+        }
+
         ///
         /// Emplaces a new element under the assumption that size() < capacity()
         ///
@@ -1623,11 +2299,18 @@ namespace aul {
         }
 
         iterator insert_with_new_allocation_n(iterator it, size_type n, const T& val) {
-            allocation_type new_allocation = allocate(size() + n);
+            if constexpr (can_grow_in_place) {
+                auto i = it - begin();
+                grow_in_place(grow_size(elem_count + n));
+                return insert_within_capacity_n(begin() + i, n, val);
+            }
+
+            allocation_type new_allocation = allocate(grow_size(size() + n));
 
             auto allocator = get_allocator();
 
-            pointer p = new_allocation.ptr + (it - begin());
+            const auto i = it - begin();
+            pointer p = new_allocation.ptr + i;
             try {
                 aul::uninitialized_fill_n(p, n, val, allocator);
             } catch (...) {
@@ -1635,13 +2318,17 @@ namespace aul {
                 throw;
             }
 
-            aul::uninitialized_move(begin(), it, allocation.ptr, allocator);
+            aul::uninitialized_move(begin(), it, new_allocation.ptr, allocator);
             aul::uninitialized_move(it, end(), p + n, allocator);
+
+            aul::destroy(begin(), end(), allocator);
+            deallocate(allocation);
+
+            allocation = new_allocation;
             elem_count += n;
             head_offset = 0;
 
-            allocation = new_allocation;
-            return {it - begin(), allocation.ptr, allocation.ptr + allocation.capacity};
+            return begin() + i;
         }
 
         ///
@@ -1654,6 +2341,12 @@ namespace aul {
         /// \param args Parameters for new element's constructor
         template<class...Args>
         iterator emplace_with_new_allocation(iterator it, Args&&...args) {
+            if constexpr (can_grow_in_place) {
+                auto i = it - begin();
+                grow_in_place(grow_size(elem_count + 1));
+                return emplace_within_capacity(begin() + i, std::forward<Args>(args)...);
+            }
+
             size_type new_capacity = grow_size(elem_count + 1);
             allocation_type new_allocation = allocate(new_capacity);
 
@@ -1694,6 +2387,11 @@ namespace aul {
         }
 
         void increment_head_offset() {
+            if constexpr (P::is_power_of_two) {
+                head_offset = (head_offset + 1) & (allocation.capacity - 1);
+                return;
+            }
+
             head_offset += 1;
             if (head_offset == allocation.capacity) {
                 head_offset = 0;
@@ -1701,6 +2399,11 @@ namespace aul {
         }
 
         void decrement_head_offset() {
+            if constexpr (P::is_power_of_two) {
+                head_offset = (head_offset - 1) & (allocation.capacity - 1);
+                return;
+            }
+
             if (head_offset == 0) {
                 head_offset = (allocation.capacity - 1);
             } else {
@@ -1708,24 +2411,21 @@ namespace aul {
             }
         }
 
-        void increase_head_offset(size_type d) {
-            d %= elem_count;
-
-            if (head_offset < elem_count - d) {
-                head_offset += d;
-            } else {
-                head_offset = head_offset - size() + d;
-            }
+        ///
+        /// \param d Amount to advance head offset by. Must not exceed capacity
+        void increase_head_offset(const size_type d) {
+            head_offset = physical_index(d);
         }
 
-        void decrease_head_offset(size_type d) {
-            d %= elem_count;
-
-            if (d < head_offset) {
-                head_offset -= d;
-            } else {
-                head_offset += elem_count - d;
+        ///
+        /// \param d Amount to move head offset back by. Must not exceed
+        ///     capacity
+        void decrease_head_offset(const size_type d) {
+            if (d == 0) {
+                return;
             }
+
+            head_offset = physical_index(allocation.capacity - d);
         }
 
     };
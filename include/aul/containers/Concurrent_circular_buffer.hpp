@@ -0,0 +1,701 @@
+#ifndef AUL_CONCURRENT_CIRCULAR_BUFFER_HPP
+#define AUL_CONCURRENT_CIRCULAR_BUFFER_HPP
+
+#include "Allocator_aware_base.hpp"
+#include "../memory/Allocation.hpp"
+#include "../memory/Memory.hpp"
+#include "../Bits.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace aul {
+
+    namespace impl {
+
+        ///
+        /// \param n Requested capacity
+        /// \return Smallest power of two no less than n and 2
+        template<class S>
+        [[nodiscard]]
+        S ring_capacity(const S n) {
+            if (n > (std::numeric_limits<S>::max() / 2 + 1)) {
+                throw std::length_error("aul circular buffer capacity too large");
+            }
+
+            return aul::ceil2(std::max<S>(n, 2));
+        }
+
+    }
+
+    ///
+    /// Bounded lock-free single-producer single-consumer queue.
+    ///
+    /// Elements are stored in a ring whose capacity is a power of two,
+    /// addressed like aul::Circular_array's storage but with the head and
+    /// tail kept as free-running counters, such that the position of the ith
+    /// element is a mask of head + i away. The head is only written by the
+    /// consumer and the tail only by the producer. Each sits on its own cache
+    /// line next to the owning side's cached copy of the other index, so that
+    /// the shared indices are only read when the cached value suggests the
+    /// ring is full or empty.
+    ///
+    /// At any time, at most one thread may call producer methods and at most
+    /// one thread may call consumer methods.
+    ///
+    /// \tparam T Element type
+    /// \tparam A Allocator type
+    template<class T, class A = std::allocator<T>>
+    class alignas(64) Spsc_circular_buffer : public aul::Allocator_aware_base<A> {
+        using base = aul::Allocator_aware_base<A>;
+    public:
+
+        //=================================================
+        // Type aliases
+        //=================================================
+
+        using allocator_type = A;
+
+        using value_type = T;
+
+        using size_type = typename std::allocator_traits<allocator_type>::size_type;
+        using difference_type = typename std::allocator_traits<allocator_type>::difference_type;
+
+        using pointer = typename std::allocator_traits<A>::pointer;
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+        ///
+        /// \param n Minimum number of elements the ring can hold. Rounded up
+        ///     to a power of two
+        /// \param alloc Allocator to allocate storage with
+        explicit Spsc_circular_buffer(const size_type n, const A& alloc = {}):
+            base(alloc),
+            allocation(allocate(impl::ring_capacity(n))),
+            mask(allocation.capacity - 1) {}
+
+        Spsc_circular_buffer(const Spsc_circular_buffer&) = delete;
+        Spsc_circular_buffer(Spsc_circular_buffer&&) = delete;
+
+        ///
+        /// Destroys remaining elements. Must not run concurrently with any
+        /// other method
+        ///
+        ~Spsc_circular_buffer() {
+            auto allocator = get_allocator();
+
+            const size_type t = tail.load(std::memory_order_relaxed);
+            for (size_type h = head.load(std::memory_order_relaxed); h != t; ++h) {
+                std::allocator_traits<A>::destroy(allocator, aul::to_raw_pointer(slot(h)));
+            }
+
+            std::allocator_traits<A>::deallocate(allocator, allocation.ptr, allocation.capacity);
+        }
+
+        //=================================================
+        // Assignment operators
+        //=================================================
+
+        Spsc_circular_buffer& operator=(const Spsc_circular_buffer&) = delete;
+        Spsc_circular_buffer& operator=(Spsc_circular_buffer&&) = delete;
+
+        //=================================================
+        // Producer methods
+        //=================================================
+
+        ///
+        /// Constructs an element at the back of the ring if there is space
+        ///
+        /// \param args Constructor arguments
+        /// \return True if the element was added
+        template<class...Args>
+        bool try_emplace(Args&&...args) {
+            const size_type t = tail.load(std::memory_order_relaxed);
+            if (t - cached_head == allocation.capacity) {
+                cached_head = head.load(std::memory_order_acquire);
+                if (t - cached_head == allocation.capacity) {
+                    return false;
+                }
+            }
+
+            auto allocator = get_allocator();
+            std::allocator_traits<A>::construct(allocator, aul::to_raw_pointer(slot(t)), std::forward<Args>(args)...);
+            tail.store(t + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool try_push(const T& x) {
+            return try_emplace(x);
+        }
+
+        bool try_push(T&& x) {
+            return try_emplace(std::move(x));
+        }
+
+        ///
+        /// Adds as many of the elements in [from, from + n) to the back of the
+        /// ring as fit, publishing them to the consumer at once
+        ///
+        /// \tparam It Input iterator type
+        /// \param from Iterator to first element to add
+        /// \param n Number of elements to add
+        /// \return Number of elements added
+        template<class It>
+        size_type push_n(It from, const size_type n) {
+            const size_type t = tail.load(std::memory_order_relaxed);
+            if (allocation.capacity - (t - cached_head) < n) {
+                cached_head = head.load(std::memory_order_acquire);
+            }
+
+            const size_type count = std::min(n, allocation.capacity - (t - cached_head));
+
+            auto allocator = get_allocator();
+            size_type i = 0;
+            try {
+                for (; i < count; ++i, ++from) {
+                    std::allocator_traits<A>::construct(allocator, aul::to_raw_pointer(slot(t + i)), *from);
+                }
+            } catch (...) {
+                tail.store(t + i, std::memory_order_release);
+                throw;
+            }
+
+            tail.store(t + count, std::memory_order_release);
+            return count;
+        }
+
+        //=================================================
+        // Consumer methods
+        //=================================================
+
+        ///
+        /// Moves the element at the front of the ring into out, if any
+        ///
+        /// \param out Object to move element into
+        /// \return True if an element was removed
+        bool try_pop(T& out) {
+            const size_type h = head.load(std::memory_order_relaxed);
+            if (h == cached_tail) {
+                cached_tail = tail.load(std::memory_order_acquire);
+                if (h == cached_tail) {
+                    return false;
+                }
+            }
+
+            pointer p = slot(h);
+            out = std::move(*p);
+
+            auto allocator = get_allocator();
+            std::allocator_traits<A>::destroy(allocator, aul::to_raw_pointer(p));
+            head.store(h + 1, std::memory_order_release);
+            return true;
+        }
+
+        ///
+        /// \return Element removed from the front of the ring or an empty
+        ///     optional if the ring was empty
+        [[nodiscard]]
+        std::optional<T> try_pop() {
+            const size_type h = head.load(std::memory_order_relaxed);
+            if (h == cached_tail) {
+                cached_tail = tail.load(std::memory_order_acquire);
+                if (h == cached_tail) {
+                    return std::nullopt;
+                }
+            }
+
+            pointer p = slot(h);
+            std::optional<T> ret{std::move(*p)};
+
+            auto allocator = get_allocator();
+            std::allocator_traits<A>::destroy(allocator, aul::to_raw_pointer(p));
+            head.store(h + 1, std::memory_order_release);
+            return ret;
+        }
+
+        ///
+        /// Moves up to n elements from the front of the ring into the range
+        /// beginning at to, releasing their slots to the producer at once
+        ///
+        /// \tparam Out Output iterator type
+        /// \param to Beginning of destination range
+        /// \param n Maximum number of elements to remove
+        /// \return Number of elements removed
+        template<class Out>
+        size_type pop_n(Out to, const size_type n) {
+            const size_type h = head.load(std::memory_order_relaxed);
+            if (cached_tail - h < n) {
+                cached_tail = tail.load(std::memory_order_acquire);
+            }
+
+            const size_type count = std::min(n, cached_tail - h);
+
+            auto allocator = get_allocator();
+            size_type i = 0;
+            try {
+                for (; i < count; ++i, ++to) {
+                    pointer p = slot(h + i);
+                    *to = std::move(*p);
+                    std::allocator_traits<A>::destroy(allocator, aul::to_raw_pointer(p));
+                }
+            } catch (...) {
+                head.store(h + i, std::memory_order_release);
+                throw;
+            }
+
+            head.store(h + count, std::memory_order_release);
+            return count;
+        }
+
+        //=================================================
+        // Size methods
+        //=================================================
+
+        ///
+        /// \return Number of elements in ring. Exact only when called by the
+        ///     producer or consumer
+        [[nodiscard]]
+        size_type size() const noexcept {
+            const size_type h = head.load(std::memory_order_acquire);
+            const size_type t = tail.load(std::memory_order_acquire);
+            return t - h;
+        }
+
+        [[nodiscard]]
+        bool empty() const noexcept {
+            return size() == 0;
+        }
+
+        [[nodiscard]]
+        size_type capacity() const noexcept {
+            return allocation.capacity;
+        }
+
+        //=================================================
+        // Accessors
+        //=================================================
+
+        [[nodiscard]]
+        allocator_type get_allocator() const {
+            return base::get_allocator();
+        }
+
+    private:
+
+        //=================================================
+        // Instance members
+        //=================================================
+
+        Allocation<value_type, allocator_type> allocation{};
+
+        size_type mask = 0;
+
+        ///
+        /// Count of elements ever removed. Written by consumer
+        ///
+        alignas(64) std::atomic<size_type> head{0};
+
+        ///
+        /// Consumer's last observed value of tail
+        ///
+        size_type cached_tail = 0;
+
+        ///
+        /// Count of elements ever added. Written by producer
+        ///
+        alignas(64) std::atomic<size_type> tail{0};
+
+        ///
+        /// Producer's last observed value of head
+        ///
+        size_type cached_head = 0;
+
+        //=================================================
+        // Helper functions
+        //=================================================
+
+        [[nodiscard]]
+        pointer slot(const size_type i) const noexcept {
+            return allocation.ptr + static_cast<difference_type>(i & mask);
+        }
+
+        [[nodiscard]]
+        Allocation<value_type, allocator_type> allocate(const size_type n) {
+            Allocation<value_type, allocator_type> ret{};
+
+            auto allocator = get_allocator();
+            ret.ptr = std::allocator_traits<allocator_type>::allocate(allocator, n);
+            ret.capacity = n;
+
+            return ret;
+        }
+
+    };
+
+    ///
+    /// Bounded lock-free multi-producer multi-consumer queue.
+    ///
+    /// Uses the scheme described by Dmitry Vyukov: alongside each slot of a
+    /// power-of-two sized ring is a sequence number recording which lap of
+    /// the ring the slot is ready for and whether it's currently empty or
+    /// full. Producers and consumers claim slots by advancing the shared tail
+    /// or head index respectively, after which the slots are accessed without
+    /// contention. Batch operations claim a run of consecutive slots with a
+    /// single compare-exchange.
+    ///
+    /// Elements are constructed after their slot is claimed, which cannot be
+    /// undone, so this requires T to be nothrow move constructible. Single
+    /// element pushes construct a temporary first if necessary.
+    ///
+    /// \tparam T Element type
+    /// \tparam A Allocator type
+    template<class T, class A = std::allocator<T>>
+    class alignas(64) Mpmc_circular_buffer : public aul::Allocator_aware_base<A> {
+        using base = aul::Allocator_aware_base<A>;
+
+        static_assert(std::is_nothrow_move_constructible<T>::value, "aul::Mpmc_circular_buffer requires a nothrow move constructible element type");
+
+    public:
+
+        //=================================================
+        // Type aliases
+        //=================================================
+
+        using allocator_type = A;
+
+        using value_type = T;
+
+        using size_type = typename std::allocator_traits<allocator_type>::size_type;
+        using difference_type = typename std::allocator_traits<allocator_type>::difference_type;
+
+        using pointer = typename std::allocator_traits<A>::pointer;
+
+    private:
+
+        using sequence_type = std::atomic<size_type>;
+        using sequence_allocator_type = typename std::allocator_traits<A>::template rebind_alloc<sequence_type>;
+        using sequence_pointer = typename std::allocator_traits<sequence_allocator_type>::pointer;
+
+    public:
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+        ///
+        /// \param n Minimum number of elements the ring can hold. Rounded up
+        ///     to a power of two
+        /// \param alloc Allocator to allocate storage with
+        explicit Mpmc_circular_buffer(const size_type n, const A& alloc = {}):
+            base(alloc),
+            allocation(allocate(impl::ring_capacity(n))),
+            mask(allocation.capacity - 1) {
+
+            sequence_allocator_type sequence_allocator{get_allocator()};
+            try {
+                sequences = std::allocator_traits<sequence_allocator_type>::allocate(sequence_allocator, allocation.capacity);
+            } catch (...) {
+                auto allocator = get_allocator();
+                std::allocator_traits<A>::deallocate(allocator, allocation.ptr, allocation.capacity);
+                throw;
+            }
+
+            for (size_type i = 0; i < allocation.capacity; ++i) {
+                std::allocator_traits<sequence_allocator_type>::construct(sequence_allocator, aul::to_raw_pointer(sequences + i), i);
+            }
+        }
+
+        Mpmc_circular_buffer(const Mpmc_circular_buffer&) = delete;
+        Mpmc_circular_buffer(Mpmc_circular_buffer&&) = delete;
+
+        ///
+        /// Destroys remaining elements. Must not run concurrently with any
+        /// other method
+        ///
+        ~Mpmc_circular_buffer() {
+            auto allocator = get_allocator();
+            sequence_allocator_type sequence_allocator{allocator};
+
+            const size_type t = tail.load(std::memory_order_relaxed);
+            for (size_type h = head.load(std::memory_order_relaxed); h != t; ++h) {
+                std::allocator_traits<A>::destroy(allocator, aul::to_raw_pointer(slot(h)));
+            }
+
+            for (size_type i = 0; i < allocation.capacity; ++i) {
+                std::allocator_traits<sequence_allocator_type>::destroy(sequence_allocator, aul::to_raw_pointer(sequences + i));
+            }
+
+            std::allocator_traits<sequence_allocator_type>::deallocate(sequence_allocator, sequences, allocation.capacity);
+            std::allocator_traits<A>::deallocate(allocator, allocation.ptr, allocation.capacity);
+        }
+
+        //=================================================
+        // Assignment operators
+        //=================================================
+
+        Mpmc_circular_buffer& operator=(const Mpmc_circular_buffer&) = delete;
+        Mpmc_circular_buffer& operator=(Mpmc_circular_buffer&&) = delete;
+
+        //=================================================
+        // Producer methods
+        //=================================================
+
+        ///
+        /// Constructs an element at the back of the ring if there is space
+        ///
+        /// \param args Constructor arguments
+        /// \return True if the element was added
+        template<class...Args>
+        bool try_emplace(Args&&...args) {
+            if constexpr (std::is_nothrow_constructible<T, Args&&...>::value) {
+                return push_constructed(std::forward<Args>(args)...);
+            } else {
+                T temp(std::forward<Args>(args)...);
+                return push_constructed(std::move(temp));
+            }
+        }
+
+        bool try_push(const T& x) {
+            return try_emplace(x);
+        }
+
+        bool try_push(T&& x) {
+            return try_emplace(std::move(x));
+        }
+
+        ///
+        /// Adds as many of the elements in [from, from + n) to the back of the
+        /// ring as there are consecutive free slots, claiming them at once.
+        /// Constructing T from the iterator's reference type must not throw.
+        ///
+        /// \tparam It Input iterator type
+        /// \param from Iterator to first element to add
+        /// \param n Number of elements to add
+        /// \return Number of elements added
+        template<class It>
+        size_type push_n(It from, const size_type n) {
+            static_assert(
+                std::is_nothrow_constructible<T, decltype(*from)>::value,
+                "aul::Mpmc_circular_buffer::push_n requires elements to be nothrow constructible from *from"
+            );
+
+            size_type pos = 0;
+            const size_type count = claim(tail, n, 0, pos);
+
+            auto allocator = get_allocator();
+            for (size_type i = 0; i < count; ++i, ++from) {
+                std::allocator_traits<A>::construct(allocator, aul::to_raw_pointer(slot(pos + i)), *from);
+                sequences[(pos + i) & mask].store(pos + i + 1, std::memory_order_release);
+            }
+
+            return count;
+        }
+
+        //=================================================
+        // Consumer methods
+        //=================================================
+
+        ///
+        /// Moves the element at the front of the ring into out, if any
+        ///
+        /// \param out Object to move element into
+        /// \return True if an element was removed
+        bool try_pop(T& out) noexcept {
+            static_assert(std::is_nothrow_move_assignable<T>::value, "aul::Mpmc_circular_buffer::try_pop(T&) requires a nothrow move assignable element type");
+
+            size_type pos = 0;
+            if (claim(head, 1, 1, pos) == 0) {
+                return false;
+            }
+
+            out = std::move(*slot(pos));
+            release_slot(pos);
+            return true;
+        }
+
+        ///
+        /// \return Element removed from the front of the ring or an empty
+        ///     optional if the ring was empty
+        [[nodiscard]]
+        std::optional<T> try_pop() noexcept {
+            size_type pos = 0;
+            if (claim(head, 1, 1, pos) == 0) {
+                return std::nullopt;
+            }
+
+            std::optional<T> ret{std::move(*slot(pos))};
+            release_slot(pos);
+            return ret;
+        }
+
+        ///
+        /// Moves up to n elements from the front of the ring into the range
+        /// beginning at to, claiming their slots at once. Assigning to *to
+        /// must not throw.
+        ///
+        /// \tparam Out Output iterator type
+        /// \param to Beginning of destination range
+        /// \param n Maximum number of elements to remove
+        /// \return Number of elements removed
+        template<class Out>
+        size_type pop_n(Out to, const size_type n) {
+            static_assert(
+                noexcept(*to = std::move(std::declval<T&>())),
+                "aul::Mpmc_circular_buffer::pop_n requires assignment to *to to be nothrow"
+            );
+
+            size_type pos = 0;
+            const size_type count = claim(head, n, 1, pos);
+
+            for (size_type i = 0; i < count; ++i, ++to) {
+                *to = std::move(*slot(pos + i));
+                release_slot(pos + i);
+            }
+
+            return count;
+        }
+
+        //=================================================
+        // Size methods
+        //=================================================
+
+        ///
+        /// \return Approximate number of elements in ring
+        [[nodiscard]]
+        size_type size() const noexcept {
+            const size_type h = head.load(std::memory_order_acquire);
+            const size_type t = tail.load(std::memory_order_acquire);
+            return (t - h <= allocation.capacity) ? t - h : 0;
+        }
+
+        [[nodiscard]]
+        bool empty() const noexcept {
+            return size() == 0;
+        }
+
+        [[nodiscard]]
+        size_type capacity() const noexcept {
+            return allocation.capacity;
+        }
+
+        //=================================================
+        // Accessors
+        //=================================================
+
+        [[nodiscard]]
+        allocator_type get_allocator() const {
+            return base::get_allocator();
+        }
+
+    private:
+
+        //=================================================
+        // Instance members
+        //=================================================
+
+        Allocation<value_type, allocator_type> allocation{};
+
+        sequence_pointer sequences{};
+
+        size_type mask = 0;
+
+        ///
+        /// Count of slots ever claimed by consumers
+        ///
+        alignas(64) std::atomic<size_type> head{0};
+
+        ///
+        /// Count of slots ever claimed by producers
+        ///
+        alignas(64) std::atomic<size_type> tail{0};
+
+        //=================================================
+        // Helper functions
+        //=================================================
+
+        [[nodiscard]]
+        pointer slot(const size_type i) const noexcept {
+            return allocation.ptr + static_cast<difference_type>(i & mask);
+        }
+
+        ///
+        /// Claims up to n consecutive slots by advancing index. A slot at
+        /// position p is ready for the claimant once its sequence number
+        /// equals p + lag, where lag is 0 for producers and 1 for consumers.
+        ///
+        /// \param index Head or tail
+        /// \param n Maximum number of slots to claim
+        /// \param lag Offset of ready sequence numbers from positions
+        /// \param pos Set to position of first claimed slot
+        /// \return Number of slots claimed
+        size_type claim(std::atomic<size_type>& index, const size_type n, const size_type lag, size_type& pos) noexcept {
+            pos = index.load(std::memory_order_relaxed);
+            while (n != 0) {
+                size_type count = 0;
+                while (count < n && sequences[(pos + count) & mask].load(std::memory_order_acquire) == pos + count + lag) {
+                    ++count;
+                }
+
+                if (count == 0) {
+                    const size_type seq = sequences[pos & mask].load(std::memory_order_acquire);
+                    if (static_cast<difference_type>(seq - (pos + lag)) < 0) {
+                        // Slot still holds an element from the previous lap or
+                        // hasn't been filled yet
+                        return 0;
+                    }
+
+                    pos = index.load(std::memory_order_relaxed);
+                    continue;
+                }
+
+                if (index.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed)) {
+                    return count;
+                }
+            }
+
+            return 0;
+        }
+
+        template<class...Args>
+        bool push_constructed(Args&&...args) noexcept {
+            size_type pos = 0;
+            if (claim(tail, 1, 0, pos) == 0) {
+                return false;
+            }
+
+            auto allocator = get_allocator();
+            std::allocator_traits<A>::construct(allocator, aul::to_raw_pointer(slot(pos)), std::forward<Args>(args)...);
+            sequences[pos & mask].store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        void release_slot(const size_type pos) noexcept {
+            auto allocator = get_allocator();
+            std::allocator_traits<A>::destroy(allocator, aul::to_raw_pointer(slot(pos)));
+            sequences[pos & mask].store(pos + mask + 1, std::memory_order_release);
+        }
+
+        [[nodiscard]]
+        Allocation<value_type, allocator_type> allocate(const size_type n) {
+            Allocation<value_type, allocator_type> ret{};
+
+            auto allocator = get_allocator();
+            ret.ptr = std::allocator_traits<allocator_type>::allocate(allocator, n);
+            ret.capacity = n;
+
+            return ret;
+        }
+
+    };
+
+}
+
+#endif //AUL_CONCURRENT_CIRCULAR_BUFFER_HPP
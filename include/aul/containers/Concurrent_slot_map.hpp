@@ -0,0 +1,631 @@
+#ifndef AUL_CONCURRENT_SLOT_MAP_HPP
+#define AUL_CONCURRENT_SLOT_MAP_HPP
+
+#include "Slot_map.hpp"
+#include "../memory/Epoch_domain.hpp"
+#include "../memory/Memory.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace aul {
+
+    ///
+    /// A variant of aul::Slot_map which allows any number of threads to look
+    /// up elements while a single thread inserts, erases and modifies them,
+    /// without either side taking a lock.
+    ///
+    /// Readers validate their key against an atomically loaded anchor and
+    /// copy the element out under a per-slot sequence counter, retrying if
+    /// the writer touched the slot in the meantime. Readers therefore never
+    /// observe a partially written element. When the container grows, the
+    /// previous allocation is retired and freed through an aul::Epoch_domain
+    /// once no reader can still be using it.
+    ///
+    /// Because elements are copied out while they may be concurrently
+    /// overwritten, T is required to be trivially copyable. Lookups return
+    /// copies rather than references.
+    ///
+    /// Methods under the "Writer methods" heading must only be called from
+    /// one thread at a time. Methods under "Reader methods" may be called from
+    /// any thread at any time. A read which overlaps a write may observe the
+    /// container either before or after that write.
+    ///
+    /// \tparam T Element type. Must be trivially copyable
+    /// \tparam A Allocator type
+    template<class T, class A = std::allocator<T>>
+    class Concurrent_slot_map {
+        static_assert(std::is_trivially_copyable<T>::value, "aul::Concurrent_slot_map requires a trivially copyable element type");
+
+        using layout = Slot_map_anchor_layout<std::uint64_t, 32>;
+
+        using anchor_type = std::atomic<std::uint64_t>;
+        using sequence_type = std::atomic<std::uint32_t>;
+        using anchor_index_type = typename layout::index_type;
+
+        class Allocation;
+
+    public:
+
+        //=================================================
+        // Type aliases
+        //=================================================
+
+        using value_type = T;
+        using allocator_type = A;
+
+        using size_type = typename std::allocator_traits<A>::size_type;
+        using difference_type = typename std::allocator_traits<A>::difference_type;
+
+        using key_type = Slot_map_key<typename layout::index_type, typename layout::version_type>;
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+        Concurrent_slot_map() = default;
+
+        explicit Concurrent_slot_map(const allocator_type& allocator):
+            allocator(allocator) {}
+
+        Concurrent_slot_map(const Concurrent_slot_map&) = delete;
+        Concurrent_slot_map(Concurrent_slot_map&&) = delete;
+
+        ///
+        /// No reader may be accessing the container when it is destroyed
+        ///
+        ~Concurrent_slot_map() {
+            for (const Retired& r : retired) {
+                deallocate(r.allocation);
+            }
+            deallocate(allocation);
+        }
+
+        //=================================================
+        // Assignment operators
+        //=================================================
+
+        Concurrent_slot_map& operator=(const Concurrent_slot_map&) = delete;
+        Concurrent_slot_map& operator=(Concurrent_slot_map&&) = delete;
+
+        //=================================================
+        // Reader methods
+        //=================================================
+
+        ///
+        /// \param key Key to check
+        /// \return True if key is currently mapped to an element
+        [[nodiscard]]
+        bool contains(const key_type key) const noexcept {
+            const auto guard = epochs.pin();
+            const Allocation* a = current.load(std::memory_order_seq_cst);
+            if (!a || key.index >= a->capacity) {
+                return false;
+            }
+
+            return layout::version(a->anchors[key.index].load(std::memory_order_acquire)) == key.version;
+        }
+
+        ///
+        /// Copies the element mapped to key into out. out is left unmodified
+        /// if key is not mapped to an element.
+        ///
+        /// \param key Key of element to read
+        /// \param out Object to copy element into
+        /// \return True if key was mapped to an element
+        bool load(const key_type key, T& out) const noexcept {
+            alignas(T) unsigned char buffer[sizeof(T)];
+            if (!read(key, buffer)) {
+                return false;
+            }
+
+            std::memcpy(std::addressof(out), buffer, sizeof(T));
+            return true;
+        }
+
+        ///
+        /// \param key Key of element to read
+        /// \return Copy of the element mapped to key, or an empty optional if
+        /// key is not mapped to an element
+        [[nodiscard]]
+        std::optional<T> load(const key_type key) const noexcept(std::is_nothrow_copy_constructible<T>::value) {
+            alignas(T) unsigned char buffer[sizeof(T)];
+            if (!read(key, buffer)) {
+                return std::nullopt;
+            }
+
+            return std::optional<T>{*std::launder(reinterpret_cast<const T*>(buffer))};
+        }
+
+        [[nodiscard]]
+        size_type size() const noexcept {
+            return elem_count.load(std::memory_order_acquire);
+        }
+
+        [[nodiscard]]
+        bool empty() const noexcept {
+            return size() == 0;
+        }
+
+        [[nodiscard]]
+        size_type max_size() const noexcept {
+            using element_traits = std::allocator_traits<allocator_type>;
+            const size_type index_limit = static_cast<size_type>(layout::index_mask - 1);
+            return std::min(index_limit, static_cast<size_type>(element_traits::max_size(allocator)));
+        }
+
+        //=================================================
+        // Writer methods
+        //=================================================
+
+        ///
+        /// \return Number of elements which may be held without reallocating
+        [[nodiscard]]
+        size_type capacity() const noexcept {
+            return allocation ? allocation->capacity : 0;
+        }
+
+        ///
+        /// Constructs a new element from args. Readers will see the element
+        /// fully constructed or not at all.
+        ///
+        /// \param args Arguments to forward to T's constructor
+        /// \return Key mapped to the new element
+        template<class...Args>
+        key_type emplace(Args&&...args) {
+            const size_type pos = elem_count.load(std::memory_order_relaxed);
+            if (pos == capacity()) {
+                if (pos == max_size()) {
+                    throw std::length_error("aul::Concurrent_slot_map::emplace would exceed max_size()");
+                }
+
+                grow(grow_size(pos + 1));
+            }
+
+            using element_traits = std::allocator_traits<allocator_type>;
+
+            Allocation& a = *allocation;
+
+            const std::uint32_t sequence = begin_write(a, pos);
+            try {
+                element_traits::construct(allocator, a.elements + pos, std::forward<Args>(args)...);
+            } catch (...) {
+                end_write(a, pos, sequence);
+                throw;
+            }
+            end_write(a, pos, sequence);
+
+            const anchor_index_type anchor_index = free_head;
+            anchor_type& anchor = a.anchors[anchor_index];
+            const std::uint64_t word = anchor.load(std::memory_order_relaxed);
+            const auto version = static_cast<typename layout::version_type>(layout::version(word) + 1);
+
+            free_head = static_cast<anchor_index_type>(layout::index(word));
+            a.anchor_indices[pos] = anchor_index;
+
+            // Publishing the anchor makes the element visible to readers
+            anchor.store(layout::make(pos, version), std::memory_order_release);
+            elem_count.store(pos + 1, std::memory_order_release);
+
+            reclaim_if_pending();
+
+            return key_type{anchor_index, version};
+        }
+
+        ///
+        /// Erases the element mapped to key, if any. Fills the hole with the
+        /// last element so that elements remain contiguous.
+        ///
+        /// \param key Key of element to erase
+        /// \return True if an element was erased
+        bool erase(const key_type key) noexcept {
+            if (key.index >= capacity()) {
+                return false;
+            }
+
+            Allocation& a = *allocation;
+
+            anchor_type& anchor = a.anchors[key.index];
+            const std::uint64_t word = anchor.load(std::memory_order_relaxed);
+            if (layout::version(word) != key.version) {
+                return false;
+            }
+
+            const size_type pos = layout::index(word);
+            const size_type last = elem_count.load(std::memory_order_relaxed) - 1;
+
+            // Invalidate the key before its element is overwritten
+            anchor.store(layout::make(free_head, layout::version(word) + 1), std::memory_order_release);
+            free_head = static_cast<anchor_index_type>(key.index);
+
+            if (pos != last) {
+                const std::uint32_t sequence = begin_write(a, pos);
+                std::memcpy(static_cast<void*>(a.elements + pos), a.elements + last, sizeof(T));
+                end_write(a, pos, sequence);
+
+                const anchor_index_type moved = a.anchor_indices[last];
+                a.anchor_indices[pos] = moved;
+
+                anchor_type& moved_anchor = a.anchors[moved];
+                moved_anchor.store(layout::with_index(moved_anchor.load(std::memory_order_relaxed), pos), std::memory_order_release);
+            }
+
+            elem_count.store(last, std::memory_order_release);
+
+            reclaim_if_pending();
+
+            return true;
+        }
+
+        ///
+        /// Invokes f on the element mapped to key. Readers will not observe
+        /// the element while f is modifying it.
+        ///
+        /// \param key Key of element to modify
+        /// \param f Invocable taking a T&
+        /// \return True if key was mapped to an element
+        template<class F>
+        bool modify(const key_type key, F f) {
+            if (key.index >= capacity()) {
+                return false;
+            }
+
+            Allocation& a = *allocation;
+
+            const std::uint64_t word = a.anchors[key.index].load(std::memory_order_relaxed);
+            if (layout::version(word) != key.version) {
+                return false;
+            }
+
+            const size_type pos = layout::index(word);
+
+            const std::uint32_t sequence = begin_write(a, pos);
+            try {
+                f(a.elements[pos]);
+            } catch (...) {
+                end_write(a, pos, sequence);
+                throw;
+            }
+            end_write(a, pos, sequence);
+
+            return true;
+        }
+
+        ///
+        /// Erases all elements. Invalidates all keys
+        ///
+        void clear() noexcept {
+            if (!allocation) {
+                return;
+            }
+
+            Allocation& a = *allocation;
+
+            const size_type n = elem_count.load(std::memory_order_relaxed);
+            for (size_type pos = n; pos-- > 0;) {
+                const anchor_index_type anchor_index = a.anchor_indices[pos];
+                anchor_type& anchor = a.anchors[anchor_index];
+                const std::uint64_t word = anchor.load(std::memory_order_relaxed);
+                anchor.store(layout::make(free_head, layout::version(word) + 1), std::memory_order_release);
+                free_head = anchor_index;
+            }
+
+            elem_count.store(0, std::memory_order_release);
+        }
+
+        ///
+        /// \param n Minimum capacity to reserve
+        void reserve(const size_type n) {
+            if (n <= capacity()) {
+                return;
+            }
+
+            if (n > max_size()) {
+                throw std::length_error("aul::Concurrent_slot_map::reserve() cannot reserve more than max_size()");
+            }
+
+            grow(n);
+        }
+
+        ///
+        /// Frees allocations retired by earlier growth which readers can no
+        /// longer reference. This is also attempted on every insertion and
+        /// erasure while any are pending.
+        ///
+        /// \return Number of retired allocations not yet freed
+        size_type reclaim() noexcept {
+            epochs.try_advance();
+
+            auto it = std::remove_if(retired.begin(), retired.end(), [&] (const Retired& r) {
+                if (!epochs.is_safe(r.epoch)) {
+                    return false;
+                }
+
+                deallocate(r.allocation);
+                return true;
+            });
+            retired.erase(it, retired.end());
+
+            return retired.size();
+        }
+
+        //=================================================
+        // Accessors
+        //=================================================
+
+        [[nodiscard]]
+        allocator_type get_allocator() const noexcept {
+            return allocator;
+        }
+
+    private:
+
+        //=================================================
+        // Helper classes
+        //=================================================
+
+        struct Retired {
+            Allocation* allocation;
+            std::uint64_t epoch;
+        };
+
+        //=================================================
+        // Static members
+        //=================================================
+
+        static constexpr anchor_index_type null_index = static_cast<anchor_index_type>(layout::index_mask);
+
+        //=================================================
+        // Instance members
+        //=================================================
+
+        allocator_type allocator{};
+
+        ///
+        /// Allocation in use by the writer. Mirrors current
+        ///
+        Allocation* allocation = nullptr;
+
+        ///
+        /// Allocation readers should use
+        ///
+        std::atomic<Allocation*> current{nullptr};
+
+        std::atomic<size_type> elem_count{0};
+
+        ///
+        /// Index of first anchor in the free list. Free anchors hold the index
+        /// of the next free anchor. Free anchors have even versions and live
+        /// anchors odd versions, so a reader never mistakes a link in the free
+        /// list for an element position.
+        ///
+        anchor_index_type free_head = null_index;
+
+        std::vector<Retired> retired{};
+
+        mutable Epoch_domain epochs{};
+
+        //=================================================
+        // Helper functions
+        //=================================================
+
+        ///
+        /// Copies the element mapped to key into out as raw bytes
+        ///
+        /// \param key Key of element to read
+        /// \param out Buffer of sizeof(T) bytes
+        /// \return True if key was mapped to an element
+        bool read(const key_type key, unsigned char* out) const noexcept {
+            const auto guard = epochs.pin();
+            const Allocation* a = current.load(std::memory_order_seq_cst);
+            if (!a || key.index >= a->capacity) {
+                return false;
+            }
+
+            const anchor_type& anchor = a->anchors[key.index];
+            while (true) {
+                const std::uint64_t word = anchor.load(std::memory_order_acquire);
+                if (layout::version(word) != key.version) {
+                    return false;
+                }
+
+                const size_type pos = layout::index(word);
+                const sequence_type& sequence = a->sequences[pos];
+
+                const std::uint32_t before = sequence.load(std::memory_order_acquire);
+                if (before & 1) {
+                    // Writer is in the middle of updating this slot
+                    continue;
+                }
+
+                std::memcpy(out, static_cast<const void*>(a->elements + pos), sizeof(T));
+                std::atomic_thread_fence(std::memory_order_acquire);
+
+                const bool is_untouched = sequence.load(std::memory_order_relaxed) == before;
+                if (is_untouched && anchor.load(std::memory_order_relaxed) == word) {
+                    return true;
+                }
+            }
+        }
+
+        ///
+        /// Marks the element at pos as being written
+        ///
+        /// \return Value to pass to end_write()
+        static std::uint32_t begin_write(Allocation& a, const size_type pos) noexcept {
+            sequence_type& sequence = a.sequences[pos];
+            const std::uint32_t s = sequence.load(std::memory_order_relaxed);
+            sequence.store(s + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            return s;
+        }
+
+        static void end_write(Allocation& a, const size_type pos, const std::uint32_t s) noexcept {
+            a.sequences[pos].store(s + 2, std::memory_order_release);
+        }
+
+        size_type grow_size(const size_type n) const noexcept {
+            const size_type double_size = (max_size() / 2) < capacity() ? max_size() : 2 * capacity();
+            return std::max(n, double_size);
+        }
+
+        ///
+        /// Moves the contents of the container into a new allocation of n
+        /// elements, publishes it to readers and retires the old one
+        ///
+        /// \param n New capacity. Must be greater than current capacity
+        void grow(const size_type n) {
+            retired.reserve(retired.size() + 1);
+
+            Allocation* fresh = allocate(n);
+
+            const size_type old_capacity = capacity();
+            if (allocation) {
+                const size_type count = elem_count.load(std::memory_order_relaxed);
+                std::memcpy(static_cast<void*>(fresh->elements), allocation->elements, count * sizeof(T));
+                std::copy_n(allocation->anchor_indices, count, fresh->anchor_indices);
+
+                for (size_type i = 0; i < old_capacity; ++i) {
+                    const std::uint64_t word = allocation->anchors[i].load(std::memory_order_relaxed);
+                    fresh->anchors[i].store(word, std::memory_order_relaxed);
+                }
+            }
+
+            // Prepend the new anchors to the free list
+            for (size_type i = old_capacity; i < n; ++i) {
+                const anchor_index_type next = (i + 1 == n) ? free_head : static_cast<anchor_index_type>(i + 1);
+                fresh->anchors[i].store(layout::make(next, 0), std::memory_order_relaxed);
+            }
+            free_head = static_cast<anchor_index_type>(old_capacity);
+
+            Allocation* old = allocation;
+            allocation = fresh;
+            current.store(fresh, std::memory_order_seq_cst);
+
+            if (old) {
+                retired.push_back(Retired{old, epochs.epoch()});
+            }
+
+            reclaim();
+        }
+
+        void reclaim_if_pending() noexcept {
+            if (!retired.empty()) {
+                reclaim();
+            }
+        }
+
+        ///
+        /// \param n Capacity of new allocation
+        /// \return Pointer to new allocation with zeroed sequence counters.
+        /// Anchors, anchor indices and elements are uninitialized
+        Allocation* allocate(const size_type n) {
+            using allocation_allocator = typename std::allocator_traits<A>::template rebind_alloc<Allocation>;
+            using anchor_allocator = typename std::allocator_traits<A>::template rebind_alloc<anchor_type>;
+            using sequence_allocator = typename std::allocator_traits<A>::template rebind_alloc<sequence_type>;
+            using anchor_index_allocator = typename std::allocator_traits<A>::template rebind_alloc<anchor_index_type>;
+
+            allocation_allocator a0{allocator};
+            anchor_allocator a1{allocator};
+            sequence_allocator a2{allocator};
+            anchor_index_allocator a3{allocator};
+
+            Allocation* ret = aul::to_raw_pointer(a0.allocate(1));
+            ::new (static_cast<void*>(ret)) Allocation{};
+            ret->capacity = n;
+
+            try {
+                ret->elements = aul::to_raw_pointer(allocator.allocate(n));
+                ret->anchors = aul::to_raw_pointer(a1.allocate(n));
+                ret->sequences = aul::to_raw_pointer(a2.allocate(n));
+                ret->anchor_indices = aul::to_raw_pointer(a3.allocate(n));
+            } catch (...) {
+                deallocate(ret);
+                throw;
+            }
+
+            for (size_type i = 0; i < n; ++i) {
+                ::new (static_cast<void*>(ret->anchors + i)) anchor_type{0};
+                ::new (static_cast<void*>(ret->sequences + i)) sequence_type{0};
+            }
+
+            return ret;
+        }
+
+        void deallocate(Allocation* a) noexcept {
+            if (!a) {
+                return;
+            }
+
+            using allocation_allocator = typename std::allocator_traits<A>::template rebind_alloc<Allocation>;
+            using anchor_allocator = typename std::allocator_traits<A>::template rebind_alloc<anchor_type>;
+            using sequence_allocator = typename std::allocator_traits<A>::template rebind_alloc<sequence_type>;
+            using anchor_index_allocator = typename std::allocator_traits<A>::template rebind_alloc<anchor_index_type>;
+
+            allocation_allocator a0{allocator};
+            anchor_allocator a1{allocator};
+            sequence_allocator a2{allocator};
+            anchor_index_allocator a3{allocator};
+
+            if (a->anchor_indices) {
+                a3.deallocate(a->anchor_indices, a->capacity);
+            }
+            if (a->sequences) {
+                a2.deallocate(a->sequences, a->capacity);
+            }
+            if (a->anchors) {
+                a1.deallocate(a->anchors, a->capacity);
+            }
+            if (a->elements) {
+                allocator.deallocate(a->elements, a->capacity);
+            }
+
+            a->~Allocation();
+            a0.deallocate(a, 1);
+        }
+
+    };
+
+    template<class T, class A>
+    class Concurrent_slot_map<T, A>::Allocation {
+    public:
+
+        //=============================================
+        // Instance variables
+        //=============================================
+
+        ///
+        /// Packed position and version of each key's element. Live anchors
+        /// have odd versions
+        ///
+        anchor_type* anchors = nullptr;
+
+        ///
+        /// Sequence counter for each element position. Odd while the writer
+        /// is modifying the element
+        ///
+        sequence_type* sequences = nullptr;
+
+        ///
+        /// Index of the anchor mapped to each element. Only read by the writer
+        ///
+        anchor_index_type* anchor_indices = nullptr;
+
+        T* elements = nullptr;
+
+        size_type capacity = 0;
+
+    };
+
+}
+
+#endif //AUL_CONCURRENT_SLOT_MAP_HPP
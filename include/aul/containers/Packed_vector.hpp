@@ -8,6 +8,7 @@
 #include "../Algorithms.hpp"
 
 #include <memory>
+#include <type_traits>
 
 namespace aul {
 
@@ -44,9 +45,17 @@ namespace aul {
     private:
 
         using base = Allocator_aware_base<A>;
-        using allocation_type = aul::Allocation<T, A>;
         using alloc_traits = std::allocator_traits<A>;
 
+        struct allocation_type : public aul::Allocation<T, A> {
+            ///
+            /// Number of objects the allocation was requested for. Only
+            /// differs from capacity when resize_in_place() could not shrink
+            /// an allocation back down after a failed growth
+            ///
+            size_type allocated = 0;
+        };
+
     public:
 
         //=================================================
@@ -63,7 +72,7 @@ namespace aul {
             allocation(allocate(count)) {
 
             auto allocator = get_allocator();
-            aul::uninitialized_fill_n(allocation.data, count, value, allocator);
+            aul::uninitialized_fill_n(allocation.ptr, count, value, allocator);
         }
 
         explicit Packed_vector(size_type count, const allocator_type& alloc = {}):
@@ -223,11 +232,19 @@ namespace aul {
         }
 
         void clear() noexcept {
-            aul::destroy_n(allocation.ptr, allocation.capacity);
+            auto allocator = get_allocator();
+            aul::destroy_n(allocation.ptr, allocation.capacity, allocator);
             deallocate(allocation);
         }
 
         void resize(size_type count) {
+            if constexpr (can_reallocate_in_place) {
+                resize_in_place(count, [&] (pointer begin, pointer end, allocator_type& allocator) {
+                    aul::default_construct(begin, end, allocator);
+                });
+                return;
+            }
+
             if (size() < count) {
                 auto new_allocation = allocate(count);
 
@@ -238,12 +255,13 @@ namespace aul {
                 try {
                     aul::default_construct(new_allocation.ptr + allocation.capacity, new_allocation.ptr + count, allocator);
                 } catch (...) {
-                    std::move(new_allocation.ptr, new_allocation.ptr + allocation.capacity);
-                    aul::destroy_n(new_allocation.ptr, new_allocation.capacity, allocator);
+                    std::move(new_allocation.ptr, new_allocation.ptr + allocation.capacity, allocation.ptr);
+                    aul::destroy_n(new_allocation.ptr, allocation.capacity, allocator);
                     deallocate(new_allocation);
                     throw;
                 }
 
+                aul::destroy_n(allocation.ptr, allocation.capacity, allocator);
                 deallocate(allocation);
                 allocation = std::move(new_allocation);
             }
@@ -254,12 +272,20 @@ namespace aul {
                 auto allocator = get_allocator();
                 aul::uninitialized_move_n(allocation.ptr, count, new_allocation.ptr, allocator);
 
+                aul::destroy_n(allocation.ptr, allocation.capacity, allocator);
                 deallocate(allocation);
                 allocation = std::move(new_allocation);
             }
         }
 
         void resize(size_type count, const value_type& value) {
+            if constexpr (can_reallocate_in_place) {
+                resize_in_place(count, [&] (pointer begin, pointer end, allocator_type& allocator) {
+                    aul::uninitialized_fill(begin, end, value, allocator);
+                });
+                return;
+            }
+
             if (size() < count) {
                 auto new_allocation = allocate(count);
 
@@ -270,12 +296,13 @@ namespace aul {
                 try {
                     aul::uninitialized_fill(new_allocation.ptr + allocation.capacity, new_allocation.ptr + count, value, allocator);
                 } catch (...) {
-                    std::move(new_allocation.ptr, new_allocation.ptr + allocation.capacity);
-                    aul::destroy_n(new_allocation.ptr, new_allocation.capacity, allocator);
+                    std::move(new_allocation.ptr, new_allocation.ptr + allocation.capacity, allocation.ptr);
+                    aul::destroy_n(new_allocation.ptr, allocation.capacity, allocator);
                     deallocate(new_allocation);
                     throw;
                 }
 
+                aul::destroy_n(allocation.ptr, allocation.capacity, allocator);
                 deallocate(allocation);
                 allocation = std::move(new_allocation);
             }
@@ -286,6 +313,7 @@ namespace aul {
                 auto allocator = get_allocator();
                 aul::uninitialized_move_n(allocation.ptr, count, new_allocation.ptr, allocator);
 
+                aul::destroy_n(allocation.ptr, allocation.capacity, allocator);
                 deallocate(allocation);
                 allocation = std::move(new_allocation);
             }
@@ -351,7 +379,7 @@ namespace aul {
             constexpr size_type size_type_max = std::numeric_limits<size_type>::max();
 
             auto allocator = get_allocator();
-            constexpr size_type alloc_max = alloc_traits::max_size(allocator);
+            const size_type alloc_max = alloc_traits::max_size(allocator);
             return std::min(size_type_max, alloc_max);
         }
 
@@ -407,13 +435,61 @@ namespace aul {
 
         allocation_type allocation{};
 
+        ///
+        /// True if the allocator can resize allocations without the elements
+        /// having to be moved individually
+        ///
+        static constexpr bool can_reallocate_in_place =
+            aul::allocator_supports_reallocation_v<A> &&
+            aul::is_trivially_relocatable_v<T>;
+
         //=================================================
         // Helper functions
         //=================================================
 
+        ///
+        /// Resizes the container by having the allocator resize the current
+        /// allocation in place.
+        ///
+        /// \tparam F Callable type
+        /// \param count New size of container
+        /// \param construct Callable used to construct new elements in a
+        ///     range of pointers if the container grows
+        template<class F>
+        void resize_in_place(const size_type count, F construct) {
+            auto allocator = get_allocator();
+            const size_type old_count = allocation.capacity;
+
+            if (count < old_count) {
+                aul::destroy_n(allocation.ptr + count, old_count - count, allocator);
+            }
+
+            if (count != old_count) {
+                allocation.ptr = allocator.reallocate(allocation.ptr, allocation.allocated, count);
+                allocation.capacity = count;
+                allocation.allocated = count;
+            }
+
+            if (old_count < count) {
+                try {
+                    construct(allocation.ptr + old_count, allocation.ptr + count, allocator);
+                } catch (...) {
+                    // If the shrink fails too, the larger allocation is kept
+                    // so that the original exception is the one propagated
+                    // and no unconstructed elements are ever destroyed
+                    try {
+                        allocation.ptr = allocator.reallocate(allocation.ptr, count, old_count);
+                        allocation.allocated = old_count;
+                    } catch (...) {}
+                    allocation.capacity = old_count;
+                    throw;
+                }
+            }
+        }
+
         void deallocate(allocation_type& a) {
             auto allocator = get_allocator();
-            alloc_traits::deallocate(allocator, allocation.ptr, allocation.capacity);
+            alloc_traits::deallocate(allocator, a.ptr, a.allocated);
             a = {};
         }
 
@@ -422,12 +498,9 @@ namespace aul {
 
             allocator_type allocator = get_allocator();
 
-            try {
-                allocation.ptr = alloc_traits::allocate(allocator, n);
-            } catch (...) {
-                alloc_traits::deallocate(allocator, allocation.ptr, allocation.capacity);
-                throw;
-            }
+            ret.ptr = alloc_traits::allocate(allocator, n);
+            ret.capacity = n;
+            ret.allocated = n;
 
             return ret;
         }
@@ -0,0 +1,837 @@
+#ifndef AUL_PAGED_SLOT_MAP_HPP
+#define AUL_PAGED_SLOT_MAP_HPP
+
+#include "Slot_map.hpp"
+#include "../memory/Memory.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace aul {
+
+    ///
+    /// Class meant to be used as aul::Paged_slot_map::iterator.
+    ///
+    /// \tparam T Element type. May be const qualified
+    /// \tparam Block_size Number of elements per block
+    template<class T, std::size_t Block_size>
+    class Paged_slot_map_iterator {
+    public:
+
+        //=================================================
+        // Type aliases
+        //=================================================
+
+        using value_type = std::remove_const_t<T>;
+        using difference_type = std::ptrdiff_t;
+        using reference = T&;
+        using pointer = T*;
+        using iterator_category = std::random_access_iterator_tag;
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+        Paged_slot_map_iterator(T* const* blocks, const difference_type position):
+            blocks(blocks),
+            position(position) {}
+
+        Paged_slot_map_iterator() = default;
+        Paged_slot_map_iterator(const Paged_slot_map_iterator&) = default;
+        Paged_slot_map_iterator(Paged_slot_map_iterator&&) noexcept = default;
+        ~Paged_slot_map_iterator() = default;
+
+        //=================================================
+        // Assignment operators
+        //=================================================
+
+        Paged_slot_map_iterator& operator=(const Paged_slot_map_iterator&) = default;
+        Paged_slot_map_iterator& operator=(Paged_slot_map_iterator&&) noexcept = default;
+
+        //=================================================
+        // Comparison operators
+        //=================================================
+
+        [[nodiscard]]
+        bool operator==(const Paged_slot_map_iterator it) const {
+            return position == it.position;
+        }
+
+        [[nodiscard]]
+        bool operator!=(const Paged_slot_map_iterator it) const {
+            return position != it.position;
+        }
+
+        [[nodiscard]]
+        bool operator<(const Paged_slot_map_iterator it) const {
+            return position < it.position;
+        }
+
+        [[nodiscard]]
+        bool operator>(const Paged_slot_map_iterator it) const {
+            return position > it.position;
+        }
+
+        [[nodiscard]]
+        bool operator<=(const Paged_slot_map_iterator it) const {
+            return position <= it.position;
+        }
+
+        [[nodiscard]]
+        bool operator>=(const Paged_slot_map_iterator it) const {
+            return position >= it.position;
+        }
+
+        //=================================================
+        // Increment/Decrement operators
+        //=================================================
+
+        Paged_slot_map_iterator& operator++() {
+            ++position;
+            return *this;
+        }
+
+        Paged_slot_map_iterator operator++(int) {
+            auto temp = *this;
+            ++position;
+            return temp;
+        }
+
+        Paged_slot_map_iterator& operator--() {
+            --position;
+            return *this;
+        }
+
+        Paged_slot_map_iterator operator--(int) {
+            auto temp = *this;
+            --position;
+            return temp;
+        }
+
+        //=================================================
+        // Arithmetic operators
+        //=================================================
+
+        [[nodiscard]]
+        Paged_slot_map_iterator operator+(const difference_type x) const {
+            return Paged_slot_map_iterator{blocks, position + x};
+        }
+
+        [[nodiscard]]
+        Paged_slot_map_iterator operator-(const difference_type x) const {
+            return Paged_slot_map_iterator{blocks, position - x};
+        }
+
+        [[nodiscard]]
+        friend Paged_slot_map_iterator operator+(const difference_type x, const Paged_slot_map_iterator it) {
+            return it + x;
+        }
+
+        [[nodiscard]]
+        difference_type operator-(const Paged_slot_map_iterator it) const {
+            return position - it.position;
+        }
+
+        //=================================================
+        // Arithmetic assignment operators
+        //=================================================
+
+        Paged_slot_map_iterator& operator+=(const difference_type x) {
+            position += x;
+            return *this;
+        }
+
+        Paged_slot_map_iterator& operator-=(const difference_type x) {
+            position -= x;
+            return *this;
+        }
+
+        //=================================================
+        // Dereference operators
+        //=================================================
+
+        [[nodiscard]]
+        reference operator*() const {
+            return *operator->();
+        }
+
+        [[nodiscard]]
+        reference operator[](const difference_type x) const {
+            return *(*this + x);
+        }
+
+        [[nodiscard]]
+        pointer operator->() const {
+            const auto p = static_cast<std::size_t>(position);
+            return blocks[p / Block_size] + p % Block_size;
+        }
+
+        //=================================================
+        // Conversion operators
+        //=================================================
+
+        ///
+        /// Implicit conversion from iterator to non-const to iterator to
+        /// const
+        ///
+        [[nodiscard]]
+        operator Paged_slot_map_iterator<const T, Block_size>() const {
+            return {blocks, position};
+        }
+
+    private:
+
+        //=================================================
+        // Instance members
+        //=================================================
+
+        T* const* blocks = nullptr;
+        difference_type position = 0;
+
+    };
+
+    ///
+    /// A variant of aul::Slot_map which stores its elements in fixed-size
+    /// blocks reached through a block table rather than in a single array.
+    ///
+    /// Growing the container only allocates new blocks, so existing elements
+    /// are never relocated by insertions or calls to reserve(). Pointers and
+    /// references to elements remain valid until the element is erased or the
+    /// last element is moved into its place by an erasure, and the worst-case
+    /// cost of an insertion is independent of the container's size, save for
+    /// the occasional growth of the block table itself, which holds only one
+    /// pointer per block.
+    ///
+    /// Elements are kept densely packed, as in aul::Slot_map, so erasing an
+    /// element moves the last element into the hole. Iteration visits the
+    /// blocks in order but is not over a single contiguous array, so data()
+    /// is not provided.
+    ///
+    /// The anchors and the reverse mapping are paged alongside the elements
+    /// and are never relocated either.
+    ///
+    /// \tparam T Element type
+    /// \tparam A Allocator type
+    /// \tparam L Anchor layout. See aul::Slot_map_anchor_layout
+    /// \tparam Block_size Number of elements per block. Must be a power of two
+    template<class T, class A = std::allocator<T>, class L = Slot_map_anchor_layout<>, std::size_t Block_size = 4096>
+    class Paged_slot_map {
+        static_assert(Block_size != 0 && (Block_size & (Block_size - 1)) == 0, "Block size must be a power of two");
+
+        //=================================================
+        // Helper classes
+        //=================================================
+
+        struct Metadata_block;
+
+        //=================================================
+        // Type aliases
+        //=================================================
+
+    public:
+
+        using allocator_type = A;
+
+        using size_type = typename std::allocator_traits<A>::size_type;
+        using difference_type = typename std::allocator_traits<A>::difference_type;
+
+        using value_type = T;
+        using key_type = Slot_map_key<typename L::index_type, typename L::version_type>;
+
+        using reference = T&;
+        using const_reference = const T&;
+
+        using iterator = Paged_slot_map_iterator<T, Block_size>;
+        using const_iterator = Paged_slot_map_iterator<const T, Block_size>;
+
+        using anchor_layout = L;
+
+        static constexpr size_type block_size = Block_size;
+
+    private:
+
+        using allocator_traits = std::allocator_traits<allocator_type>;
+
+        using anchor_type = typename L::word_type;
+        using anchor_index_type = typename L::index_type;
+
+        using metadata_allocator_type = typename std::allocator_traits<A>::template rebind_alloc<Metadata_block>;
+        using metadata_allocator_traits = std::allocator_traits<metadata_allocator_type>;
+
+        using element_table_type = std::vector<T*, typename std::allocator_traits<A>::template rebind_alloc<T*>>;
+        using metadata_table_type = std::vector<Metadata_block*, typename std::allocator_traits<A>::template rebind_alloc<Metadata_block*>>;
+
+        ///
+        /// Value of an anchor index which does not refer to any anchor. As
+        /// max_size() is below it, no anchor or element has this index
+        ///
+        static constexpr anchor_index_type null_index = static_cast<anchor_index_type>(L::index_mask);
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+    public:
+
+        Paged_slot_map() = default;
+
+        ///
+        /// \param alloc Allocator to copy-construct internal allocators from
+        ///
+        explicit Paged_slot_map(const allocator_type& alloc):
+            allocator(alloc),
+            element_blocks(alloc),
+            metadata_blocks(alloc) {}
+
+        ///
+        /// \param src Source object
+        ///
+        Paged_slot_map(const Paged_slot_map& src):
+            Paged_slot_map(allocator_traits::select_on_container_copy_construction(src.allocator)) {
+
+            copy_contents(src);
+        }
+
+        ///
+        /// \param src Source object
+        ///
+        Paged_slot_map(Paged_slot_map&& src) noexcept:
+            allocator(std::move(src.allocator)),
+            element_blocks(std::move(src.element_blocks)),
+            metadata_blocks(std::move(src.metadata_blocks)),
+            elem_count(std::exchange(src.elem_count, 0)),
+            free_anchor(std::exchange(src.free_anchor, null_index)) {
+
+            src.element_blocks.clear();
+            src.metadata_blocks.clear();
+        }
+
+        ///
+        /// Destructor
+        ///
+        ~Paged_slot_map() {
+            clear();
+        }
+
+        //=================================================
+        // Assignment operators
+        //=================================================
+
+        Paged_slot_map& operator=(const Paged_slot_map& src) {
+            if (this == &src) {
+                return *this;
+            }
+
+            clear();
+
+            if constexpr (allocator_traits::propagate_on_container_copy_assignment::value) {
+                allocator = src.allocator;
+            }
+
+            copy_contents(src);
+            return *this;
+        }
+
+        Paged_slot_map& operator=(Paged_slot_map&& src) noexcept(aul::is_noexcept_movable_v<A>) {
+            if (this == &src) {
+                return *this;
+            }
+
+            clear();
+
+            if constexpr (allocator_traits::propagate_on_container_move_assignment::value) {
+                allocator = std::move(src.allocator);
+            }
+
+            element_blocks.swap(src.element_blocks);
+            metadata_blocks.swap(src.metadata_blocks);
+            elem_count = std::exchange(src.elem_count, 0);
+            free_anchor = std::exchange(src.free_anchor, null_index);
+
+            return *this;
+        }
+
+        //=================================================
+        // Modifier methods
+        //=================================================
+
+        ///
+        /// Destructs current contents and releases all blocks. Reduces
+        /// capacity to 0. All keys are invalidated and may compare equal to
+        /// keys issued afterwards.
+        ///
+        void clear() noexcept {
+            for (size_type pos = 0; pos < elem_count; ++pos) {
+                allocator_traits::destroy(allocator, element_at(pos));
+            }
+
+            metadata_allocator_type metadata_allocator{allocator};
+            for (size_type i = 0; i < element_blocks.size(); ++i) {
+                allocator_traits::deallocate(allocator, element_blocks[i], Block_size);
+                metadata_allocator_traits::deallocate(metadata_allocator, metadata_blocks[i], 1);
+            }
+
+            element_blocks.clear();
+            metadata_blocks.clear();
+
+            elem_count = 0;
+            free_anchor = null_index;
+        }
+
+        ///
+        /// \param src Target object to swap with
+        ///
+        void swap(Paged_slot_map& src) noexcept(aul::is_noexcept_swappable_v<A>) {
+            if constexpr (allocator_traits::propagate_on_container_swap::value) {
+                std::swap(allocator, src.allocator);
+            }
+
+            element_blocks.swap(src.element_blocks);
+            metadata_blocks.swap(src.metadata_blocks);
+            std::swap(elem_count, src.elem_count);
+            std::swap(free_anchor, src.free_anchor);
+        }
+
+        friend void swap(Paged_slot_map& l, Paged_slot_map& r) noexcept(aul::is_noexcept_swappable_v<A>) {
+            l.swap(r);
+        }
+
+        //=================================================
+        // Element access operators/methods
+        //=================================================
+
+        ///
+        /// Undefined behavior if key is not valid
+        ///
+        /// \param key Key mapped to desired element
+        /// \return Reference to element mapped to key
+        [[nodiscard]]
+        T& operator[](const key_type key) {
+            return *element_at(L::index(anchor(key.index)));
+        }
+
+        ///
+        /// Undefined behavior if key is not valid
+        ///
+        /// \param key Key mapped to desired element
+        /// \return Reference to element mapped to key
+        [[nodiscard]]
+        const T& operator[](const key_type key) const {
+            return *element_at(L::index(anchor(key.index)));
+        }
+
+        /// \param key Key mapped to desired element
+        /// \return Reference to element mapped to key
+        [[nodiscard]]
+        T& at(const key_type key) {
+            if (!contains(key)) {
+                throw std::runtime_error("aul::Paged_slot_map::at() called with invalid key");
+            }
+
+            return operator[](key);
+        }
+
+        /// \param key Key mapped to desired element
+        /// \return Reference to element mapped to key
+        [[nodiscard]]
+        const T& at(const key_type key) const {
+            if (!contains(key)) {
+                throw std::runtime_error("aul::Paged_slot_map::at() called with invalid key");
+            }
+
+            return operator[](key);
+        }
+
+        //=================================================
+        // Element addition
+        //=================================================
+
+        ///
+        /// Constructs a new element at the end of the container. Allocates a
+        /// new block if the last block is full. No existing element is moved.
+        ///
+        /// \tparam Args Argument types for constructor call
+        /// \param args Constructor arguments for construction of new element
+        /// \return Key mapped to new element
+        template<class... Args>
+        key_type emplace(Args&&... args) {
+            if (elem_count == max_size()) {
+                throw std::length_error("aul::Paged_slot_map grew beyond max size");
+            }
+
+            if (elem_count == capacity()) {
+                add_block();
+            }
+
+            allocator_traits::construct(allocator, element_at(elem_count), std::forward<Args>(args)...);
+            consume_anchor(elem_count);
+
+            return key_at(elem_count++);
+        }
+
+        key_type insert(const T& v) {
+            return emplace(v);
+        }
+
+        key_type insert(T&& v) {
+            return emplace(std::move(v));
+        }
+
+        //=================================================
+        // Element removal
+        //=================================================
+
+        ///
+        /// \param key Key mapping to element to erase
+        /// \return True if an element was removed
+        bool erase(const key_type key) noexcept {
+            if (!contains(key)) {
+                return false;
+            }
+
+            erase_at(L::index(anchor(key.index)));
+            return true;
+        }
+
+        ///
+        /// \param it Valid iterator to element to erase
+        ///
+        void erase(const const_iterator it) noexcept {
+            erase_at(static_cast<size_type>(it - cbegin()));
+        }
+
+        //=================================================
+        // Iterator methods
+        //=================================================
+
+        [[nodiscard]]
+        iterator begin() noexcept {
+            return iterator{element_blocks.data(), 0};
+        }
+
+        [[nodiscard]]
+        const_iterator begin() const noexcept {
+            return const_iterator{element_blocks.data(), 0};
+        }
+
+        [[nodiscard]]
+        const_iterator cbegin() const noexcept {
+            return begin();
+        }
+
+        [[nodiscard]]
+        iterator end() noexcept {
+            return iterator{element_blocks.data(), static_cast<difference_type>(elem_count)};
+        }
+
+        [[nodiscard]]
+        const_iterator end() const noexcept {
+            return const_iterator{element_blocks.data(), static_cast<difference_type>(elem_count)};
+        }
+
+        [[nodiscard]]
+        const_iterator cend() const noexcept {
+            return end();
+        }
+
+        //=================================================
+        // Size & capacity methods
+        //=================================================
+
+        [[nodiscard]]
+        bool empty() const noexcept {
+            return elem_count == 0;
+        }
+
+        [[nodiscard]]
+        size_type size() const noexcept {
+            return elem_count;
+        }
+
+        ///
+        /// \return Number of elements which may be held without allocating
+        /// another block
+        [[nodiscard]]
+        size_type capacity() const noexcept {
+            return element_blocks.size() * Block_size;
+        }
+
+        ///
+        /// \return Maximum number of elements the container may hold
+        [[nodiscard]]
+        size_type max_size() const noexcept {
+            constexpr size_type size_type_max = std::numeric_limits<difference_type>::max();
+
+            // Indices must fit within an anchor, with null_index left unused
+            constexpr size_type index_max = (L::index_mask < size_type_max) ? static_cast<size_type>(L::index_mask) : size_type_max;
+
+            const size_type element_max = allocator_traits::max_size(allocator);
+
+            return std::min({size_type_max, index_max, element_max});
+        }
+
+        ///
+        /// Allocates blocks until at least n elements can be held. Existing
+        /// elements are not moved.
+        ///
+        /// \param n Number of elements to reserve space for
+        void reserve(const size_type n) {
+            if (n <= capacity()) {
+                return;
+            }
+
+            if (max_size() < n) {
+                throw std::length_error("aul::Paged_slot_map grew beyond max size");
+            }
+
+            const size_type blocks = (n + Block_size - 1) / Block_size;
+            element_blocks.reserve(blocks);
+            metadata_blocks.reserve(blocks);
+
+            while (capacity() < n) {
+                add_block();
+            }
+        }
+
+        ///
+        /// \return Number of blocks currently allocated
+        [[nodiscard]]
+        size_type block_count() const noexcept {
+            return element_blocks.size();
+        }
+
+        //=================================================
+        // Comparison operators
+        //=================================================
+
+        [[nodiscard]]
+        friend bool operator==(const Paged_slot_map& lhs, const Paged_slot_map& rhs) {
+            return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+        }
+
+        [[nodiscard]]
+        friend bool operator!=(const Paged_slot_map& lhs, const Paged_slot_map& rhs) {
+            return !operator==(lhs, rhs);
+        }
+
+        //=================================================
+        // Misc. methods
+        //=================================================
+
+        /// \param it Iterator to element
+        /// \return Key corresponding to element pointed to by it
+        [[nodiscard]]
+        key_type get_key(const const_iterator it) const noexcept {
+            return key_at(static_cast<size_type>(it - cbegin()));
+        }
+
+        /// \param key Key to be checked
+        /// \return True if the key maps to a valid element
+        [[nodiscard]]
+        bool contains(const key_type key) const noexcept {
+            return (key.index < capacity()) && (key.version == L::version(anchor(key.index)));
+        }
+
+        [[nodiscard]]
+        allocator_type get_allocator() const {
+            return allocator;
+        }
+
+    private:
+
+        //=================================================
+        // Instance members
+        //=================================================
+
+        allocator_type allocator{};
+
+        ///
+        /// Pointers to each block of elements
+        ///
+        element_table_type element_blocks{};
+
+        ///
+        /// Pointers to the anchors and reverse mapping for each block. Anchor
+        /// i and the reverse mapping of the element at position i are found
+        /// in block i / Block_size
+        ///
+        metadata_table_type metadata_blocks{};
+
+        size_type elem_count = 0;
+
+        ///
+        /// Index of the first anchor in the free list, or null_index if the
+        /// free list is empty
+        ///
+        size_type free_anchor = null_index;
+
+        //=================================================
+        // Block helper methods
+        //=================================================
+
+        [[nodiscard]]
+        T* element_at(const size_type pos) const noexcept {
+            return element_blocks[pos / Block_size] + pos % Block_size;
+        }
+
+        [[nodiscard]]
+        anchor_type& anchor(const size_type i) const noexcept {
+            return metadata_blocks[i / Block_size]->anchors[i % Block_size];
+        }
+
+        [[nodiscard]]
+        anchor_index_type& anchor_index(const size_type pos) const noexcept {
+            return metadata_blocks[pos / Block_size]->anchor_indices[pos % Block_size];
+        }
+
+        ///
+        /// Appends a new block and threads its anchors onto the front of the
+        /// free list
+        ///
+        void add_block() {
+            element_blocks.reserve(element_blocks.size() + 1);
+            metadata_blocks.reserve(metadata_blocks.size() + 1);
+
+            metadata_allocator_type metadata_allocator{allocator};
+
+            T* elements = aul::to_raw_pointer(allocator_traits::allocate(allocator, Block_size));
+            Metadata_block* metadata;
+            try {
+                metadata = aul::to_raw_pointer(metadata_allocator_traits::allocate(metadata_allocator, 1));
+            } catch (...) {
+                allocator_traits::deallocate(allocator, elements, Block_size);
+                throw;
+            }
+
+            // With narrow anchor layouts the last block may extend past
+            // max_size(). Anchors beyond it are never put on the free list
+            const size_type first = capacity();
+            const size_type usable = std::min<size_type>(Block_size, max_size() - first);
+
+            for (size_type i = 0; i < usable - 1; ++i) {
+                metadata->anchors[i] = L::make(static_cast<anchor_type>(first + i + 1), 1);
+            }
+            metadata->anchors[usable - 1] = L::make(static_cast<anchor_type>(free_anchor), 1);
+
+            for (size_type i = usable; i < Block_size; ++i) {
+                metadata->anchors[i] = L::make(static_cast<anchor_type>(null_index), 0);
+            }
+
+            element_blocks.push_back(elements);
+            metadata_blocks.push_back(metadata);
+
+            free_anchor = first;
+        }
+
+        ///
+        /// Copies the contents of src into the current object, which must be
+        /// empty
+        ///
+        void copy_contents(const Paged_slot_map& src) {
+            static_assert(std::is_copy_constructible<T>::value, "Type T is not copy-constructible.");
+
+            element_blocks.reserve(src.element_blocks.size());
+            metadata_blocks.reserve(src.metadata_blocks.size());
+
+            try {
+                while (capacity() < src.capacity()) {
+                    add_block();
+                }
+
+                for (; elem_count < src.elem_count; ++elem_count) {
+                    allocator_traits::construct(allocator, element_at(elem_count), *src.element_at(elem_count));
+                }
+            } catch (...) {
+                clear();
+                throw;
+            }
+
+            for (size_type i = 0; i < metadata_blocks.size(); ++i) {
+                *metadata_blocks[i] = *src.metadata_blocks[i];
+            }
+            free_anchor = src.free_anchor;
+        }
+
+        //=================================================
+        // Anchor helper methods
+        //=================================================
+
+        /// \param pos Position of element
+        /// \return Key mapped to the element at pos
+        [[nodiscard]]
+        key_type key_at(const size_type pos) const noexcept {
+            const anchor_index_type i = anchor_index(pos);
+            return key_type{i, static_cast<typename L::version_type>(L::version(anchor(i)))};
+        }
+
+        ///
+        /// Takes the anchor at the front of the free list and maps it to the
+        /// element at pos
+        ///
+        /// \pre The free list is not empty
+        void consume_anchor(const size_type pos) noexcept {
+            const size_type i = free_anchor;
+            anchor_type& a = anchor(i);
+
+            free_anchor = L::index(a);
+            a = L::with_index(a, static_cast<anchor_type>(pos));
+            anchor_index(pos) = static_cast<anchor_index_type>(i);
+        }
+
+        ///
+        /// Pushes anchor i onto the free list and increments its version
+        ///
+        void release_anchor(const size_type i) noexcept {
+            anchor_type& a = anchor(i);
+            a = L::make(static_cast<anchor_type>(free_anchor), static_cast<anchor_type>(L::version(a) + 1));
+            free_anchor = i;
+        }
+
+        ///
+        /// Erases the element at pos, moving the last element into its place
+        ///
+        void erase_at(const size_type pos) noexcept {
+            const size_type erased_anchor = anchor_index(pos);
+
+            const size_type last = elem_count - 1;
+            if (pos != last) {
+                *element_at(pos) = std::move(*element_at(last));
+
+                const anchor_index_type moved_anchor = anchor_index(last);
+                anchor(moved_anchor) = L::with_index(anchor(moved_anchor), static_cast<anchor_type>(pos));
+                anchor_index(pos) = moved_anchor;
+            }
+
+            allocator_traits::destroy(allocator, element_at(last));
+
+            release_anchor(erased_anchor);
+            --elem_count;
+        }
+
+    };
+
+    template<class T, class A, class L, std::size_t Block_size>
+    struct Paged_slot_map<T, A, L, Block_size>::Metadata_block {
+
+        ///
+        /// Packed position and version of each key's element
+        ///
+        anchor_type anchors[Block_size];
+
+        ///
+        /// Index of the anchor mapped to each element
+        ///
+        anchor_index_type anchor_indices[Block_size];
+
+    };
+
+}
+
+#endif //AUL_PAGED_SLOT_MAP_HPP
@@ -0,0 +1,438 @@
+#ifndef AUL_SEARCH_POLICIES_HPP
+#define AUL_SEARCH_POLICIES_HPP
+
+#include "../Algorithms.hpp"
+#include "../Bits.hpp"
+#include "../memory/Memory.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace aul {
+
+    ///
+    /// Search policies determine how a sorted associative container, such as
+    /// aul::Array_map, locates keys within its sorted key array.
+    ///
+    /// A policy provides a nested class template Index<K, C, A>, where K is
+    /// the key type, C the comparator type, and A an allocator for K. An
+    /// Index object is held by the container and must provide:
+    ///
+    /// explicit Index(const A&)
+    ///     Constructs an empty index
+    ///
+    /// P lower_bound(P keys, std::size_t n, const T& key, const C& c) const
+    ///     Returns a pointer to the first of the n sorted keys which does not
+    ///     compare less than key, or keys + n if there is no such key
+    ///
+    /// O lower_bound_many(P keys, std::size_t n, I first, I last, O out, const C& c) const
+    ///     Writes the result of lower_bound for each key in [first, last) to
+    ///     out. Returns the end of the output range
+    ///
+    /// void invalidate() noexcept
+    ///     Called by the container before it begins modifying its keys
+    ///
+    /// void rebuild(P keys, std::size_t n) noexcept
+    ///     Called by the container after it has modified its keys, with the
+    ///     new sorted keys
+    ///
+    /// Lookups are const and must not modify the index, so that concurrent
+    /// lookups on an unmodified container are safe.
+    ///
+
+    ///
+    /// Searches the sorted key array directly using aul::binary_search. Keeps
+    /// no auxiliary state.
+    ///
+    struct Binary_search_policy {
+
+        template<class K, class C, class A>
+        class Index {
+        public:
+
+            //=============================================
+            // -ctors
+            //=============================================
+
+            Index() = default;
+
+            explicit Index(const A&) {}
+
+            //=============================================
+            // Search methods
+            //=============================================
+
+            template<class P, class T>
+            [[nodiscard]]
+            P lower_bound(P keys, const std::size_t n, const T& key, const C& c) const {
+                return aul::binary_search(keys, keys + n, key, c);
+            }
+
+            template<class P, class In_iter, class Out_iter>
+            Out_iter lower_bound_many(P keys, const std::size_t n, In_iter first, In_iter last, Out_iter out, const C& c) const {
+                return aul::batch_binary_search(keys, keys + n, first, last, out, c);
+            }
+
+            //=============================================
+            // Mutators
+            //=============================================
+
+            void invalidate() noexcept {}
+
+            template<class P>
+            void rebuild(P, std::size_t) noexcept {}
+
+        };
+
+    };
+
+    namespace impl {
+
+        ///
+        /// Policy which searches the sorted key array directly using the
+        /// search function wrapped by Searcher, one key at a time
+        ///
+        /// \tparam Searcher Type with a static member function template
+        ///     search(begin, end, key, c) with the semantics of
+        ///     aul::binary_search
+        template<class Searcher>
+        struct Stateless_search_policy {
+
+            template<class K, class C, class A>
+            class Index {
+            public:
+
+                //=========================================
+                // -ctors
+                //=========================================
+
+                Index() = default;
+
+                explicit Index(const A&) {}
+
+                //=========================================
+                // Search methods
+                //=========================================
+
+                template<class P, class T>
+                [[nodiscard]]
+                P lower_bound(P keys, const std::size_t n, const T& key, const C& c) const {
+                    return Searcher::search(keys, keys + n, key, c);
+                }
+
+                template<class P, class In_iter, class Out_iter>
+                Out_iter lower_bound_many(P keys, const std::size_t n, In_iter first, In_iter last, Out_iter out, const C& c) const {
+                    for (; first != last; ++first, ++out) {
+                        *out = Searcher::search(keys, keys + n, *first, c);
+                    }
+                    return out;
+                }
+
+                //=========================================
+                // Mutators
+                //=========================================
+
+                void invalidate() noexcept {}
+
+                template<class P>
+                void rebuild(P, std::size_t) noexcept {}
+
+            };
+
+        };
+
+        struct Exponential_searcher {
+            template<class P, class T, class C>
+            static P search(P begin, P end, const T& key, const C& c) {
+                return aul::exponential_search(begin, end, key, c);
+            }
+        };
+
+        struct Interpolation_searcher {
+            template<class P, class T, class C>
+            static P search(P begin, P end, const T& key, const C& c) {
+                return aul::interpolation_search(begin, end, key, c);
+            }
+        };
+
+        struct Interpolation_sequential_searcher {
+            template<class P, class T, class C>
+            static P search(P begin, P end, const T& key, const C& c) {
+                return aul::interpolation_sequential_search(begin, end, key, c);
+            }
+        };
+
+    }
+
+    ///
+    /// Searches the sorted key array using aul::exponential_search. Suited
+    /// to lookups which mostly target the smallest keys.
+    ///
+    struct Exponential_search_policy : public impl::Stateless_search_policy<impl::Exponential_searcher> {};
+
+    ///
+    /// Searches the sorted key array using aul::interpolation_search. Suited
+    /// to numeric keys which are roughly uniformly distributed. Keys must be
+    /// explicitly convertible to double.
+    ///
+    struct Interpolation_search_policy : public impl::Stateless_search_policy<impl::Interpolation_searcher> {};
+
+    ///
+    /// Searches the sorted key array using
+    /// aul::interpolation_sequential_search. Suited to numeric keys which are
+    /// very evenly spaced, such as timestamps or sequential IDs. Keys must be
+    /// explicitly convertible to double.
+    ///
+    struct Interpolation_sequential_search_policy : public impl::Stateless_search_policy<impl::Interpolation_sequential_searcher> {};
+
+    ///
+    /// Maintains a copy of the keys laid out in Eytzinger order, i.e. as an
+    /// implicit binary search tree stored breadth-first, where the children of
+    /// node k are at positions 2k and 2k + 1.
+    ///
+    /// The first levels of the tree share a handful of cache lines which stay
+    /// resident, and the nodes visited on the next several levels are
+    /// contiguous, so they can be prefetched ahead of the comparisons which
+    /// need them. For key arrays which do not fit in cache this substantially
+    /// reduces the cost of a lookup compared to a binary search over the
+    /// sorted array.
+    ///
+    /// The index is rebuilt in O(n) time whenever the keys are modified,
+    /// making this policy suited to read-mostly containers. If the index
+    /// can't be built, lookups fall back to a binary search over the sorted
+    /// array.
+    ///
+    struct Eytzinger_search_policy {
+
+        template<class K, class C, class A>
+        class Index {
+            using key_allocator_type = typename std::allocator_traits<A>::template rebind_alloc<K>;
+
+        public:
+
+            //=============================================
+            // -ctors
+            //=============================================
+
+            Index() = default;
+
+            explicit Index(const A& a):
+                nodes(key_allocator_type{a}) {}
+
+            //=============================================
+            // Search methods
+            //=============================================
+
+            template<class P, class T>
+            [[nodiscard]]
+            P lower_bound(P keys, const std::size_t n, const T& key, const C& c) const {
+                if (n == 0) {
+                    return keys;
+                }
+
+                if (!is_valid || node_count != n) {
+                    // The index is only a cache so the sorted array is still
+                    // searchable if it couldn't be built
+                    return aul::binary_search(keys, keys + n, key, c);
+                }
+
+                const K* tree = nodes.data() + tree_offset;
+
+                std::size_t k = 1;
+                while (k <= n) {
+                    // Descendants past the end of the tree have no address
+                    // which may be formed, let alone prefetched
+                    if (k * nodes_per_line <= n) {
+                        aul::prefetch(tree + k * nodes_per_line);
+                    }
+                    k = 2 * k + static_cast<std::size_t>(c(tree[k], key));
+                }
+
+                // Undo the trailing right turns, and the final left turn, to
+                // recover the last node which did not compare less than key
+                k >>= aul::countr_zero(~k) + 1;
+
+                return (k == 0) ? keys + n : keys + rank_of(k);
+            }
+
+            ///
+            /// Descends the tree for a group of keys at a time, one level per
+            /// step, so that the cache misses of the different searches
+            /// overlap
+            ///
+            template<class P, class In_iter, class Out_iter>
+            Out_iter lower_bound_many(P keys, const std::size_t n, In_iter first, In_iter last, Out_iter out, const C& c) const {
+                constexpr std::ptrdiff_t group_size = 16;
+
+                if (n != 0 && (!is_valid || node_count != n)) {
+                    return aul::batch_binary_search(keys, keys + n, first, last, out, c);
+                }
+
+                const K* tree = nodes.data() + tree_offset;
+
+                std::size_t positions[group_size];
+
+                while (first != last) {
+                    const std::ptrdiff_t m = std::min(group_size, std::ptrdiff_t(last - first));
+                    for (std::ptrdiff_t j = 0; j < m; ++j) {
+                        positions[j] = 1;
+                    }
+
+                    for (unsigned level = 0; level < height; ++level) {
+                        for (std::ptrdiff_t j = 0; j < m; ++j) {
+                            const std::size_t k = positions[j];
+                            if (k <= n) {
+                                if (k * nodes_per_line <= n) {
+                                    aul::prefetch(tree + k * nodes_per_line);
+                                }
+                                positions[j] = 2 * k + static_cast<std::size_t>(c(tree[k], first[j]));
+                            }
+                        }
+                    }
+
+                    for (std::ptrdiff_t j = 0; j < m; ++j, ++out) {
+                        std::size_t k = positions[j];
+                        k >>= aul::countr_zero(~k) + 1;
+                        *out = (k == 0) ? keys + n : keys + rank_of(k);
+                    }
+
+                    first += m;
+                }
+
+                return out;
+            }
+
+            //=============================================
+            // Mutators
+            //=============================================
+
+            void invalidate() noexcept {
+                is_valid = false;
+            }
+
+            ///
+            /// Builds the tree from the sorted keys. The index is left invalid
+            /// if this fails
+            ///
+            /// \param keys Pointer to sorted keys
+            /// \param n Number of keys
+            template<class P>
+            void rebuild(P keys, const std::size_t n) noexcept {
+                is_valid = false;
+
+                if (n == 0) {
+                    nodes.clear();
+                    node_count = 0;
+                    return;
+                }
+
+                try {
+                    build(keys, n);
+                } catch (...) {
+                    nodes.clear();
+                }
+            }
+
+        private:
+
+            //=============================================
+            // Static members
+            //=============================================
+
+            static constexpr std::size_t cache_line_size = 64;
+
+            ///
+            /// Number of nodes within a cache line. The children of the nodes
+            /// in one line are contiguous, so prefetching node k * 8 loads the
+            /// nodes three levels below node k for 8-byte keys
+            ///
+            static constexpr std::size_t nodes_per_line = (sizeof(K) < cache_line_size) ? cache_line_size / sizeof(K) : 1;
+
+            //=============================================
+            // Instance members
+            //=============================================
+
+            std::vector<K, key_allocator_type> nodes;
+
+            ///
+            /// Offset of the position before the root within nodes, chosen so
+            /// that the groups of nodes fetched together start on a cache line
+            ///
+            std::size_t tree_offset = 0;
+
+            std::size_t node_count = 0;
+
+            ///
+            /// Number of levels in the tree
+            ///
+            unsigned height = 0;
+
+            ///
+            /// Number of nodes present on the tree's last, possibly partial,
+            /// level
+            ///
+            std::size_t last_level_count = 0;
+
+            bool is_valid = false;
+
+            //=============================================
+            // Helper functions
+            //=============================================
+
+            ///
+            /// \param keys Pointer to sorted keys
+            /// \param n Number of keys. Must be non-zero
+            template<class P>
+            void build(P keys, const std::size_t n) {
+                nodes.clear();
+                nodes.reserve(n + nodes_per_line);
+
+                const auto address = reinterpret_cast<std::uintptr_t>(nodes.data());
+                const std::size_t gap = (cache_line_size - address % cache_line_size) % cache_line_size;
+                tree_offset = (gap % sizeof(K) == 0 && gap / sizeof(K) < nodes_per_line) ? gap / sizeof(K) : 0;
+
+                node_count = n;
+                height = std::numeric_limits<std::size_t>::digits - aul::countl_zero(n);
+                last_level_count = n - (std::size_t{1} << (height - 1)) + 1;
+
+                // Padding and position 0 are never read
+                for (std::size_t i = 0; i <= tree_offset; ++i) {
+                    nodes.push_back(keys[0]);
+                }
+                for (std::size_t k = 1; k <= n; ++k) {
+                    nodes.push_back(keys[rank_of(k)]);
+                }
+
+                is_valid = true;
+            }
+
+            ///
+            /// \param k Position of a node in the tree
+            /// \return Position of the node's key within the sorted array
+            [[nodiscard]]
+            std::size_t rank_of(const std::size_t k) const noexcept {
+                const unsigned depth = std::numeric_limits<std::size_t>::digits - 1 - aul::countl_zero(k);
+
+                // Rank the node would have if the last level were full
+                const std::size_t offset = k - (std::size_t{1} << depth);
+                const std::size_t r = ((2 * offset + 1) << (height - 1 - depth)) - 1;
+
+                // Nodes on the last level have the even ranks in a full tree.
+                // Discount those which are absent and precede the node
+                const std::size_t preceding_leaves = (r + 1) / 2;
+                const std::size_t absent_leaves = (preceding_leaves > last_level_count) ? preceding_leaves - last_level_count : 0;
+
+                return r - absent_leaves;
+            }
+
+        };
+
+    };
+
+}
+
+#endif //AUL_SEARCH_POLICIES_HPP
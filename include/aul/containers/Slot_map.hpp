@@ -5,43 +5,54 @@
 #pragma warning(disable : 4996)
 #endif
 
-#include "../Versioned_type.hpp"
 #include "../memory/Memory.hpp"
 #include "../Algorithms.hpp"
+#include "../Span.hpp"
 #include "Random_access_iterator.hpp"
 
 #include <algorithm>
 #include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <string>
 #include <type_traits>
 #include <utility>
 #include <stdexcept>
+#include <vector>
 
 namespace aul {
 
-    template<class T, class A>
+    template<class W, unsigned Index_bits>
+    struct Slot_map_anchor_layout;
+
+    template<bool Fifo, bool Retire_wrapping>
+    struct Slot_map_free_list_policy;
+
+    template<class T, class A, class L, class P>
     class Slot_map;
 
 
     ///
     /// A class representing a key used by an aul::Slot_map container.
     ///
-    /// \tparam T An integral type
-    template<class T>
+    /// \tparam T An unsigned integral type for the index
+    /// \tparam V An unsigned integral type for the version
+    template<class T, class V = T>
     struct Slot_map_key {
         static_assert(std::numeric_limits<T>::is_integer);
         static_assert(!std::numeric_limits<T>::is_signed);
-
-        template<class U, class A>
-        friend class Slot_map;
+        static_assert(std::numeric_limits<V>::is_integer);
+        static_assert(!std::numeric_limits<V>::is_signed);
 
         //=================================================
         // -ctors
         //=================================================
 
-        Slot_map_key(const T index, const T version):
+        Slot_map_key(const T index, const V version):
             index(index),
             version(version) {}
 
@@ -90,7 +101,7 @@ namespace aul {
         //=================================================
 
         T index = std::numeric_limits<T>::max();
-        T version = std::numeric_limits<T>::max();
+        V version = std::numeric_limits<V>::max();
 
     };
 
@@ -98,6 +109,284 @@ namespace aul {
 
 
 
+    ///
+    /// Describes how an aul::Slot_map packs each of its anchors into a single
+    /// word. The low Index_bits bits of the word hold an index and the
+    /// remaining bits hold the anchor's version.
+    ///
+    /// The number of index bits bounds the capacity of the container. The
+    /// number of version bits determines how many times a slot may be reused
+    /// before its version wraps around, after which a stale key may once again
+    /// compare as valid. For example, Slot_map_anchor_layout<std::uint32_t, 24>
+    /// allows for roughly 16 million elements with 8-bit versions, using four
+    /// bytes per anchor.
+    ///
+    /// The keys of a container using a layout hold an index_type and a
+    /// version_type, so narrow layouts also shrink keys. For example,
+    /// Slot_map_anchor_layout<std::uint32_t, 16> yields 32-bit keys. Pair
+    /// narrow versions with aul::Slot_map_generational_reuse to keep stale
+    /// keys from becoming valid again.
+    ///
+    /// \tparam W Unsigned integral type anchors are packed into
+    /// \tparam Index_bits Number of bits used for the index
+    template<class W = std::uint64_t, unsigned Index_bits = std::numeric_limits<W>::digits / 2>
+    struct Slot_map_anchor_layout {
+        static_assert(std::is_unsigned<W>::value, "Anchor word type must be an unsigned integer");
+        static_assert(0 < Index_bits && Index_bits < std::numeric_limits<W>::digits, "Anchor word must have room for both index and version");
+
+        //=================================================
+        // Type aliases
+        //=================================================
+
+        using word_type = W;
+
+        ///
+        /// Smallest unsigned integer type able to hold an index
+        ///
+        using index_type = std::conditional_t<
+            Index_bits <= 8, std::uint8_t, std::conditional_t<
+            Index_bits <= 16, std::uint16_t, std::conditional_t<
+            Index_bits <= 32, std::uint32_t, std::uint64_t>>>;
+
+        //=================================================
+        // Static members
+        //=================================================
+
+        static constexpr unsigned index_bits = Index_bits;
+        static constexpr unsigned version_bits = std::numeric_limits<W>::digits - Index_bits;
+
+        static constexpr W index_mask = static_cast<W>((W{1} << Index_bits) - 1);
+
+        ///
+        /// Largest version an anchor can hold before wrapping around to 0
+        ///
+        static constexpr W version_max = static_cast<W>(static_cast<W>(~W{0}) >> Index_bits);
+
+        //=================================================
+        // Type aliases
+        //=================================================
+
+        ///
+        /// Smallest unsigned integer type able to hold a version
+        ///
+        using version_type = std::conditional_t<
+            version_bits <= 8, std::uint8_t, std::conditional_t<
+            version_bits <= 16, std::uint16_t, std::conditional_t<
+            version_bits <= 32, std::uint32_t, std::uint64_t>>>;
+
+        //=================================================
+        // Static methods
+        //=================================================
+
+        [[nodiscard]]
+        static constexpr W index(const W anchor) noexcept {
+            return static_cast<W>(anchor & index_mask);
+        }
+
+        [[nodiscard]]
+        static constexpr W version(const W anchor) noexcept {
+            return static_cast<W>(anchor >> Index_bits);
+        }
+
+        ///
+        /// \param index Index to store. Must not exceed index_mask
+        /// \param version Version to store. Truncated to version_bits bits
+        /// \return Packed anchor
+        [[nodiscard]]
+        static constexpr W make(const W index, const W version) noexcept {
+            return static_cast<W>(static_cast<W>(version << Index_bits) | index);
+        }
+
+        [[nodiscard]]
+        static constexpr W with_index(const W anchor, const W index) noexcept {
+            return static_cast<W>((anchor & static_cast<W>(~index_mask)) | index);
+        }
+
+    };
+
+    ///
+    /// Determines how an aul::Slot_map reuses the anchors of erased elements.
+    ///
+    /// The anchors of erased elements form a free list threaded through the
+    /// index bits of the anchors themselves, so the free list takes no space
+    /// beyond the indices of its ends. Each reuse of an anchor increments its
+    /// version.
+    ///
+    /// \tparam Fifo If true, anchors are reused in the order they were freed,
+    ///     spreading version increments evenly across all free anchors.
+    ///     Otherwise the most recently freed anchor is reused first, which is
+    ///     the most cache-friendly choice
+    /// \tparam Retire_wrapping If true, an anchor whose version would wrap
+    ///     around on its next reuse is retired instead of being freed, so that
+    ///     no stale key can ever become valid again. Each retired anchor
+    ///     permanently removes one slot from the container's capacity until
+    ///     clear() is called
+    template<bool Fifo, bool Retire_wrapping>
+    struct Slot_map_free_list_policy {
+        static constexpr bool is_fifo = Fifo;
+        static constexpr bool retires_wrapping_anchors = Retire_wrapping;
+    };
+
+    ///
+    /// Reuses the most recently freed anchor first. Versions may wrap around
+    ///
+    using Slot_map_lifo_reuse = Slot_map_free_list_policy<false, false>;
+
+    ///
+    /// Reuses the least recently freed anchor first. Versions may wrap around
+    ///
+    using Slot_map_fifo_reuse = Slot_map_free_list_policy<true, false>;
+
+    ///
+    /// Reuses the least recently freed anchor first and retires anchors
+    /// before their versions wrap around. Makes narrow version fields safe
+    ///
+    using Slot_map_generational_reuse = Slot_map_free_list_policy<true, true>;
+
+    ///
+    /// Header at the start of an image produced by Slot_map::snapshot().
+    ///
+    /// The header is followed by the anchors, the reverse mapping and the
+    /// elements, each starting at the offset recorded here. Offsets are
+    /// multiples of Slot_map_snapshot_header::alignment, or of T's alignment
+    /// if greater. All values are stored in the native byte order.
+    ///
+    struct Slot_map_snapshot_header {
+
+        //=================================================
+        // Static members
+        //=================================================
+
+        static constexpr std::uint64_t magic_value = 0x31504d534c554100; // "\0AULSMP1"
+
+        static constexpr std::uint32_t format_version_value = 1;
+
+        ///
+        /// Minimum alignment of each section within an image
+        ///
+        static constexpr std::uint64_t alignment = 64;
+
+        ///
+        /// Bits of flags recording the free list policy of the source
+        ///
+        static constexpr std::uint32_t fifo_flag = 0x1;
+        static constexpr std::uint32_t retire_flag = 0x2;
+
+        //=================================================
+        // Instance members
+        //=================================================
+
+        std::uint64_t magic = magic_value;
+        std::uint32_t format_version = format_version_value;
+
+        std::uint32_t element_size = 0;
+        std::uint32_t element_alignment = 0;
+        std::uint32_t anchor_size = 0;
+        std::uint32_t index_bits = 0;
+        std::uint32_t flags = 0;
+
+        std::uint64_t size = 0;
+        std::uint64_t capacity = 0;
+
+        std::uint64_t free_head = 0;
+        std::uint64_t free_tail = 0;
+        std::uint64_t retired_count = 0;
+
+        std::uint64_t anchors_offset = 0;
+        std::uint64_t anchor_indices_offset = 0;
+        std::uint64_t elements_offset = 0;
+        std::uint64_t image_size = 0;
+
+    };
+
+    namespace impl {
+
+        ///
+        /// Computes and checks the placement of the sections of Slot_map
+        /// snapshots for a particular element type and anchor layout
+        ///
+        template<class T, class L>
+        struct Slot_map_snapshot_format {
+
+            static constexpr std::uint64_t alignment = std::max<std::uint64_t>(Slot_map_snapshot_header::alignment, alignof(T));
+
+            [[nodiscard]]
+            static constexpr std::uint64_t align_up(const std::uint64_t x) noexcept {
+                return (x + alignment - 1) / alignment * alignment;
+            }
+
+            ///
+            /// \param capacity Number of anchors
+            /// \param size Number of elements
+            /// \return Header with all fields but the free list filled in
+            [[nodiscard]]
+            static Slot_map_snapshot_header make_header(const std::uint64_t capacity, const std::uint64_t size) noexcept {
+                Slot_map_snapshot_header ret{};
+                ret.element_size = sizeof(T);
+                ret.element_alignment = alignof(T);
+                ret.anchor_size = sizeof(typename L::word_type);
+                ret.index_bits = L::index_bits;
+
+                ret.size = size;
+                ret.capacity = capacity;
+
+                ret.anchors_offset = align_up(sizeof(Slot_map_snapshot_header));
+                ret.anchor_indices_offset = align_up(ret.anchors_offset + capacity * sizeof(typename L::word_type));
+                ret.elements_offset = align_up(ret.anchor_indices_offset + size * sizeof(typename L::index_type));
+                ret.image_size = align_up(ret.elements_offset + size * sizeof(T));
+
+                return ret;
+            }
+
+            ///
+            /// Reads and validates the header of an image. The contents of the
+            /// sections are trusted.
+            ///
+            /// \param image Pointer to start of image
+            /// \param bytes Number of bytes available at image
+            /// \return Copy of the image's header
+            [[nodiscard]]
+            static Slot_map_snapshot_header read_header(const void* image, const std::uint64_t bytes) {
+                Slot_map_snapshot_header ret;
+                if (bytes < sizeof(ret)) {
+                    throw std::runtime_error("aul::Slot_map snapshot is truncated");
+                }
+                std::memcpy(&ret, image, sizeof(ret));
+
+                if (ret.magic != Slot_map_snapshot_header::magic_value || ret.format_version != Slot_map_snapshot_header::format_version_value) {
+                    throw std::runtime_error("aul::Slot_map snapshot has unrecognized format");
+                }
+
+                const bool is_compatible =
+                    ret.element_size == sizeof(T) &&
+                    ret.element_alignment == alignof(T) &&
+                    ret.anchor_size == sizeof(typename L::word_type) &&
+                    ret.index_bits == L::index_bits;
+
+                if (!is_compatible) {
+                    throw std::runtime_error("aul::Slot_map snapshot was made with a different element type or anchor layout");
+                }
+
+                const Slot_map_snapshot_header expected = make_header(ret.capacity, ret.size);
+                const bool is_consistent =
+                    ret.size <= ret.capacity &&
+                    ret.capacity <= L::index_mask &&
+                    ret.anchors_offset == expected.anchors_offset &&
+                    ret.anchor_indices_offset == expected.anchor_indices_offset &&
+                    ret.elements_offset == expected.elements_offset &&
+                    ret.image_size == expected.image_size;
+
+                if (!is_consistent || bytes < ret.image_size) {
+                    throw std::runtime_error("aul::Slot_map snapshot is corrupt or truncated");
+                }
+
+                return ret;
+            }
+
+        };
+
+    }
+
     /// Slot_map
     ///
     /// An associative container offering constant time look-up, insertion, and
@@ -116,14 +405,23 @@ namespace aul {
     /// Algorithms such as std::sort and std::reverse may be applied to the
     /// contents of this container however all keys are liable to lose their
     /// associations. Keys will still map to valid elements but the resulting
-    /// mappings are not predictable.
+    /// mappings are not predictable. The sort() and partition() methods
+    /// reorder the elements while keeping every key mapped to its element.
     ///
     /// A default-constructed value of key_type is very unlikely to map to
     /// any object at any time and thus can effectively be used as a null key.
     ///
+    /// Each key refers to an anchor which holds the position of the key's
+    /// element along with a version, packed into one word as described by L.
+    /// Looking up a key only touches its anchor and the element. The reverse
+    /// mapping from elements to anchors, needed when elements are moved, is
+    /// stored in a separate array.
+    ///
     /// \tparam T Element type
     /// \tparam A Allocator type
-    template<class T, class A = std::allocator<T>>
+    /// \tparam L Anchor layout. See aul::Slot_map_anchor_layout
+    /// \tparam P Free list policy. See aul::Slot_map_free_list_policy
+    template<class T, class A = std::allocator<T>, class L = Slot_map_anchor_layout<>, class P = Slot_map_lifo_reuse>
     class Slot_map {
 
         //=================================================
@@ -132,8 +430,6 @@ namespace aul {
 
         class Allocation;
 
-        class Metadata;
-
         //=================================================
         // Type aliases
         //=================================================
@@ -149,7 +445,7 @@ namespace aul {
         using const_pointer = typename std::allocator_traits<allocator_type>::const_pointer;
 
         using value_type = T;
-        using key_type = Slot_map_key<size_type>;
+        using key_type = Slot_map_key<typename L::index_type, typename L::version_type>;
 
         using reference = T&;
         using const_reference = const T&;
@@ -157,13 +453,31 @@ namespace aul {
         using iterator = Random_access_iterator<pointer>;
         using const_iterator = Random_access_iterator<const_pointer>;
 
+        using anchor_layout = L;
+        using free_list_policy = P;
+
     private:
 
         using allocator_traits = std::allocator_traits<allocator_type>;
 
-        using md_allocator_type = typename std::allocator_traits<A>::template rebind_alloc<Metadata>;
-        using md_allocator_traits = std::allocator_traits<md_allocator_type>;
-        using md_pointer = typename md_allocator_traits::pointer;
+        using anchor_type = typename L::word_type;
+        using anchor_index_type = typename L::index_type;
+
+        using anchor_allocator_type = typename std::allocator_traits<A>::template rebind_alloc<anchor_type>;
+        using anchor_allocator_traits = std::allocator_traits<anchor_allocator_type>;
+        using anchor_pointer = typename anchor_allocator_traits::pointer;
+
+        using anchor_index_allocator_type = typename std::allocator_traits<A>::template rebind_alloc<anchor_index_type>;
+        using anchor_index_allocator_traits = std::allocator_traits<anchor_index_allocator_type>;
+        using anchor_index_pointer = typename anchor_index_allocator_traits::pointer;
+
+        ///
+        /// Value of an anchor index which does not refer to any anchor. As
+        /// max_size() is below it, no anchor or element has this index
+        ///
+        static constexpr anchor_index_type null_index = static_cast<anchor_index_type>(L::index_mask);
+
+        using snapshot_format = impl::Slot_map_snapshot_format<T, L>;
 
         //=================================================
         // -ctors
@@ -189,10 +503,10 @@ namespace aul {
             allocator(std::move(right.allocator)),
             allocation(std::move(right.allocation)),
             elem_count(std::move(right.elem_count)),
-            free_anchor(std::move(right.free_anchor)) {
+            free_list(right.free_list) {
 
             right.elem_count = 0;
-            right.free_anchor = nullptr;
+            right.free_list = empty_free_list();
         }
 
         ///
@@ -200,19 +514,25 @@ namespace aul {
         /// \param alloc Source for copy-construction of internal allocator
         ///
         Slot_map(Slot_map&& right, allocator_type alloc):
-            allocator(alloc),
-            allocation((alloc == right.get_allocator()) ? std::move(right.allocation) : allocate(right.capacity())),
-            elem_count(right.elem_count),
-            free_anchor(allocation.metadata + (right.free_anchor - right.allocation.metadata)) {
+            allocator(alloc) {
 
-            static_assert(std::is_copy_constructible<T>::value, "Type T is not copy constructable.");
+            if (right.allocator == alloc) {
+                allocation = std::move(right.allocation);
+                elem_count = right.elem_count;
+                free_list = right.free_list;
+
+                right.elem_count = 0;
+                right.free_list = empty_free_list();
+            } else {
+                allocation = allocate(right.capacity());
+                elem_count = right.elem_count;
+                free_list = right.free_list;
 
-            if (right.allocator != alloc) {
                 aul::uninitialized_move_n(right.allocation.elements, elem_count, allocation.elements, allocator);
-            }
+                copy_metadata(right.allocation, allocation, elem_count);
 
-            right.elem_count = 0;
-            right.free_anchor = nullptr;
+                right.clear();
+            }
         }
 
         ///
@@ -222,15 +542,13 @@ namespace aul {
             allocator(allocator_traits::select_on_container_copy_construction(src.allocator)),
             allocation(allocate(src.allocation.capacity)),
             elem_count(src.elem_count),
-            free_anchor(allocation.metadata + (src.free_anchor - src.allocation.metadata)) {
+            free_list(src.free_list) {
 
             static_assert(std::is_copy_constructible<T>::value, "Type T is not copy constructable.");
             //TODO: Provide strong-exception guarantee
 
-            auto md_allocator = md_allocator_type{allocator};
-
             aul::uninitialized_copy(src.allocation.elements, src.allocation.elements + src.elem_count, allocation.elements, allocator);
-            aul::uninitialized_copy(src.allocation.metadata, src.allocation.metadata + src.elem_count, allocation.metadata, md_allocator);
+            copy_metadata(src.allocation, allocation, elem_count);
         }
 
         ///
@@ -240,15 +558,13 @@ namespace aul {
             allocator(alloc),
             allocation(allocate(src.allocation.capacity)),
             elem_count(src.elem_count),
-            free_anchor(allocation.metadata + (src.free_anchor - src.allocation.metadata)) {
+            free_list(src.free_list) {
 
             static_assert(std::is_copy_constructible<T>::value, "Type T is not copy constructable.");
             //TODO: Provide strong exception guarantee
 
-            auto md_allocator = md_allocator_type{allocator};
-
             aul::uninitialized_copy(src.allocation.elements, src.allocation.elements + elem_count, allocation.elements, allocator);
-            aul::uninitialized_copy(src.allocation.metadata, src.allocation.metadata + elem_count, allocation.metadata, md_allocator);
+            copy_metadata(src.allocation, allocation, elem_count);
         }
 
         ///
@@ -256,7 +572,6 @@ namespace aul {
         ///
         ~Slot_map() {
             aul::destroy(allocation.elements, allocation.elements + size(), allocator);
-            aul::destroy(allocation.metadata, allocation.metadata + capacity(), allocator);
             deallocate(allocation);
         }
 
@@ -272,16 +587,13 @@ namespace aul {
         ///
         void clear() noexcept {
             if (allocation.capacity) {
-                auto md_allocator = md_allocator_type{allocator};
-
                 aul::destroy(allocation.elements, allocation.elements + elem_count, allocator);
-                aul::destroy(allocation.metadata, allocation.metadata + allocation.capacity, md_allocator);
             }
 
             deallocate(allocation);
 
             elem_count = 0;
-            free_anchor = nullptr;
+            free_list = empty_free_list();
         }
 
         /// Replaces the contents of the current object those of src. Also swaps
@@ -296,7 +608,7 @@ namespace aul {
 
             std::swap(allocation, src.allocation);
             std::swap(elem_count, src.elem_count);
-            std::swap(free_anchor, src.free_anchor);
+            std::swap(free_list, src.free_list);
         }
 
         ///
@@ -329,12 +641,10 @@ namespace aul {
             }
             allocation = allocate(src.allocation.capacity);
             elem_count = src.elem_count;
-            free_anchor = allocation.metadata + (src.free_anchor - src.allocation.metadata);
-
-            auto md_allocator = md_allocator_type{allocator};
+            free_list = src.free_list;
 
             aul::uninitialized_copy(src.allocation.elements, src.allocation.elements + elem_count, allocation.elements, allocator);
-            aul::uninitialized_copy(src.allocation.metadata, src.allocation.metadata + elem_count, allocation.metadata, md_allocator);
+            copy_metadata(src.allocation, allocation, elem_count);
 
             return *this;
         }
@@ -354,12 +664,12 @@ namespace aul {
                 allocator = std::move(src.allocator);
             }
 
-            allocation = std::move(allocation);
-            elem_count = std::move(elem_count);
-            free_anchor = std::move(free_anchor);
+            allocation = std::move(src.allocation);
+            elem_count = src.elem_count;
+            free_list = src.free_list;
 
             src.elem_count = 0;
-            src.free_anchor = nullptr;
+            src.free_list = empty_free_list();
 
             return *this;
         }
@@ -368,6 +678,78 @@ namespace aul {
         // Element access operators/methods
         //=================================================
 
+        ///
+        /// Looks up a key with a single read of its anchor. Suited to loops
+        /// over many keys which may be stale.
+        ///
+        /// \param key Key mapped to desired element
+        /// \return Pointer to element mapped to key or nullptr if key is not
+        /// valid
+        [[nodiscard]]
+        T* get_if(const key_type key) noexcept {
+            return aul::to_raw_pointer(find_element(key));
+        }
+
+        ///
+        /// Looks up a key with a single read of its anchor. Suited to loops
+        /// over many keys which may be stale.
+        ///
+        /// \param key Key mapped to desired element
+        /// \return Pointer to element mapped to key or nullptr if key is not
+        /// valid
+        [[nodiscard]]
+        const T* get_if(const key_type key) const noexcept {
+            return aul::to_raw_pointer(find_element(key));
+        }
+
+        ///
+        /// Undefined behavior if key is not valid. Reads the key's anchor and
+        /// then the element, without checking the key's version
+        ///
+        /// \param key Key mapped to desired element
+        /// \return Pointer to element mapped to key
+        [[nodiscard]]
+        T* get_unchecked(const key_type key) noexcept {
+            return aul::to_raw_pointer(allocation.elements + L::index(allocation.anchors[key.index]));
+        }
+
+        ///
+        /// Undefined behavior if key is not valid. Reads the key's anchor and
+        /// then the element, without checking the key's version
+        ///
+        /// \param key Key mapped to desired element
+        /// \return Pointer to element mapped to key
+        [[nodiscard]]
+        const T* get_unchecked(const key_type key) const noexcept {
+            return aul::to_raw_pointer(allocation.elements + L::index(allocation.anchors[key.index]));
+        }
+
+        ///
+        /// Hints that the anchor of key will soon be read. Looking up a batch
+        /// of keys is faster when each key is prefetched several iterations
+        /// ahead of its look-up. Has no effect if key is out of range.
+        ///
+        /// \param key Key which will be looked up
+        void prefetch(const key_type key) const noexcept {
+            if (key.index < allocation.capacity) {
+                aul::prefetch(aul::to_raw_pointer(allocation.anchors + key.index));
+            }
+        }
+
+        ///
+        /// Hints that the element mapped to key will soon be read. Reads the
+        /// key's anchor, so it should be called some time after prefetch() and
+        /// some time before the look-up itself. Has no effect if key is not
+        /// valid.
+        ///
+        /// \param key Key which will be looked up
+        void prefetch_element(const key_type key) const noexcept {
+            const const_pointer p = find_element(key);
+            if (p) {
+                aul::prefetch(aul::to_raw_pointer(p));
+            }
+        }
+
         ///
         /// Undefined behavior if key is not valid
         ///
@@ -375,7 +757,7 @@ namespace aul {
         /// \return  Reference to element mapped to key x
         [[nodiscard]]
         T& operator[](const key_type key) {
-            size_type index = allocation.metadata[key.index].anchor.data();
+            size_type index = L::index(allocation.anchors[key.index]);
             return allocation.elements[index];
         }
 
@@ -386,7 +768,7 @@ namespace aul {
         /// \return  Reference to element mapped to key x
         [[nodiscard]]
         const T& operator[](const key_type key) const {
-            size_type index = allocation.metadata[key.index].anchor.data();
+            size_type index = L::index(allocation.anchors[key.index]);
             return allocation.elements[index];
         }
 
@@ -431,11 +813,17 @@ namespace aul {
                 throw std::length_error("aul::Slot_map grew beyond max size");
             }
 
-            if (size() + 1 <= capacity()) {
+            if (free_list.head != null_index) {
                 construct_element(allocation.elements + size(), std::forward<Args>(args)...);
             } else {
+                // Retired anchors may leave the free list empty before the
+                // element array is full
+                if (capacity() == max_size()) {
+                    throw std::length_error("aul::Slot_map grew beyond max size");
+                }
+
                 //Make new allocation
-                Allocation new_allocation = allocate(grow_size(size() + 1));
+                Allocation new_allocation = allocate(grow_size(capacity() + 1));
 
                 try {
                     allocator_traits::construct(allocator, new_allocation.elements + size(), std::forward<Args>(args)...);
@@ -445,22 +833,59 @@ namespace aul {
                     throw;
                 }
 
-                aul::uninitialized_move(allocation.elements, allocation.elements + size(), new_allocation.elements, allocator);
-
-                //Temporary allocator for indices
-                auto md_allocator = md_allocator_type{allocator};
+                aul::uninitialized_destructive_move(allocation.elements, allocation.elements + size(), new_allocation.elements, allocator);
 
-                free_anchor = extend_metadata(allocation, free_anchor, new_allocation, 1);
+                extend_metadata(new_allocation, 1);
 
                 deallocate(allocation);
                 allocation = std::move(new_allocation);
             }
-            md_pointer md = metadata_of(allocation.elements + size());
-            auto md_index = static_cast<size_type>(md - allocation.metadata);
 
-            ++elem_count;
+            return key_at(elem_count++);
+        }
+
+        ///
+        /// Constructs n elements at once, each from a copy of args. Memory is
+        /// reserved up front so the container reallocates at most once, and
+        /// the elements and their anchors are set up in a single pass.
+        ///
+        /// If an exception is thrown by an element's constructor, the
+        /// elements constructed by this call are destroyed and the keys
+        /// written for them are invalid.
+        ///
+        /// \tparam Args Argument types for constructor calls
+        /// \param n Number of elements to construct
+        /// \param keys Span to write the keys of the new elements to. Must
+        ///     hold at least n keys
+        /// \param args Constructor arguments for each new element
+        /// \return Iterator to the first new element. The new elements are
+        ///     contiguous and placed at the end of the container
+        template<class... Args>
+        iterator emplace_n(const size_type n, aul::Span<key_type> keys, const Args&... args) {
+            return emplace_bulk(n, keys, [&] (const pointer p) {
+                allocator_traits::construct(allocator, p, args...);
+            });
+        }
 
-            return key_type{md_index, md->anchor.version()};
+        ///
+        /// Constructs an element from each value in [begin, end). See
+        /// emplace_n().
+        ///
+        /// \tparam Fwd_iter Forward iterator type
+        /// \param begin Iterator to first value
+        /// \param end Iterator to one past the last value
+        /// \param keys Span to write the keys of the new elements to, in the
+        ///     same order as the values. Must hold at least as many keys as
+        ///     there are values
+        /// \return Iterator to the first new element
+        template<class Fwd_iter>
+        iterator emplace_range(Fwd_iter begin, Fwd_iter end, aul::Span<key_type> keys) {
+            const auto n = static_cast<size_type>(std::distance(begin, end));
+
+            return emplace_bulk(n, keys, [&] (const pointer p) {
+                allocator_traits::construct(allocator, p, *begin);
+                ++begin;
+            });
         }
 
         iterator insert(const T& v) {
@@ -481,31 +906,72 @@ namespace aul {
         /// \param key Key mapping to element if
         /// \ret True if an element was removed
         bool erase(const key_type key) noexcept {
-            md_pointer md = allocation.metadata + key.index;
-            if (md->anchor.version() != key.version) {
+            if (!contains(key)) {
                 return false;
             }
 
-            auto ptr = allocation.elements + key.index;
+            const anchor_pointer anchor = allocation.anchors + key.index;
+            erase_at(static_cast<size_type>(L::index(*anchor)), anchor);
+            return true;
+        }
 
-            pointer last_ptr = allocation.elements + size() - 1;
-            md_pointer last_md = metadata_of(last_ptr);
+        ///
+        /// Erases the elements mapped to several keys at once.
+        ///
+        /// Rather than moving the last element into each hole as it is made,
+        /// all holes are found first and the surviving elements from the end
+        /// of the array are then moved into the holes in a single sweep. Each
+        /// element is moved at most once.
+        ///
+        /// \param keys Keys mapping to elements to erase. Invalid keys and
+        ///     repeated keys are ignored
+        /// \return Number of elements removed
+        size_type erase_many(aul::Span<const key_type> keys) noexcept {
+            // Mark the positions of the elements to erase by clearing their
+            // reverse mapping. Repeated keys find their element already marked
+            size_type erase_count = 0;
+            for (const key_type& key : keys) {
+                if (!contains(key)) {
+                    continue;
+                }
 
-            *ptr = std::move(*last_ptr);
-            last_md->anchor.data() = (ptr - allocation.elements);
-            allocation.metadata[ptr - allocation.elements].anchor_index = (last_md - allocation.metadata);
+                const size_type pos = L::index(allocation.anchors[key.index]);
+                if (allocation.anchor_indices[pos] != null_index) {
+                    allocation.anchor_indices[pos] = null_index;
+                    ++erase_count;
+                }
+            }
 
-            allocator_traits::destroy(allocator, last_ptr);
+            const size_type new_size = elem_count - erase_count;
 
-            if (free_anchor) {
-                md->anchor = free_anchor - allocation.metadata;
-            }
-            else {
-                md->anchor = (md - allocation.metadata);
+            // Each hole below new_size is filled by one of the live elements
+            // at or after new_size, of which there are exactly as many. All
+            // keys which are still valid map to a marked element. Releasing
+            // their anchors invalidates any repetitions
+            size_type src = elem_count;
+            for (const key_type& key : keys) {
+                if (!contains(key)) {
+                    continue;
+                }
+
+                const anchor_pointer anchor = allocation.anchors + key.index;
+                const size_type hole = L::index(*anchor);
+                release_anchor(anchor);
+
+                if (hole < new_size) {
+                    do {
+                        --src;
+                    } while (allocation.anchor_indices[src] == null_index);
+
+                    allocation.elements[hole] = std::move(allocation.elements[src]);
+                    relink(src, hole);
+                }
             }
-            free_anchor = md;
-            --elem_count;
-            return true;
+
+            aul::destroy(allocation.elements + new_size, allocation.elements + elem_count, allocator);
+            elem_count = new_size;
+
+            return erase_count;
         }
 
         ///
@@ -513,25 +979,8 @@ namespace aul {
         ///
         void erase(const_iterator it) noexcept {
             auto ptr = const_cast<pointer>(it.operator->());
-            md_pointer md = metadata_of(ptr);
-
-            pointer last_ptr = allocation.elements + size() - 1;
-            md_pointer last_md = metadata_of(last_ptr);
-
-            *ptr = std::move(*last_ptr);
-            last_md->anchor.data() = (ptr - allocation.elements);
-            allocation.metadata[ptr - allocation.elements].anchor_index = (last_md - allocation.metadata);
-
-            allocator_traits::destroy(allocator, last_ptr);
-
-            if (free_anchor) {
-                md->anchor = free_anchor - allocation.metadata;
-            }
-            else {
-                md->anchor = (md - allocation.metadata);
-            }
-            free_anchor = md;
-            --elem_count;
+            const auto pos = static_cast<size_type>(ptr - allocation.elements);
+            erase_at(pos, anchor_of(pos));
         }
 
         //=================================================
@@ -600,9 +1049,12 @@ namespace aul {
             constexpr size_type size_type_max = std::numeric_limits<difference_type>::max();
             const size_type element_max = sizeof(value_type) * allocator_traits::max_size(allocator);
 
-            const size_type memory_max = element_max / (sizeof(value_type) + sizeof(Metadata));
+            const size_type memory_max = element_max / (sizeof(value_type) + sizeof(anchor_type) + sizeof(anchor_index_type));
+
+            // Indices must fit within an anchor, with null_index left unused
+            constexpr size_type index_max = (L::index_mask < size_type_max) ? static_cast<size_type>(L::index_mask) : size_type_max;
 
-            return std::min(size_type_max, memory_max);
+            return std::min({size_type_max, memory_max, index_max});
         }
 
         ///
@@ -625,15 +1077,12 @@ namespace aul {
             //Make new allocation
             Allocation new_allocation = allocate(n);
 
-            //Temporary allocator for indices
-            auto md_allocator = md_allocator_type{allocator};
-
             //Move contents of array if location of arrays has changed
             if (new_allocation.elements != allocation.elements) {
-                aul::uninitialized_move(allocation.elements, allocation.elements + elem_count, new_allocation.elements, allocator);
+                aul::uninitialized_destructive_move(allocation.elements, allocation.elements + elem_count, new_allocation.elements, allocator);
             }
 
-            free_anchor = extend_metadata(allocation, free_anchor, new_allocation, 0);
+            extend_metadata(new_allocation, 0);
 
             deallocate(allocation);
             allocation = std::move(new_allocation);
@@ -655,6 +1104,79 @@ namespace aul {
         ///
         void resize(const size_type n, const T& val); //TODO: Implement
 
+        //=================================================
+        // Reordering methods
+        //=================================================
+
+        ///
+        /// Sorts the elements. All keys remain valid and continue to map to
+        /// the same elements. The sort is not stable.
+        ///
+        /// The new order is determined by sorting the positions of the
+        /// elements, after which each element is moved directly into place.
+        /// This takes one move per element, plus one extra move per cycle of
+        /// the permutation through a temporary.
+        ///
+        /// If comp throws, the container is left unchanged.
+        ///
+        /// \tparam C Comparator type
+        /// \param comp Comparator object
+        template<class C = std::less<>>
+        void sort(C comp = {}) {
+            if (elem_count < 2) {
+                return;
+            }
+
+            std::vector<anchor_index_type, anchor_index_allocator_type> order(elem_count, anchor_index_type{}, anchor_index_allocator_type{allocator});
+            for (size_type i = 0; i != elem_count; ++i) {
+                order[i] = static_cast<anchor_index_type>(i);
+            }
+
+            const pointer elements = allocation.elements;
+            std::sort(order.begin(), order.end(), [&] (const anchor_index_type a, const anchor_index_type b) {
+                return comp(elements[a], elements[b]);
+            });
+
+            apply_permutation(order.data());
+        }
+
+        ///
+        /// Reorders the elements such that those for which pred returns true
+        /// precede those for which it returns false. All keys remain valid
+        /// and continue to map to the same elements. The relative order of
+        /// the elements within each group is not preserved.
+        ///
+        /// \tparam Pred Unary predicate type
+        /// \param pred Predicate object
+        /// \return Iterator to the first element of the second group
+        template<class Pred>
+        iterator partition(Pred pred) {
+            pointer first = allocation.elements;
+            pointer last = allocation.elements + elem_count;
+
+            while (true) {
+                while (first != last && pred(*first)) {
+                    ++first;
+                }
+                if (first == last) {
+                    break;
+                }
+
+                --last;
+                while (first != last && !pred(*last)) {
+                    --last;
+                }
+                if (first == last) {
+                    break;
+                }
+
+                swap_elements(first, last);
+                ++first;
+            }
+
+            return iterator{first};
+        }
+
         //=================================================
         // Comparison operators
         //=================================================
@@ -677,13 +1199,9 @@ namespace aul {
         /// \return   key corresponding to element pointed to be it
         ///
         [[nodiscard]]
-        key_type get_key(const_iterator it) noexcept {
+        key_type get_key(const_iterator it) const noexcept {
             const_pointer p = it.operator->();
-
-            const size_type x = allocation.metadata[p - allocation.elements].anchor_index;
-            const size_type y = allocation.metadata[p - allocation.elements].anchor.version();
-
-            return key_type{x, y};
+            return key_at(static_cast<size_type>(p - allocation.elements));
         }
 
         /// \param x Key to be checked
@@ -691,7 +1209,7 @@ namespace aul {
         ///
         [[nodiscard]]
         bool contains(const key_type key) const noexcept {
-            return (key.index < allocation.capacity) && (key.version == allocation.metadata[key.index].anchor.version());
+            return (key.index < allocation.capacity) && (key.version == L::version(allocation.anchors[key.index]));
         }
 
         ///
@@ -718,6 +1236,124 @@ namespace aul {
             return allocation.elements;
         }
 
+        //=================================================
+        // Snapshot methods
+        //=================================================
+
+        ///
+        /// \return Number of bytes written by snapshot()
+        [[nodiscard]]
+        size_type snapshot_size() const noexcept {
+            return static_cast<size_type>(snapshot_format::make_header(capacity(), size()).image_size);
+        }
+
+        ///
+        /// Writes a flat binary image of the container, consisting of a
+        /// Slot_map_snapshot_header followed by the raw anchors, reverse
+        /// mapping and elements. The image can be turned back into a container
+        /// by restore(), preserving all keys, or read in place through an
+        /// aul::Slot_map_snapshot_view.
+        ///
+        /// T must be trivially copyable. The image uses the native byte order
+        /// and is only meaningful to a program using the same element type
+        /// and anchor layout.
+        ///
+        /// \tparam F Invocable with a const void* and a std::size_t
+        /// \param sink Called with consecutive chunks of the image, whose
+        ///     sizes sum to snapshot_size()
+        template<class F>
+        void snapshot(F sink) const {
+            static_assert(std::is_trivially_copyable<T>::value, "aul::Slot_map snapshots require a trivially copyable element type");
+
+            Slot_map_snapshot_header header = snapshot_format::make_header(capacity(), size());
+            header.flags =
+                (P::is_fifo ? Slot_map_snapshot_header::fifo_flag : 0) |
+                (P::retires_wrapping_anchors ? Slot_map_snapshot_header::retire_flag : 0);
+            header.free_head = free_list.head;
+            header.free_tail = free_list.tail;
+            header.retired_count = free_list.retired_count;
+
+            static const unsigned char zeros[snapshot_format::alignment]{};
+            std::uint64_t offset = 0;
+
+            auto write = [&] (const void* p, const std::uint64_t n, const std::uint64_t pad_to) {
+                if (n != 0) {
+                    sink(p, static_cast<std::size_t>(n));
+                }
+                offset += n;
+
+                if (pad_to != offset) {
+                    sink(static_cast<const void*>(zeros), static_cast<std::size_t>(pad_to - offset));
+                    offset = pad_to;
+                }
+            };
+
+            write(&header, sizeof(header), header.anchors_offset);
+            write(aul::to_raw_pointer(allocation.anchors), capacity() * sizeof(anchor_type), header.anchor_indices_offset);
+            write(aul::to_raw_pointer(allocation.anchor_indices), size() * sizeof(anchor_index_type), header.elements_offset);
+            write(aul::to_raw_pointer(allocation.elements), size() * sizeof(T), header.image_size);
+        }
+
+        ///
+        /// Writes the image produced by snapshot() to a buffer
+        ///
+        /// \param buffer Pointer to at least snapshot_size() bytes
+        void snapshot_into(void* buffer) const noexcept {
+            auto* out = static_cast<unsigned char*>(buffer);
+            snapshot([&out] (const void* p, const std::size_t n) {
+                std::memcpy(out, p, n);
+                out += n;
+            });
+        }
+
+        ///
+        /// Reconstructs a container from an image produced by snapshot() in
+        /// time proportional to the image's size. All keys that were valid
+        /// for the source container are valid for the result and map to
+        /// equal elements. The image need not be aligned.
+        ///
+        /// \param image Pointer to start of image
+        /// \param bytes Number of bytes available at image
+        /// \param alloc Allocator for the new container
+        /// \return Container equivalent to the one the image was taken of
+        [[nodiscard]]
+        static Slot_map restore(const void* image, const size_type bytes, const allocator_type& alloc = {}) {
+            static_assert(std::is_trivially_copyable<T>::value, "aul::Slot_map snapshots require a trivially copyable element type");
+
+            const Slot_map_snapshot_header header = snapshot_format::read_header(image, bytes);
+
+            const std::uint32_t expected_flags =
+                (P::is_fifo ? Slot_map_snapshot_header::fifo_flag : 0) |
+                (P::retires_wrapping_anchors ? Slot_map_snapshot_header::retire_flag : 0);
+            if (header.flags != expected_flags) {
+                throw std::runtime_error("aul::Slot_map snapshot was made with a different free list policy");
+            }
+
+            const auto* bytes_in = static_cast<const unsigned char*>(image);
+
+            Slot_map ret{alloc};
+            if (header.capacity != 0) {
+                if (header.capacity > ret.max_size()) {
+                    throw std::length_error("aul::Slot_map snapshot exceeds max size");
+                }
+
+                ret.allocation = ret.allocate(static_cast<size_type>(header.capacity));
+
+                std::memcpy(aul::to_raw_pointer(ret.allocation.anchors), bytes_in + header.anchors_offset, header.capacity * sizeof(anchor_type));
+                std::memcpy(aul::to_raw_pointer(ret.allocation.anchor_indices), bytes_in + header.anchor_indices_offset, header.size * sizeof(anchor_index_type));
+                std::memcpy(static_cast<void*>(aul::to_raw_pointer(ret.allocation.elements)), bytes_in + header.elements_offset, header.size * sizeof(T));
+            }
+
+            ret.elem_count = static_cast<size_type>(header.size);
+            ret.free_list = Free_list{
+                static_cast<anchor_index_type>(header.free_head),
+                static_cast<anchor_index_type>(header.free_tail),
+                static_cast<size_type>(header.retired_count)
+            };
+
+            return ret;
+        }
+
     private:
 
         //=================================================
@@ -730,62 +1366,157 @@ namespace aul {
 
         size_type elem_count = 0;
 
-        md_pointer free_anchor = nullptr;
+        ///
+        /// Ends of the list of free anchors, linked through their index bits
+        /// and terminated by null_index
+        ///
+        struct Free_list {
+            anchor_index_type head;
+            anchor_index_type tail;
+
+            ///
+            /// Number of anchors retired by the free list policy
+            ///
+            size_type retired_count;
+        };
+
+        Free_list free_list = empty_free_list();
 
         //=================================================
         // Misc. helper methods
         //=================================================
 
         size_type grow_size(const size_type n) noexcept {
-            const size_type double_size = (max_size() / 2) < size() ? max_size() : 2 * capacity();
+            const size_type double_size = (max_size() / 2) < capacity() ? max_size() : 2 * capacity();
             return std::max(n, double_size);
         }
 
-        /// Returns the index associated with the element pointed to by ptr
+        [[nodiscard]]
+        static constexpr Free_list empty_free_list() noexcept {
+            return Free_list{null_index, null_index, 0};
+        }
+
         ///
-        /// \param Pointer to element in element array
+        /// \return Number of anchors which may be consumed without growing
+        [[nodiscard]]
+        size_type free_anchor_count() const noexcept {
+            return capacity() - size() - free_list.retired_count;
+        }
+
+        /// \param pos Position of element in element array
+        /// \return Pointer to the anchor mapped to the element at pos
+        [[nodiscard]]
+        anchor_pointer anchor_of(const size_type pos) const noexcept {
+            return allocation.anchors + allocation.anchor_indices[pos];
+        }
+
+        /// \param pos Position of element in element array
+        /// \return Key mapped to the element at pos
         [[nodiscard]]
-        md_pointer metadata_of(const_pointer ptr) const noexcept {
-            return allocation.metadata + allocation.metadata[ptr - allocation.elements].anchor;
+        key_type key_at(const size_type pos) const noexcept {
+            const anchor_index_type anchor_index = allocation.anchor_indices[pos];
+            return key_type{anchor_index, static_cast<typename L::version_type>(L::version(allocation.anchors[anchor_index]))};
+        }
+
+        /// \param key Key to look up
+        /// \return Pointer to the element mapped to key, or nullptr if key is
+        /// not valid
+        [[nodiscard]]
+        pointer find_element(const key_type key) const noexcept {
+            if (key.index >= allocation.capacity) {
+                return nullptr;
+            }
+
+            const anchor_type anchor = allocation.anchors[key.index];
+            return (L::version(anchor) == key.version) ? allocation.elements + L::index(anchor) : nullptr;
         }
 
         //=================================================
         // Anchor index helper methods
         //=================================================
 
-        /// Takes free index and populates it, making it point to the position
-        /// indicated by pos.
+        /// Takes the anchor at the head of the free list and makes it point
+        /// to the position indicated by pos.
         ///
-        /// \pre An index that is free must exist. i.e. free_index != nullptr
-        /// \param pos Index of element to be held yb metadata
-        /// \return Pointer to index that has been consumed.
+        /// \pre The free list is not empty. i.e. free_list.head != null_index
+        /// \param pos Index of element to be held by metadata
         ///
         void consume_anchor(const size_type pos) noexcept {
-            const md_pointer free_ptr = free_anchor;
+            const anchor_index_type anchor_index = free_list.head;
+            anchor_type& anchor = allocation.anchors[anchor_index];
 
-            //If free list terminates, assign nullptr to free_index, otherwise
-            //assign the next node.
-            auto free_achor_index = (free_ptr - allocation.metadata);
-            if (free_ptr->anchor == free_achor_index) {
-                free_anchor = nullptr;
-            } else {
-                free_anchor = allocation.metadata + (free_ptr->anchor);
+            free_list.head = static_cast<anchor_index_type>(L::index(anchor));
+            if constexpr (P::is_fifo) {
+                if (free_list.head == null_index) {
+                    free_list.tail = null_index;
+                }
             }
 
-            free_ptr->anchor.data() = pos;
-            allocation.metadata[pos].anchor_index = (free_ptr - allocation.metadata);
+            anchor = L::with_index(anchor, static_cast<anchor_type>(pos));
+            allocation.anchor_indices[pos] = anchor_index;
         }
 
-        /// Frees index pointed to by ptr and pushes it onto list of free
-        /// indices. Increments index version.
+        /// Frees the anchor pointed to by ptr and adds it to the free list, or
+        /// retires it if the policy requires. Increments the anchor's version.
         ///
-        void release_anchor(const md_pointer ptr) noexcept {
-            if (free_anchor) {
-                *ptr = free_anchor - allocation.metadata;
+        void release_anchor(const anchor_pointer ptr) noexcept {
+            const auto anchor_index = static_cast<anchor_index_type>(ptr - allocation.anchors);
+            const anchor_type version = L::version(*ptr);
+
+            if constexpr (P::retires_wrapping_anchors) {
+                if (version == L::version_max) {
+                    // Version 0 is never handed out under this policy, so no
+                    // key matches a retired anchor
+                    *ptr = L::make(static_cast<anchor_type>(null_index), 0);
+                    ++free_list.retired_count;
+                    return;
+                }
+            }
+
+            const auto next_version = static_cast<anchor_type>(version + 1);
+
+            if constexpr (P::is_fifo) {
+                *ptr = L::make(static_cast<anchor_type>(null_index), next_version);
+
+                if (free_list.tail == null_index) {
+                    free_list.head = anchor_index;
+                } else {
+                    anchor_type& tail = allocation.anchors[free_list.tail];
+                    tail = L::with_index(tail, static_cast<anchor_type>(anchor_index));
+                }
+                free_list.tail = anchor_index;
             } else {
-                *ptr = ptr - allocation.metadata;
+                *ptr = L::make(static_cast<anchor_type>(free_list.head), next_version);
+                free_list.head = anchor_index;
             }
-            free_anchor = ptr;
+        }
+
+        ///
+        /// Erases the element at pos, moving the last element into its place
+        ///
+        /// \param pos Position of element to erase
+        /// \param anchor Anchor mapped to the element at pos
+        void erase_at(const size_type pos, const anchor_pointer anchor) noexcept {
+            const size_type last = size() - 1;
+            if (pos != last) {
+                allocation.elements[pos] = std::move(allocation.elements[last]);
+                relink(last, pos);
+            }
+
+            allocator_traits::destroy(allocator, allocation.elements + last);
+
+            release_anchor(anchor);
+            --elem_count;
+        }
+
+        /// Updates the anchor of the element which was moved from position
+        /// from to position to, as well as the reverse mapping.
+        ///
+        void relink(const size_type from, const size_type to) noexcept {
+            const anchor_index_type anchor_index = allocation.anchor_indices[from];
+
+            allocation.anchors[anchor_index] = L::with_index(allocation.anchors[anchor_index], static_cast<anchor_type>(to));
+            allocation.anchor_indices[to] = anchor_index;
         }
 
         //=================================================
@@ -793,53 +1524,48 @@ namespace aul {
         //=================================================
 
         ///
-        /// Construct n metadata objects for n elements.
+        /// Copies anchors and the reverse mapping of the first n elements from
+        /// one allocation to another of equal capacity
         ///
-        /// \param n Number of new metadata objects to construct. Must be at least 1
-        void generate_metadata(const size_type n) noexcept {
-            auto md_allocator = md_allocator_type{allocator};
-
-            for (size_type i = 0; i != n; ++i) {
-                md_allocator_traits::construct(md_allocator, allocation.metadata + i, i, i);
-            }
-
-            free_anchor = nullptr;
+        static void copy_metadata(const Allocation& from, Allocation& to, const size_type n) noexcept {
+            std::copy_n(from.anchors, from.capacity, to.anchors);
+            std::copy_n(from.anchor_indices, n, to.anchor_indices);
         }
 
         ///
-        /// \param a Allocation to move metadata into and then extend. Capacity
-        /// must be greater than that of current allocation
-        /// \param n Number of elements to create metadata for.
-        /// \return Pointer to free anchor point
-        md_pointer extend_metadata(Allocation& from, md_pointer old_free, Allocation& to, const size_type n = 0) noexcept {
-            auto md_allocator = md_allocator_type{allocator};
+        /// Moves the current anchors and reverse mapping into to, then sets up
+        /// the anchors beyond the current capacity.
+        ///
+        /// \param to Allocation to move metadata into and then extend.
+        /// Capacity must be greater than that of current allocation
+        /// \param n Number of new anchors to map to the elements placed
+        /// directly after the current size
+        void extend_metadata(Allocation& to, const size_type n = 0) noexcept {
+            const size_type old_capacity = allocation.capacity;
 
-            //Move originals
-            for (size_type i = 0; i < from.capacity; ++i) {
-                md_allocator_traits::construct(md_allocator, to.metadata + i, std::move(from.metadata[i]));
-                md_allocator_traits::destroy(md_allocator, from.metadata + i);
-            }
+            std::copy_n(allocation.anchors, old_capacity, to.anchors);
+            std::copy_n(allocation.anchor_indices, elem_count, to.anchor_indices);
 
             //Construct new anchors for n elements
-            for (size_type i = from.capacity; i != (from.capacity + n); ++i) {
-                md_allocator_traits::construct(md_allocator, to.metadata + i, i, i);
+            for (size_type i = 0; i != n; ++i) {
+                to.anchors[old_capacity + i] = L::make(static_cast<anchor_type>(elem_count + i), 1);
+                to.anchor_indices[elem_count + i] = static_cast<anchor_index_type>(old_capacity + i);
             }
 
-            //Construct unused anchors
-            for (size_type i = from.capacity + n; i < (to.capacity - 1); ++i) {
-                md_allocator_traits::construct(md_allocator, to.metadata + i, i + 1);
+            if (n == (to.capacity - old_capacity)) {
+                return;
             }
 
-            md_pointer new_free_anchor;
-            if (n == (to.capacity - from.capacity)) {
-                new_free_anchor = old_free;
-            } else {
-                size_type old_free_index = (old_free) ? (old_free - from.metadata) : (to.capacity - 1);
-                md_allocator_traits::construct(md_allocator, to.metadata + to.capacity - 1, old_free_index);
-                new_free_anchor = to.metadata + from.capacity + n;
+            //Thread unused anchors onto the front of the free list
+            for (size_type i = old_capacity + n; i < (to.capacity - 1); ++i) {
+                to.anchors[i] = L::make(static_cast<anchor_type>(i + 1), 1);
             }
+            to.anchors[to.capacity - 1] = L::make(static_cast<anchor_type>(free_list.head), 1);
 
-            return new_free_anchor;
+            if (free_list.head == null_index) {
+                free_list.tail = static_cast<anchor_index_type>(to.capacity - 1);
+            }
+            free_list.head = static_cast<anchor_index_type>(old_capacity + n);
         }
 
         /// Destroys the element pointed to by p through the allocator and
@@ -847,8 +1573,7 @@ namespace aul {
         /// \param p Pointer to element to be destroyed.
         ///
         void destroy_element(pointer p) noexcept {
-            md_pointer md = metadata_of(p);
-            release_anchor(md);
+            release_anchor(anchor_of(static_cast<size_type>(p - allocation.elements)));
             allocator_traits::destroy(allocator, p);
         }
 
@@ -865,91 +1590,176 @@ namespace aul {
             allocator_traits::construct(allocator, pos, std::forward<Args>(args)...);
         }
 
-        /// Move assigns an element within the container from it's current
-        /// position to dest, updates its index, and updates the erase value.
-        /// Assumes that dest points to a position in data[] that is currently
-        /// being used by an element.
-        void move_assign_element(pointer from, pointer dest) {
-            *dest = std::move(*from);
-            metadata_of(dest)->anchor = metadata_of(from)->anchor;
-            release_anchor(metadata_of(dest));
+        ///
+        /// Common implementation of emplace_n() and emplace_range()
+        ///
+        /// \param n Number of elements to construct
+        /// \param keys Span to write keys of new elements to
+        /// \param construct Invocable taking a pointer to uninitialized
+        ///     memory which constructs the next new element there
+        /// \return Iterator to first new element
+        template<class F>
+        iterator emplace_bulk(const size_type n, aul::Span<key_type> keys, F construct) {
+            if (keys.size() < n) {
+                throw std::length_error("aul::Slot_map bulk emplace given output span smaller than element count");
+            }
+
+            if (max_size() - size() < n) {
+                throw std::length_error("aul::Slot_map grew beyond max size");
+            }
+
+            if (free_anchor_count() < n) {
+                reserve(grow_size(capacity() + (n - free_anchor_count())));
+            }
+
+            const pointer first = allocation.elements + size();
+
+            size_type i = 0;
+            try {
+                for (; i != n; ++i) {
+                    construct(first + i);
+                    consume_anchor(size() + i);
+
+                    keys[i] = key_at(size() + i);
+                }
+            } catch (...) {
+                while (i != 0) {
+                    --i;
+                    destroy_element(first + i);
+                }
+
+                throw;
+            }
+
+            elem_count += n;
+
+            return iterator{first};
+        }
+
+        ///
+        /// Moves elements such that the element at position order[i] ends up
+        /// at position i, updating anchors and reverse mappings to match.
+        /// order is left as the identity permutation.
+        ///
+        /// \param order Permutation of the positions [0, size())
+        void apply_permutation(anchor_index_type* order) noexcept {
+            for (size_type i = 0; i != elem_count; ++i) {
+                if (order[i] == i) {
+                    continue;
+                }
+
+                // Follow the cycle starting at i, pulling each element into
+                // the position vacated by the previous one
+                T tmp = std::move(allocation.elements[i]);
+                const anchor_index_type tmp_anchor_index = allocation.anchor_indices[i];
+
+                size_type dest = i;
+                while (true) {
+                    const size_type src = order[dest];
+                    order[dest] = static_cast<anchor_index_type>(dest);
+
+                    if (src == i) {
+                        allocation.elements[dest] = std::move(tmp);
+                        allocation.anchor_indices[dest] = tmp_anchor_index;
+                        allocation.anchors[tmp_anchor_index] = L::with_index(allocation.anchors[tmp_anchor_index], static_cast<anchor_type>(dest));
+                        break;
+                    }
+
+                    allocation.elements[dest] = std::move(allocation.elements[src]);
+                    relink(src, dest);
+                    dest = src;
+                }
+            }
         }
 
         /// Swaps the position of two elements along with their associated
-        /// erase and index values.
+        /// anchors and reverse mappings.
         ///
         void swap_elements(pointer a, pointer b) noexcept {
-            std::swap(metadata_of(a)->anchor_index, metadata_of(b)->anchor_index);
-            std::swap(*a, *b);
+            const auto pos_a = static_cast<size_type>(a - allocation.elements);
+            const auto pos_b = static_cast<size_type>(b - allocation.elements);
+
+            const anchor_index_type anchor_index_a = allocation.anchor_indices[pos_a];
+            const anchor_index_type anchor_index_b = allocation.anchor_indices[pos_b];
+
+            allocation.anchors[anchor_index_a] = L::with_index(allocation.anchors[anchor_index_a], static_cast<anchor_type>(pos_b));
+            allocation.anchors[anchor_index_b] = L::with_index(allocation.anchors[anchor_index_b], static_cast<anchor_type>(pos_a));
+            allocation.anchor_indices[pos_a] = anchor_index_b;
+            allocation.anchor_indices[pos_b] = anchor_index_a;
+
+            using std::swap;
+            swap(*a, *b);
         }
 
         //=================================================
         // Allocation helper methods
         //=================================================
 
+        ///
+        /// The anchors and reverse mapping are arrays of unsigned integers
+        /// which are assigned to directly rather than constructed through
+        /// their allocators.
+        ///
+        /// \param n Number of elements to allocate memory for
+        /// \return Allocation object for new object
         [[nodiscard]]
         Allocation allocate(const size_type n) {
             Allocation ret{};
-            auto md_allocator = md_allocator_type{allocator};
+            auto anchor_allocator = anchor_allocator_type{allocator};
+            auto anchor_index_allocator = anchor_index_allocator_type{allocator};
 
             try {
                 ret.elements = allocator_traits::allocate(allocator, n);
-                ret.metadata = md_allocator_traits::allocate(md_allocator, n);
+                ret.anchors = anchor_allocator_traits::allocate(anchor_allocator, n);
+                ret.anchor_indices = anchor_index_allocator_traits::allocate(anchor_index_allocator, n);
                 ret.capacity = n;
             } catch (...) {
-                allocator_traits::deallocate(allocator, ret.elements, n);
-                md_allocator_traits::deallocate(md_allocator, ret.metadata, n);
-                ret = {};
-                throw;
-            }
-
-            return ret;
-        }
-
-        /// \param n     Number of elements to allocate memory for
-        /// \param alloc Allocator
-        /// \return      Allocation object for new object
-        [[nodiscard]]
-        Allocation allocate(const size_type n, const Allocation& hint) {
-            Allocation ret{};
-            auto md_allocator = md_allocator_type{allocator};
-
-            try {
-                ret.elements = allocator_traits::allocate(allocator, n, hint.elements);
-                ret.metadata = md_allocator_traits::allocate(md_allocator, n, hint.metadata);
                 ret.capacity = n;
-
-            } catch (...) {
-                allocator_traits::deallocate(allocator, ret.elements, n);
-                md_allocator_traits::deallocate(md_allocator, ret.metadata, n);
-                ret = {};
-
+                deallocate(ret);
                 throw;
             }
 
             return ret;
         }
 
-        void deallocate(Allocation& a) {
-            auto md_allocator = md_allocator_type{allocator};
+        void deallocate(Allocation& a) noexcept {
+            auto anchor_allocator = anchor_allocator_type{allocator};
+            auto anchor_index_allocator = anchor_index_allocator_type{allocator};
 
-            allocator_traits::deallocate(allocator, a.elements, a.capacity);
-            md_allocator_traits::deallocate(md_allocator, a.metadata, a.capacity);
+            if (a.elements) {
+                allocator_traits::deallocate(allocator, a.elements, a.capacity);
+            }
+            if (a.anchors) {
+                anchor_allocator_traits::deallocate(anchor_allocator, a.anchors, a.capacity);
+            }
+            if (a.anchor_indices) {
+                anchor_index_allocator_traits::deallocate(anchor_index_allocator, a.anchor_indices, a.capacity);
+            }
 
             a = {};
         }
 
     };
 
-    template<class T, class A>
-    class Slot_map<T, A>::Allocation {
+    template<class T, class A, class L, class P>
+    class Slot_map<T, A, L, P>::Allocation {
     public:
 
         //=============================================
         // Instance variables
         //=============================================
 
-        md_pointer metadata = nullptr;
+        ///
+        /// Packed position and version of each key's element. The only
+        /// metadata read when looking up a key
+        ///
+        anchor_pointer anchors = nullptr;
+
+        ///
+        /// Index of the anchor mapped to each element
+        ///
+        anchor_index_pointer anchor_indices = nullptr;
+
         pointer elements = nullptr;
 
         size_type capacity = 0;
@@ -963,7 +1773,8 @@ namespace aul {
         Allocation(const Allocation&) = delete;
 
         Allocation(Allocation&& alloc) noexcept :
-            metadata(std::move(alloc.metadata)),
+            anchors(std::move(alloc.anchors)),
+            anchor_indices(std::move(alloc.anchor_indices)),
             elements(std::move(alloc.elements)),
             capacity(std::move(alloc.capacity)) {
 
@@ -979,12 +1790,14 @@ namespace aul {
         Allocation& operator=(const Allocation&) = delete;
 
         Allocation& operator=(Allocation&& alloc) noexcept {
-            metadata = std::move(alloc.metadata);
+            anchors = std::move(alloc.anchors);
+            anchor_indices = std::move(alloc.anchor_indices);
             elements = std::move(alloc.elements);
 
             capacity = std::move(alloc.capacity);
 
-            alloc.metadata = nullptr;
+            alloc.anchors = nullptr;
+            alloc.anchor_indices = nullptr;
             alloc.elements = nullptr;
             alloc.capacity = 0;
 
@@ -993,41 +1806,174 @@ namespace aul {
 
     };
 
-    template<class T, class A>
-    class Slot_map<T, A>::Metadata {
+
+    ///
+    /// Read-only view of a Slot_map image produced by Slot_map::snapshot().
+    ///
+    /// Keys are looked up directly within the image, so a snapshot file
+    /// which has been memory-mapped can be queried without first being
+    /// restored into a container. Only the pages which are touched are read
+    /// from disk.
+    ///
+    /// The image must remain alive and unmodified for the lifetime of the
+    /// view and must be aligned to impl::Slot_map_snapshot_format<T, L>
+    /// ::alignment, which a page-aligned mapping always is.
+    ///
+    /// \tparam T Element type of the container the image was taken of
+    /// \tparam L Anchor layout of the container the image was taken of
+    template<class T, class L = Slot_map_anchor_layout<>>
+    class Slot_map_snapshot_view {
+        using snapshot_format = impl::Slot_map_snapshot_format<T, L>;
+
+        using anchor_type = typename L::word_type;
+        using anchor_index_type = typename L::index_type;
+
     public:
 
-        //=============================================
+        //=================================================
+        // Type aliases
+        //=================================================
+
+        using value_type = T;
+        using size_type = std::size_t;
+
+        using key_type = Slot_map_key<typename L::index_type, typename L::version_type>;
+
+        using const_reference = const T&;
+        using const_pointer = const T*;
+        using const_iterator = const T*;
+
+        //=================================================
         // -ctors
-        //=============================================
+        //=================================================
 
-        Metadata() = default;
+        ///
+        /// \param image Pointer to start of image
+        /// \param bytes Number of bytes available at image
+        Slot_map_snapshot_view(const void* image, const size_type bytes) {
+            if (reinterpret_cast<std::uintptr_t>(image) % snapshot_format::alignment != 0) {
+                throw std::runtime_error("aul::Slot_map_snapshot_view given misaligned image");
+            }
 
-        Metadata(const size_type anchor):
-            anchor(anchor, 1) {}
+            const Slot_map_snapshot_header header = snapshot_format::read_header(image, bytes);
+            const auto* base = static_cast<const unsigned char*>(image);
 
-        Metadata(const size_type anchor, const size_type i):
-            anchor_index(i),
-            anchor(anchor, 1) {}
+            anchors = reinterpret_cast<const anchor_type*>(base + header.anchors_offset);
+            anchor_indices = reinterpret_cast<const anchor_index_type*>(base + header.anchor_indices_offset);
+            elements = reinterpret_cast<const T*>(base + header.elements_offset);
 
-        Metadata(const Metadata&) = default;
-        Metadata(Metadata&&) = default;
+            elem_count = static_cast<size_type>(header.size);
+            anchor_count = static_cast<size_type>(header.capacity);
+        }
 
-        ~Metadata() = default;
+        Slot_map_snapshot_view() = default;
+        Slot_map_snapshot_view(const Slot_map_snapshot_view&) = default;
+        ~Slot_map_snapshot_view() = default;
 
-        //=============================================
+        //=================================================
         // Assignment operators
-        //=============================================
+        //=================================================
 
-        Metadata& operator=(const Metadata&) = default;
-        Metadata& operator=(Metadata&&) = default;
+        Slot_map_snapshot_view& operator=(const Slot_map_snapshot_view&) = default;
 
-        //=============================================
+        //=================================================
+        // Element access
+        //=================================================
+
+        ///
+        /// \param key Key mapped to desired element
+        /// \return Pointer to element mapped to key or nullptr if key was
+        /// not valid when the image was taken
+        [[nodiscard]]
+        const T* get_if(const key_type key) const noexcept {
+            if (key.index >= anchor_count) {
+                return nullptr;
+            }
+
+            const anchor_type anchor = anchors[key.index];
+            return (L::version(anchor) == key.version) ? elements + L::index(anchor) : nullptr;
+        }
+
+        ///
+        /// Undefined behavior if key is not valid
+        ///
+        /// \param key Key mapped to desired element
+        /// \return Reference to element mapped to key
+        [[nodiscard]]
+        const T& operator[](const key_type key) const noexcept {
+            return elements[L::index(anchors[key.index])];
+        }
+
+        /// \param key Key mapped to desired element
+        /// \return Reference to element mapped to key
+        [[nodiscard]]
+        const T& at(const key_type key) const {
+            const T* p = get_if(key);
+            if (!p) {
+                throw std::runtime_error("aul::Slot_map_snapshot_view::at() called with invalid key");
+            }
+
+            return *p;
+        }
+
+        [[nodiscard]]
+        bool contains(const key_type key) const noexcept {
+            return get_if(key) != nullptr;
+        }
+
+        /// \param it Iterator to element
+        /// \return Key corresponding to element pointed to by it
+        [[nodiscard]]
+        key_type get_key(const const_iterator it) const noexcept {
+            const anchor_index_type i = anchor_indices[it - elements];
+            return key_type{i, static_cast<typename L::version_type>(L::version(anchors[i]))};
+        }
+
+        //=================================================
+        // Iterator methods
+        //=================================================
+
+        [[nodiscard]]
+        const_iterator begin() const noexcept {
+            return elements;
+        }
+
+        [[nodiscard]]
+        const_iterator end() const noexcept {
+            return elements + elem_count;
+        }
+
+        //=================================================
+        // Size methods
+        //=================================================
+
+        [[nodiscard]]
+        size_type size() const noexcept {
+            return elem_count;
+        }
+
+        [[nodiscard]]
+        bool empty() const noexcept {
+            return elem_count == 0;
+        }
+
+        [[nodiscard]]
+        const T* data() const noexcept {
+            return elements;
+        }
+
+    private:
+
+        //=================================================
         // Instance members
-        //=============================================
+        //=================================================
+
+        const anchor_type* anchors = nullptr;
+        const anchor_index_type* anchor_indices = nullptr;
+        const T* elements = nullptr;
 
-        size_type anchor_index = 0;
-        aul::Versioned_type<size_type, size_type> anchor{0, 1};
+        size_type elem_count = 0;
+        size_type anchor_count = 0;
 
     };
 
@@ -0,0 +1,975 @@
+#ifndef AUL_SOA_SLOT_MAP_HPP
+#define AUL_SOA_SLOT_MAP_HPP
+
+#include "Slot_map.hpp"
+#include "Zipper_iterator.hpp"
+#include "../Span.hpp"
+#include "../memory/Memory.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace aul {
+
+    namespace impl {
+
+        ///
+        /// Types derived from the members of a tuple-like type T, each of which
+        /// is stored in its own array by aul::Soa_slot_map
+        ///
+        template<class T, class Seq = std::make_index_sequence<std::tuple_size<T>::value>>
+        struct Soa_columns;
+
+        template<class T, std::size_t...Is>
+        struct Soa_columns<T, std::index_sequence<Is...>> {
+            using pointers = std::tuple<std::tuple_element_t<Is, T>*...>;
+
+            using reference = std::tuple<std::tuple_element_t<Is, T>&...>;
+            using const_reference = std::tuple<const std::tuple_element_t<Is, T>&...>;
+
+            using iterator = Random_access_zipper_iterator<std::tuple_element_t<Is, T>*...>;
+            using const_iterator = Random_access_zipper_iterator<const std::tuple_element_t<Is, T>*...>;
+        };
+
+    }
+
+    ///
+    /// Soa_slot_map
+    ///
+    /// A variant of aul::Slot_map which stores each member of its elements in
+    /// a separate contiguous array, i.e. in structure-of-arrays form. Keys and
+    /// their invalidation rules are the same as those of aul::Slot_map.
+    ///
+    /// Where a loop only touches some members of the elements, iterating over
+    /// the arrays holding just those members via column() or columns() avoids
+    /// loading the remaining members into cache.
+    ///
+    /// The i'th elements of all arrays together form one element of the
+    /// container. Iterators dereference to tuples of references to these.
+    ///
+    /// Anchors are packed into words as described by L, exactly as in
+    /// aul::Slot_map, so both containers have the same key_type for a given
+    /// layout. Anchors of erased elements are reused most recently freed
+    /// first.
+    ///
+    /// \tparam T Tuple-like type, e.g. std::tuple or std::pair, with at least
+    ///     two members. Must support std::tuple_size, std::tuple_element, and
+    ///     std::get
+    /// \tparam A Allocator type. Rebound to each of T's member types
+    /// \tparam L Anchor layout. See aul::Slot_map_anchor_layout
+    template<class T, class A = std::allocator<T>, class L = Slot_map_anchor_layout<>>
+    class Soa_slot_map {
+
+        static_assert(
+            std::tuple_size<T>::value >= 2,
+            "aul::Soa_slot_map requires a tuple-like type with at least two "
+            "members. Use aul::Slot_map otherwise."
+        );
+
+        //=================================================
+        // Helper classes
+        //=================================================
+
+        class Allocation;
+
+        //=================================================
+        // Type aliases
+        //=================================================
+
+    public:
+
+        using allocator_type = A;
+
+        using size_type = typename std::allocator_traits<A>::size_type;
+        using difference_type = typename std::allocator_traits<A>::difference_type;
+
+        using value_type = T;
+        using key_type = Slot_map_key<typename L::index_type, typename L::version_type>;
+
+        template<std::size_t I>
+        using column_type = std::tuple_element_t<I, T>;
+
+        using reference = typename impl::Soa_columns<T>::reference;
+        using const_reference = typename impl::Soa_columns<T>::const_reference;
+
+        using iterator = typename impl::Soa_columns<T>::iterator;
+        using const_iterator = typename impl::Soa_columns<T>::const_iterator;
+
+        using anchor_layout = L;
+
+        ///
+        /// Number of members in T, and therefore number of arrays
+        ///
+        static constexpr std::size_t column_count = std::tuple_size<T>::value;
+
+    private:
+
+        using column_indices = std::make_index_sequence<column_count>;
+
+        template<std::size_t I>
+        using column_allocator_type = typename std::allocator_traits<A>::template rebind_alloc<column_type<I>>;
+
+        using anchor_type = typename L::word_type;
+        using anchor_index_type = typename L::index_type;
+
+        using anchor_allocator_type = typename std::allocator_traits<A>::template rebind_alloc<anchor_type>;
+        using anchor_allocator_traits = std::allocator_traits<anchor_allocator_type>;
+
+        using anchor_index_allocator_type = typename std::allocator_traits<A>::template rebind_alloc<anchor_index_type>;
+        using anchor_index_allocator_traits = std::allocator_traits<anchor_index_allocator_type>;
+
+        ///
+        /// Value of an anchor index which does not refer to any anchor. As
+        /// max_size() is below it, no anchor or element has this index
+        ///
+        static constexpr anchor_index_type null_index = static_cast<anchor_index_type>(L::index_mask);
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+    public:
+
+        ///
+        /// Default constructor
+        ///
+        Soa_slot_map() noexcept(noexcept(allocator_type{})) = default;
+
+        ///
+        /// \param alloc Allocator to copy-construct internal allocators from
+        ///
+        explicit Soa_slot_map(const allocator_type& alloc):
+            allocator(alloc) {}
+
+        ///
+        /// \param src Source object
+        ///
+        Soa_slot_map(const Soa_slot_map& src):
+            Soa_slot_map(src, std::allocator_traits<A>::select_on_container_copy_construction(src.allocator)) {}
+
+        ///
+        /// If copying an element throws, the elements which were already
+        /// copied are destroyed and the allocation is released before the
+        /// exception is propagated.
+        ///
+        /// \param src Source object
+        /// \param alloc Source for copy-construction of internal allocators
+        Soa_slot_map(const Soa_slot_map& src, const allocator_type& alloc):
+            allocator(alloc),
+            allocation(allocate(src.allocation.capacity)),
+            elem_count(src.elem_count),
+            free_anchor(src.free_anchor) {
+
+            try {
+                copy_columns<0, false>(src.allocation, allocation);
+            } catch (...) {
+                deallocate(allocation);
+                throw;
+            }
+
+            std::copy_n(src.allocation.anchors, capacity(), allocation.anchors);
+            std::copy_n(src.allocation.anchor_indices, elem_count, allocation.anchor_indices);
+        }
+
+        ///
+        /// \param src Source object
+        ///
+        Soa_slot_map(Soa_slot_map&& src) noexcept:
+            allocator(std::move(src.allocator)),
+            allocation(std::move(src.allocation)),
+            elem_count(std::exchange(src.elem_count, 0)),
+            free_anchor(std::exchange(src.free_anchor, null_index)) {}
+
+        ///
+        /// Destructor
+        ///
+        ~Soa_slot_map() {
+            clear();
+        }
+
+        //=================================================
+        // Assignment operators
+        //=================================================
+
+        ///
+        /// \param src Source object
+        /// \return Current object
+        Soa_slot_map& operator=(const Soa_slot_map& src) {
+            if (this == &src) {
+                return *this;
+            }
+
+            constexpr bool propagate = std::allocator_traits<A>::propagate_on_container_copy_assignment::value;
+
+            Soa_slot_map tmp{src, propagate ? src.allocator : allocator};
+            if constexpr (propagate) {
+                clear();
+                allocator = src.allocator;
+            }
+            swap_contents(tmp);
+
+            return *this;
+        }
+
+        ///
+        /// \param src Source object
+        /// \return Current object
+        Soa_slot_map& operator=(Soa_slot_map&& src) noexcept {
+            if (this == &src) {
+                return *this;
+            }
+
+            clear();
+
+            if constexpr (std::allocator_traits<A>::propagate_on_container_move_assignment::value) {
+                allocator = std::move(src.allocator);
+            }
+
+            swap_contents(src);
+
+            return *this;
+        }
+
+        //=================================================
+        // Element access
+        //=================================================
+
+        ///
+        /// Undefined behavior if key is not valid
+        ///
+        /// \param key Key mapped to desired element
+        /// \return Tuple of references to the members of the element
+        [[nodiscard]]
+        reference operator[](const key_type key) {
+            return row(L::index(allocation.anchors[key.index]), column_indices{});
+        }
+
+        ///
+        /// Undefined behavior if key is not valid
+        ///
+        /// \param key Key mapped to desired element
+        /// \return Tuple of references to the members of the element
+        [[nodiscard]]
+        const_reference operator[](const key_type key) const {
+            return row(L::index(allocation.anchors[key.index]), column_indices{});
+        }
+
+        ///
+        /// \param key Key mapped to desired element
+        /// \return Tuple of references to the members of the element
+        [[nodiscard]]
+        reference at(const key_type key) {
+            if (!contains(key)) {
+                throw std::runtime_error("aul::Soa_slot_map::at() called with invalid key");
+            }
+
+            return operator[](key);
+        }
+
+        ///
+        /// \param key Key mapped to desired element
+        /// \return Tuple of references to the members of the element
+        [[nodiscard]]
+        const_reference at(const key_type key) const {
+            if (!contains(key)) {
+                throw std::runtime_error("aul::Soa_slot_map::at() called with invalid key");
+            }
+
+            return operator[](key);
+        }
+
+        ///
+        /// Undefined behavior if key is not valid
+        ///
+        /// \tparam I Index of member to access
+        /// \param key Key mapped to desired element
+        /// \return Reference to the I'th member of the element
+        template<std::size_t I>
+        [[nodiscard]]
+        column_type<I>& get(const key_type key) {
+            return std::get<I>(allocation.columns)[L::index(allocation.anchors[key.index])];
+        }
+
+        ///
+        /// Undefined behavior if key is not valid
+        ///
+        /// \tparam I Index of member to access
+        /// \param key Key mapped to desired element
+        /// \return Reference to the I'th member of the element
+        template<std::size_t I>
+        [[nodiscard]]
+        const column_type<I>& get(const key_type key) const {
+            return std::get<I>(allocation.columns)[L::index(allocation.anchors[key.index])];
+        }
+
+        //=================================================
+        // Column access
+        //=================================================
+
+        ///
+        /// \tparam I Index of member
+        /// \return Span over the array holding the I'th member of all elements
+        template<std::size_t I>
+        [[nodiscard]]
+        aul::Span<column_type<I>> column() noexcept {
+            return aul::Span<column_type<I>>{std::get<I>(allocation.columns), elem_count};
+        }
+
+        ///
+        /// \tparam I Index of member
+        /// \return Span over the array holding the I'th member of all elements
+        template<std::size_t I>
+        [[nodiscard]]
+        aul::Span<const column_type<I>> column() const noexcept {
+            return aul::Span<const column_type<I>>{std::get<I>(allocation.columns), elem_count};
+        }
+
+        ///
+        /// \tparam Is Indices of at least two members
+        /// \return Multispan over the arrays holding the selected members
+        template<std::size_t...Is>
+        [[nodiscard]]
+        aul::Multispan<column_type<Is>...> columns() noexcept {
+            static_assert(sizeof...(Is) >= 2, "Use column() to access a single member");
+            return aul::Multispan<column_type<Is>...>{elem_count, std::get<Is>(allocation.columns)...};
+        }
+
+        ///
+        /// \tparam Is Indices of at least two members
+        /// \return Multispan over the arrays holding the selected members
+        template<std::size_t...Is>
+        [[nodiscard]]
+        aul::Multispan<const column_type<Is>...> columns() const noexcept {
+            static_assert(sizeof...(Is) >= 2, "Use column() to access a single member");
+            return aul::Multispan<const column_type<Is>...>{elem_count, static_cast<const column_type<Is>*>(std::get<Is>(allocation.columns))...};
+        }
+
+        //=================================================
+        // Element addition
+        //=================================================
+
+        ///
+        /// Constructs a new element, constructing each of its members from
+        /// the corresponding argument
+        ///
+        /// \tparam Args Argument types. There must be exactly one per member
+        /// \param args Arguments to construct each member from
+        /// \return Key mapped to new element
+        template<class...Args>
+        key_type emplace(Args&&...args) {
+            static_assert(sizeof...(Args) == column_count, "aul::Soa_slot_map::emplace requires one argument per member");
+
+            if (size() == max_size()) {
+                throw std::length_error("aul::Soa_slot_map grew beyond max size");
+            }
+
+            if (size() == capacity()) {
+                reserve(grow_size(size() + 1));
+            }
+
+            construct_row<0>(elem_count, std::forward<Args>(args)...);
+
+            return consume_anchor(elem_count++);
+        }
+
+        ///
+        /// \param v Element to copy members from
+        /// \return Key mapped to new element
+        key_type insert(const T& v) {
+            return insert_impl(v, column_indices{});
+        }
+
+        ///
+        /// \param v Element to move members from
+        /// \return Key mapped to new element
+        key_type insert(T&& v) {
+            return insert_impl(std::move(v), column_indices{});
+        }
+
+        //=================================================
+        // Element removal
+        //=================================================
+
+        ///
+        /// Moves the last element into the position of the erased element
+        ///
+        /// \param key Key mapping to element to erase
+        /// \return True if an element was removed
+        bool erase(const key_type key) noexcept {
+            if (!contains(key)) {
+                return false;
+            }
+
+            const size_type pos = L::index(allocation.anchors[key.index]);
+            const size_type last = elem_count - 1;
+
+            if (pos != last) {
+                move_row(last, pos, column_indices{});
+
+                const anchor_index_type moved_anchor = allocation.anchor_indices[last];
+                allocation.anchors[moved_anchor] = L::with_index(allocation.anchors[moved_anchor], static_cast<anchor_type>(pos));
+                allocation.anchor_indices[pos] = moved_anchor;
+            }
+
+            destroy_row(last, column_indices{});
+            release_anchor(key.index);
+            --elem_count;
+
+            return true;
+        }
+
+        ///
+        /// \param it Valid iterator to element to erase
+        ///
+        void erase(iterator it) noexcept {
+            erase(get_key(it));
+        }
+
+        ///
+        /// \param it Valid iterator to element to erase
+        ///
+        void erase(const_iterator it) noexcept {
+            erase(get_key(it));
+        }
+
+        ///
+        /// Destructs current contents. Reduces capacity to 0. All keys are
+        /// invalidated.
+        ///
+        void clear() noexcept {
+            for (size_type i = 0; i != elem_count; ++i) {
+                destroy_row(i, column_indices{});
+            }
+
+            deallocate(allocation);
+
+            elem_count = 0;
+            free_anchor = null_index;
+        }
+
+        ///
+        /// \param other Object to swap contents with
+        ///
+        void swap(Soa_slot_map& other) noexcept {
+            if constexpr (std::allocator_traits<A>::propagate_on_container_swap::value) {
+                std::swap(allocator, other.allocator);
+            }
+
+            swap_contents(other);
+        }
+
+        ///
+        /// \param l Left map to swap
+        /// \param r Right map to swap
+        ///
+        friend void swap(Soa_slot_map& l, Soa_slot_map& r) noexcept {
+            l.swap(r);
+        }
+
+        //=================================================
+        // Iterator methods
+        //=================================================
+
+        [[nodiscard]]
+        iterator begin() noexcept {
+            return std::make_from_tuple<iterator>(allocation.columns);
+        }
+
+        [[nodiscard]]
+        const_iterator begin() const noexcept {
+            return std::make_from_tuple<const_iterator>(allocation.columns);
+        }
+
+        [[nodiscard]]
+        const_iterator cbegin() const noexcept {
+            return begin();
+        }
+
+        [[nodiscard]]
+        iterator end() noexcept {
+            return begin() + static_cast<difference_type>(elem_count);
+        }
+
+        [[nodiscard]]
+        const_iterator end() const noexcept {
+            return begin() + static_cast<difference_type>(elem_count);
+        }
+
+        [[nodiscard]]
+        const_iterator cend() const noexcept {
+            return end();
+        }
+
+        //=================================================
+        // Size & capacity methods
+        //=================================================
+
+        ///
+        /// \return True if container has no elements
+        ///
+        [[nodiscard]]
+        bool empty() const noexcept {
+            return elem_count == 0;
+        }
+
+        ///
+        /// \return Element count
+        ///
+        [[nodiscard]]
+        size_type size() const noexcept {
+            return elem_count;
+        }
+
+        ///
+        /// \return Allocation capacity
+        ///
+        [[nodiscard]]
+        size_type capacity() const noexcept {
+            return allocation.capacity;
+        }
+
+        ///
+        /// \return Maximum capacity container may reach
+        ///
+        [[nodiscard]]
+        size_type max_size() const noexcept {
+            constexpr size_type size_type_max = std::numeric_limits<difference_type>::max();
+            const size_type memory_max = std::numeric_limits<size_type>::max() / (row_size() + sizeof(anchor_type) + sizeof(anchor_index_type));
+
+            // Indices must fit within an anchor, with null_index left unused
+            constexpr size_type index_max = (L::index_mask < size_type_max) ? static_cast<size_type>(L::index_mask) : size_type_max;
+
+            return std::min({size_type_max, memory_max, index_max});
+        }
+
+        ///
+        /// Allocates enough memory to store at least n elements
+        ///
+        /// Provides the strong exception guarantee. Members whose move
+        /// constructor may throw are copied into the new allocation before
+        /// any of the remaining members are moved.
+        ///
+        /// \param n Number of elements to allocate memory for
+        void reserve(const size_type n) {
+            if (n <= capacity()) {
+                return;
+            }
+
+            if (max_size() < n) {
+                throw std::length_error("aul::Soa_slot_map grew beyond max size");
+            }
+
+            Allocation new_allocation = allocate(n);
+
+            try {
+                copy_columns<0, true>(allocation, new_allocation);
+            } catch (...) {
+                deallocate(new_allocation);
+                throw;
+            }
+
+            relocate_columns(new_allocation, column_indices{});
+            extend_anchors(new_allocation);
+
+            deallocate(allocation);
+            allocation = std::move(new_allocation);
+        }
+
+        //=================================================
+        // Misc. methods
+        //=================================================
+
+        ///
+        /// \param it Iterator to element
+        /// \return Key corresponding to element pointed to by it
+        [[nodiscard]]
+        key_type get_key(const_iterator it) const noexcept {
+            return key_at(static_cast<size_type>(it - cbegin()));
+        }
+
+        ///
+        /// \param it Iterator to element
+        /// \return Key corresponding to element pointed to by it
+        [[nodiscard]]
+        key_type get_key(iterator it) noexcept {
+            return key_at(static_cast<size_type>(it - begin()));
+        }
+
+        ///
+        /// \param key Key to be checked
+        /// \return True if the key maps to a valid element
+        [[nodiscard]]
+        bool contains(const key_type key) const noexcept {
+            return (key.index < allocation.capacity) && (key.version == L::version(allocation.anchors[key.index]));
+        }
+
+        ///
+        /// \return Copy of internal allocator
+        ///
+        [[nodiscard]]
+        allocator_type get_allocator() const {
+            return allocator;
+        }
+
+    private:
+
+        //=================================================
+        // Instance members
+        //=================================================
+
+        allocator_type allocator{};
+
+        Allocation allocation{};
+
+        size_type elem_count = 0;
+
+        ///
+        /// Index of the first anchor in the free list, or null_index if the
+        /// list is empty
+        ///
+        size_type free_anchor = null_index;
+
+        //=================================================
+        // Misc. helper methods
+        //=================================================
+
+        static constexpr std::size_t row_size() noexcept {
+            return row_size_impl(column_indices{});
+        }
+
+        template<std::size_t...Is>
+        static constexpr std::size_t row_size_impl(std::index_sequence<Is...>) noexcept {
+            return (sizeof(column_type<Is>) + ...);
+        }
+
+        [[nodiscard]]
+        size_type grow_size(const size_type n) const noexcept {
+            const size_type double_size = (max_size() / 2) < capacity() ? max_size() : 2 * capacity();
+            return std::max(n, double_size);
+        }
+
+        [[nodiscard]]
+        key_type key_at(const size_type pos) const noexcept {
+            const anchor_index_type i = allocation.anchor_indices[pos];
+            return key_type{i, static_cast<typename L::version_type>(L::version(allocation.anchors[i]))};
+        }
+
+        void swap_contents(Soa_slot_map& other) noexcept {
+            std::swap(allocation, other.allocation);
+            std::swap(elem_count, other.elem_count);
+            std::swap(free_anchor, other.free_anchor);
+        }
+
+        //=================================================
+        // Row helper methods
+        //=================================================
+
+        template<std::size_t...Is>
+        reference row(const size_type pos, std::index_sequence<Is...>) noexcept {
+            return reference{std::get<Is>(allocation.columns)[pos]...};
+        }
+
+        template<std::size_t...Is>
+        const_reference row(const size_type pos, std::index_sequence<Is...>) const noexcept {
+            return const_reference{std::get<Is>(allocation.columns)[pos]...};
+        }
+
+        ///
+        /// Constructs the members of an element from the I'th member onwards.
+        /// Destroys the members already constructed if an exception is thrown
+        ///
+        template<std::size_t I, class Arg, class...Args>
+        void construct_row(const size_type pos, Arg&& arg, Args&&...args) {
+            auto alloc = column_allocator_type<I>{allocator};
+            column_type<I>* p = std::get<I>(allocation.columns) + pos;
+
+            std::allocator_traits<column_allocator_type<I>>::construct(alloc, p, std::forward<Arg>(arg));
+
+            if constexpr (sizeof...(Args) != 0) {
+                try {
+                    construct_row<I + 1>(pos, std::forward<Args>(args)...);
+                } catch (...) {
+                    std::allocator_traits<column_allocator_type<I>>::destroy(alloc, p);
+                    throw;
+                }
+            }
+        }
+
+        template<class V, std::size_t...Is>
+        key_type insert_impl(V&& v, std::index_sequence<Is...>) {
+            return emplace(std::get<Is>(std::forward<V>(v))...);
+        }
+
+        template<std::size_t...Is>
+        void move_row(const size_type from, const size_type to, std::index_sequence<Is...>) noexcept {
+            ((std::get<Is>(allocation.columns)[to] = std::move(std::get<Is>(allocation.columns)[from])), ...);
+        }
+
+        template<std::size_t...Is>
+        void destroy_row(const size_type pos, std::index_sequence<Is...>) noexcept {
+            (destroy_member<Is>(pos), ...);
+        }
+
+        template<std::size_t I>
+        void destroy_member(const size_type pos) noexcept {
+            auto alloc = column_allocator_type<I>{allocator};
+            std::allocator_traits<column_allocator_type<I>>::destroy(alloc, std::get<I>(allocation.columns) + pos);
+        }
+
+        ///
+        /// \tparam I Index of member
+        /// \return True if the I'th column is relocated by copying rather
+        ///     than moving, as its move constructor may throw
+        template<std::size_t I>
+        static constexpr bool is_relocated_by_copy() noexcept {
+            return !std::is_nothrow_move_constructible<column_type<I>>::value;
+        }
+
+        ///
+        /// Copy-constructs the I'th and subsequent columns of the first
+        /// elem_count elements of from into to. If an exception is thrown, the
+        /// columns which were already constructed are destroyed
+        ///
+        /// \tparam I Index of first column to copy
+        /// \tparam Relocating_only If true, only the columns which are
+        ///     relocated by copying are constructed
+        template<std::size_t I, bool Relocating_only>
+        void copy_columns(const Allocation& from, Allocation& to) {
+            if constexpr (I < column_count) {
+                constexpr bool is_copied = !Relocating_only || is_relocated_by_copy<I>();
+
+                auto alloc = column_allocator_type<I>{allocator};
+                auto* dest = std::get<I>(to.columns);
+
+                if constexpr (is_copied) {
+                    const auto* src = std::get<I>(from.columns);
+                    aul::uninitialized_copy(src, src + elem_count, dest, alloc);
+                }
+
+                try {
+                    copy_columns<I + 1, Relocating_only>(from, to);
+                } catch (...) {
+                    if constexpr (is_copied) {
+                        aul::destroy(dest, dest + elem_count, alloc);
+                    }
+                    throw;
+                }
+            }
+        }
+
+        ///
+        /// Moves the columns which weren't copied into to by
+        /// copy_columns<0, true>() and destroys the elements of the current
+        /// allocation. Cannot throw
+        ///
+        template<std::size_t...Is>
+        void relocate_columns(Allocation& to, std::index_sequence<Is...>) noexcept {
+            (relocate_column<Is>(to), ...);
+        }
+
+        template<std::size_t I>
+        void relocate_column(Allocation& to) noexcept {
+            auto alloc = column_allocator_type<I>{allocator};
+            auto* src = std::get<I>(allocation.columns);
+
+            if constexpr (is_relocated_by_copy<I>()) {
+                aul::destroy(src, src + elem_count, alloc);
+            } else {
+                aul::uninitialized_destructive_move(src, src + elem_count, std::get<I>(to.columns), alloc);
+            }
+        }
+
+        //=================================================
+        // Anchor helper methods
+        //=================================================
+
+        ///
+        /// Takes the anchor at the front of the free list and maps it to the
+        /// element at pos
+        ///
+        /// \pre free_anchor != null_index
+        /// \param pos Index of the element
+        /// \return Key mapped to the element
+        key_type consume_anchor(const size_type pos) noexcept {
+            const size_type i = free_anchor;
+            anchor_type& a = allocation.anchors[i];
+
+            free_anchor = L::index(a);
+            a = L::with_index(a, static_cast<anchor_type>(pos));
+            allocation.anchor_indices[pos] = static_cast<anchor_index_type>(i);
+
+            return key_at(pos);
+        }
+
+        ///
+        /// Pushes anchor i onto the free list and increments its version
+        ///
+        void release_anchor(const size_type i) noexcept {
+            anchor_type& a = allocation.anchors[i];
+            a = L::make(static_cast<anchor_type>(free_anchor), static_cast<anchor_type>(L::version(a) + 1));
+            free_anchor = i;
+        }
+
+        ///
+        /// Copies the anchors and reverse mapping into the new allocation and
+        /// threads the anchors beyond the current capacity onto the front of
+        /// the free list
+        ///
+        /// \param to Allocation with greater capacity than the current one
+        void extend_anchors(Allocation& to) noexcept {
+            const size_type old_capacity = allocation.capacity;
+
+            std::copy_n(allocation.anchors, old_capacity, to.anchors);
+            std::copy_n(allocation.anchor_indices, elem_count, to.anchor_indices);
+
+            for (size_type i = old_capacity; i + 1 < to.capacity; ++i) {
+                to.anchors[i] = L::make(static_cast<anchor_type>(i + 1), 1);
+            }
+            to.anchors[to.capacity - 1] = L::make(static_cast<anchor_type>(free_anchor), 1);
+
+            free_anchor = old_capacity;
+        }
+
+        //=================================================
+        // Allocation helper methods
+        //=================================================
+
+        [[nodiscard]]
+        Allocation allocate(const size_type n) {
+            Allocation ret{};
+            if (n == 0) {
+                return ret;
+            }
+
+            try {
+                allocate_columns(ret, n, column_indices{});
+
+                auto anchor_allocator = anchor_allocator_type{allocator};
+                auto anchor_index_allocator = anchor_index_allocator_type{allocator};
+                ret.anchors = anchor_allocator_traits::allocate(anchor_allocator, n);
+                ret.anchor_indices = anchor_index_allocator_traits::allocate(anchor_index_allocator, n);
+            } catch (...) {
+                ret.capacity = n;
+                deallocate(ret);
+                throw;
+            }
+
+            ret.capacity = n;
+            return ret;
+        }
+
+        template<std::size_t...Is>
+        void allocate_columns(Allocation& a, const size_type n, std::index_sequence<Is...>) {
+            (allocate_column<Is>(a, n), ...);
+        }
+
+        template<std::size_t I>
+        void allocate_column(Allocation& a, const size_type n) {
+            auto alloc = column_allocator_type<I>{allocator};
+            std::get<I>(a.columns) = std::allocator_traits<column_allocator_type<I>>::allocate(alloc, n);
+        }
+
+        void deallocate(Allocation& a) noexcept {
+            deallocate_columns(a, column_indices{});
+
+            auto anchor_allocator = anchor_allocator_type{allocator};
+            auto anchor_index_allocator = anchor_index_allocator_type{allocator};
+
+            if (a.anchors) {
+                anchor_allocator_traits::deallocate(anchor_allocator, a.anchors, a.capacity);
+            }
+            if (a.anchor_indices) {
+                anchor_index_allocator_traits::deallocate(anchor_index_allocator, a.anchor_indices, a.capacity);
+            }
+
+            a = {};
+        }
+
+        template<std::size_t...Is>
+        void deallocate_columns(Allocation& a, std::index_sequence<Is...>) noexcept {
+            (deallocate_column<Is>(a), ...);
+        }
+
+        template<std::size_t I>
+        void deallocate_column(Allocation& a) noexcept {
+            if (std::get<I>(a.columns)) {
+                auto alloc = column_allocator_type<I>{allocator};
+                std::allocator_traits<column_allocator_type<I>>::deallocate(alloc, std::get<I>(a.columns), a.capacity);
+            }
+        }
+
+    };
+
+    template<class T, class A, class L>
+    class Soa_slot_map<T, A, L>::Allocation {
+    public:
+
+        //=============================================
+        // Instance variables
+        //=============================================
+
+        typename impl::Soa_columns<T>::pointers columns{};
+
+        ///
+        /// Position of the element mapped to each anchor, or index of the next
+        /// free anchor, packed alongside the anchor's version
+        ///
+        anchor_type* anchors = nullptr;
+
+        ///
+        /// Index of the anchor mapped to each element
+        ///
+        anchor_index_type* anchor_indices = nullptr;
+
+        size_type capacity = 0;
+
+        //=============================================
+        // -ctors
+        //=============================================
+
+        Allocation() = default;
+
+        Allocation(const Allocation&) = delete;
+
+        Allocation(Allocation&& alloc) noexcept:
+            columns(alloc.columns),
+            anchors(alloc.anchors),
+            anchor_indices(alloc.anchor_indices),
+            capacity(alloc.capacity) {
+
+            alloc = {};
+        }
+
+        ~Allocation() = default;
+
+        //=============================================
+        // Assignment operators
+        //=============================================
+
+        Allocation& operator=(const Allocation&) = delete;
+
+        Allocation& operator=(Allocation&& alloc) noexcept {
+            columns = alloc.columns;
+            anchors = alloc.anchors;
+            anchor_indices = alloc.anchor_indices;
+            capacity = alloc.capacity;
+
+            alloc.columns = {};
+            alloc.anchors = nullptr;
+            alloc.anchor_indices = nullptr;
+            alloc.capacity = 0;
+
+            return *this;
+        }
+
+    };
+
+}
+
+#endif //AUL_SOA_SLOT_MAP_HPP
@@ -0,0 +1,198 @@
+#ifndef AUL_EPOCH_DOMAIN_HPP
+#define AUL_EPOCH_DOMAIN_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <thread>
+
+namespace aul {
+
+    ///
+    /// Minimal epoch-based reclamation scheme for data structures with a
+    /// single writer and any number of concurrent readers.
+    ///
+    /// Readers pin the domain for the duration of each access. The writer
+    /// tags objects it has unlinked with the epoch at the time of unlinking
+    /// and may destroy them once is_safe() returns true for that tag, at
+    /// which point no reader can still hold a reference to them.
+    ///
+    /// Readers register themselves in one of two counters, selected by the
+    /// parity of the epoch they entered in. The epoch can only advance once
+    /// every reader which entered two epochs earlier has left. The counters
+    /// are spread over several cache lines, chosen per thread, to reduce
+    /// contention between readers. Pinning never blocks.
+    ///
+    class Epoch_domain {
+    public:
+
+        //=================================================
+        // Helper classes
+        //=================================================
+
+        ///
+        /// RAII object representing a pinned read-side critical section
+        ///
+        class Guard {
+        public:
+
+            //=============================================
+            // -ctors
+            //=============================================
+
+            Guard(const Guard&) = delete;
+
+            Guard(Guard&& other) noexcept:
+                counter(other.counter) {
+                other.counter = nullptr;
+            }
+
+            ~Guard() {
+                if (counter) {
+                    counter->fetch_sub(1, std::memory_order_release);
+                }
+            }
+
+            //=============================================
+            // Assignment operators
+            //=============================================
+
+            Guard& operator=(const Guard&) = delete;
+            Guard& operator=(Guard&&) = delete;
+
+        private:
+
+            friend class Epoch_domain;
+
+            explicit Guard(std::atomic<std::size_t>* counter):
+                counter(counter) {}
+
+            std::atomic<std::size_t>* counter = nullptr;
+
+        };
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+        Epoch_domain() = default;
+        Epoch_domain(const Epoch_domain&) = delete;
+        Epoch_domain(Epoch_domain&&) = delete;
+        ~Epoch_domain() = default;
+
+        //=================================================
+        // Assignment operators
+        //=================================================
+
+        Epoch_domain& operator=(const Epoch_domain&) = delete;
+        Epoch_domain& operator=(Epoch_domain&&) = delete;
+
+        //=================================================
+        // Reader methods
+        //=================================================
+
+        ///
+        /// Enters a read-side critical section. Objects reachable from shared
+        /// state loaded while the returned guard is alive will not be
+        /// reclaimed until it is destroyed.
+        ///
+        /// \return Guard which leaves the critical section on destruction
+        [[nodiscard]]
+        Guard pin() const noexcept {
+            Stripe& stripe = stripes[stripe_index()];
+
+            while (true) {
+                const std::uint64_t e = global_epoch.load(std::memory_order_seq_cst);
+                std::atomic<std::size_t>& counter = stripe.counts[e & 1];
+
+                counter.fetch_add(1, std::memory_order_seq_cst);
+                if (global_epoch.load(std::memory_order_seq_cst) == e) {
+                    return Guard{&counter};
+                }
+
+                // The epoch advanced past e in the meantime, so the writer may
+                // not have seen this reader. Retry in the new epoch
+                counter.fetch_sub(1, std::memory_order_release);
+            }
+        }
+
+        //=================================================
+        // Writer methods
+        //=================================================
+
+        ///
+        /// \return Current epoch. Objects unlinked before this call should be
+        /// tagged with the returned value
+        [[nodiscard]]
+        std::uint64_t epoch() const noexcept {
+            return global_epoch.load(std::memory_order_seq_cst);
+        }
+
+        ///
+        /// Advances the epoch if all readers from the previous epoch have
+        /// left. Must only be called by the writer.
+        ///
+        /// \return True if the epoch was advanced
+        bool try_advance() noexcept {
+            const std::uint64_t e = global_epoch.load(std::memory_order_relaxed);
+
+            // Readers from epoch e - 1 share a counter with epoch e + 1
+            const std::size_t parity = (e + 1) & 1;
+            for (const Stripe& stripe : stripes) {
+                if (stripe.counts[parity].load(std::memory_order_seq_cst) != 0) {
+                    return false;
+                }
+            }
+
+            global_epoch.store(e + 1, std::memory_order_seq_cst);
+            return true;
+        }
+
+        ///
+        /// \param tag Epoch an object was unlinked in
+        /// \return True if no reader can still reference the object
+        [[nodiscard]]
+        bool is_safe(const std::uint64_t tag) const noexcept {
+            return tag + 2 <= global_epoch.load(std::memory_order_seq_cst);
+        }
+
+    private:
+
+        //=================================================
+        // Helper classes
+        //=================================================
+
+        struct alignas(64) Stripe {
+            std::atomic<std::size_t> counts[2]{};
+        };
+
+        //=================================================
+        // Static members
+        //=================================================
+
+        static constexpr std::size_t stripe_count = 16;
+
+        //=================================================
+        // Instance members
+        //=================================================
+
+        mutable Stripe stripes[stripe_count]{};
+
+        std::atomic<std::uint64_t> global_epoch{0};
+
+        //=================================================
+        // Helper functions
+        //=================================================
+
+        [[nodiscard]]
+        static std::size_t stripe_index() noexcept {
+            thread_local const std::size_t index = std::hash<std::thread::id>{}(std::this_thread::get_id()) % stripe_count;
+            return index;
+        }
+
+    };
+
+}
+
+#endif //AUL_EPOCH_DOMAIN_HPP
@@ -4,6 +4,7 @@
 #include <memory>
 #include <vector>
 #include <type_traits>
+#include <cstring>
 
 namespace aul {
 
@@ -29,6 +30,105 @@ namespace aul {
         return p;
     }
 
+    ///
+    /// Hints that the cache line containing p will be read in the near
+    /// future. p need not point to a valid object; prefetching an invalid
+    /// address has no observable effect.
+    ///
+    /// \param p Address to prefetch
+    inline void prefetch(const void* p) noexcept {
+        #if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(p);
+        #else
+        static_cast<void>(p);
+        #endif
+    }
+
+    //=====================================================
+    // Relocation traits
+    //=====================================================
+
+    template<class T, class A>
+    class allocator_has_trivial_types;
+
+    ///
+    /// Trait indicating whether objects of type T may be relocated, that is
+    /// moved to a new location with the original object subsequently
+    /// destroyed, by simply copying their bytes.
+    ///
+    /// Holds for trivially copyable types by default. May be specialized to
+    /// opt other types in, e.g. types which hold an owning pointer to a
+    /// separate heap allocation.
+    ///
+    /// \tparam T Object type
+    template<class T>
+    struct is_trivially_relocatable : public std::is_trivially_copyable<T> {};
+
+    template<class T>
+    constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+    namespace impl {
+
+        ///
+        /// True if the iterators are raw pointers to the allocator's
+        /// value_type and the allocator uses default types
+        ///
+        template<class In_iter, class Out_iter, class Alloc>
+        constexpr bool is_raw_pointer_range_v =
+            std::is_pointer_v<In_iter> &&
+            std::is_pointer_v<Out_iter> &&
+            std::is_same_v<std::remove_cv_t<std::remove_pointer_t<In_iter>>, std::remove_pointer_t<Out_iter>> &&
+            allocator_has_trivial_types<std::remove_pointer_t<Out_iter>, Alloc>::value;
+
+        ///
+        /// True if objects may be moved from a range of In_iter to a range of
+        /// Out_iter, with the source objects remaining alive, by copying their
+        /// bytes
+        ///
+        template<class In_iter, class Out_iter, class Alloc>
+        constexpr bool is_bitwise_movable_v =
+            is_raw_pointer_range_v<In_iter, Out_iter, Alloc> &&
+            std::is_trivially_copyable_v<std::remove_pointer_t<Out_iter>>;
+
+        ///
+        /// True if objects may be moved from a range of In_iter to a range of
+        /// Out_iter, with the source objects being destroyed, by copying
+        /// their bytes
+        ///
+        template<class In_iter, class Out_iter, class Alloc>
+        constexpr bool is_bitwise_relocatable_v =
+            is_raw_pointer_range_v<In_iter, Out_iter, Alloc> &&
+            is_trivially_relocatable_v<std::remove_pointer_t<Out_iter>>;
+
+        ///
+        /// memmove wrapper which accepts empty ranges of null pointers
+        ///
+        /// \param dest Pointer to beginning of destination range
+        /// \param src Pointer to beginning of source range
+        /// \param n Number of objects to move
+        template<class T, class size_type>
+        void bitwise_move(T* dest, const T* src, const size_type n) noexcept {
+            if (n != 0) {
+                std::memmove(static_cast<void*>(dest), static_cast<const void*>(src), n * sizeof(T));
+            }
+        }
+
+        ///
+        /// memcpy wrapper which accepts empty ranges of null pointers
+        ///
+        /// \param dest Pointer to beginning of destination range
+        /// \param src Pointer to beginning of source range. Must not overlap
+        ///     with destination range
+        /// \param n Number of objects to copy
+        template<class T, class size_type>
+        void bitwise_copy(T* dest, const T* src, const size_type n) noexcept {
+            if (n != 0) {
+                std::memcpy(static_cast<void*>(dest), static_cast<const void*>(src), n * sizeof(T));
+            }
+        }
+
+    }
+
     ///
     /// Allocator extended version of std::destroy
     ///
@@ -213,6 +313,11 @@ namespace aul {
     /// \param alloc Reference to allocator object to destroy objects with
     template<class In_iter, class Out_iter, class Alloc>
     Out_iter destructive_move(In_iter first, In_iter last, Out_iter d_first, Alloc& alloc) {
+        if constexpr (impl::is_bitwise_movable_v<In_iter, Out_iter, Alloc>) {
+            impl::bitwise_move(d_first, first, last - first);
+            return d_first + (last - first);
+        }
+
         for (;first != last; first++, d_first++) {
             *d_first = std::move(*first);
             std::allocator_traits<Alloc>::destroy(
@@ -238,6 +343,11 @@ namespace aul {
     /// \return Iterator to end of destination range
     template<class In_iter, class Out_iter, class Alloc>
     Out_iter uninitialized_move(In_iter begin, In_iter end, Out_iter dest, Alloc& allocator) {
+        if constexpr (impl::is_bitwise_movable_v<In_iter, Out_iter, Alloc>) {
+            impl::bitwise_move(dest, begin, end - begin);
+            return dest + (end - begin);
+        }
+
         for (; begin != end; ++begin, ++dest) {
             std::allocator_traits<Alloc>::construct(allocator, std::addressof(*dest), std::move(*begin));
         }
@@ -297,6 +407,11 @@ namespace aul {
     /// \return Iterator to end of destination range
     template<class In_iter, class Out_iter, class Alloc>
     Out_iter uninitialized_destructive_move(In_iter first, In_iter last, Out_iter d_first, Alloc& alloc) {
+        if constexpr (impl::is_bitwise_relocatable_v<In_iter, Out_iter, Alloc>) {
+            impl::bitwise_move(d_first, first, last - first);
+            return d_first + (last - first);
+        }
+
         for (;first != last; first++, d_first++) {
             std::allocator_traits<Alloc>::construct(
                 alloc,
@@ -328,6 +443,11 @@ namespace aul {
     /// \return Iterator to beginning of destination range
     template<class Bi_iter0, class Bi_iter1, class Alloc>
     Bi_iter1 uninitialized_move_backward(Bi_iter0 first, Bi_iter0 last, Bi_iter1 d_last, Alloc& alloc) {
+        if constexpr (impl::is_bitwise_movable_v<Bi_iter0, Bi_iter1, Alloc>) {
+            impl::bitwise_move(d_last - (last - first), first, last - first);
+            return d_last - (last - first);
+        }
+
         while (first != last) {
             std::allocator_traits<Alloc>::construct(
                 alloc,
@@ -354,11 +474,16 @@ namespace aul {
     /// \return Iterator to beginning of destination range
     template<class Bi_iter0, class Bi_iter1, class Alloc>
     Bi_iter1 destructive_move_backward(Bi_iter0 first, Bi_iter0 last, Bi_iter1 d_last, Alloc& alloc) noexcept {
+        if constexpr (impl::is_bitwise_movable_v<Bi_iter0, Bi_iter1, Alloc>) {
+            impl::bitwise_move(d_last - (last - first), first, last - first);
+            return d_last - (last - first);
+        }
+
         while (first != last) {
             *(--d_last) = std::move(*(--last));
             std::allocator_traits<Alloc>::destroy(
                 alloc,
-                std::addressof(*(--d_last))
+                std::addressof(*last)
             );
         }
         return d_last;
@@ -379,6 +504,11 @@ namespace aul {
     /// \return Iterator to beginning of destination range
     template<class Bi_iter0, class Bi_iter1, class Alloc>
     Bi_iter1 uninitialized_destructive_move_backward(Bi_iter0 first, Bi_iter0 last, Bi_iter1 d_last, Alloc& alloc) {
+        if constexpr (impl::is_bitwise_relocatable_v<Bi_iter0, Bi_iter1, Alloc>) {
+            impl::bitwise_move(d_last - (last - first), first, last - first);
+            return d_last - (last - first);
+        }
+
         while (first != last) {
             std::allocator_traits<Alloc>::construct(
                 alloc,
@@ -388,7 +518,7 @@ namespace aul {
 
             std::allocator_traits<Alloc>::destroy(
                 alloc,
-                std::addressof(*(--d_last))
+                std::addressof(*last)
             );
         }
         return d_last;
@@ -407,6 +537,11 @@ namespace aul {
     /// \return Iterator to end of destination range
     template<class Input_iter, class Forward_iter, class Alloc>
     Forward_iter uninitialized_copy(Input_iter begin, Input_iter end, Forward_iter dest, Alloc& alloc) {
+        if constexpr (impl::is_bitwise_movable_v<Input_iter, Forward_iter, Alloc>) {
+            impl::bitwise_copy(dest, begin, end - begin);
+            return dest + (end - begin);
+        }
+
         Forward_iter x = dest;
         Input_iter it = begin;
 
@@ -548,6 +683,11 @@ namespace aul {
     /// \return Iterator to end of destination range
     template<class R_iter, class Alloc>
     R_iter uninitialized_move_elements_left(R_iter a, R_iter b, R_iter c, Alloc& alloc) {
+        if constexpr (impl::is_bitwise_movable_v<R_iter, R_iter, Alloc>) {
+            impl::bitwise_move(a, b, c - b);
+            return a + (c - b);
+        }
+
         auto non_overlap = std::min(c - b, b - a);
         auto it0 = b + non_overlap;
         auto it1 = aul::uninitialized_move(b, it0, a, alloc);
@@ -569,6 +709,11 @@ namespace aul {
     /// \return Iterator to end of destination range
     template<class R_iter, class Alloc>
     R_iter destructive_move_elements_left(R_iter a, R_iter b, R_iter c, Alloc& alloc) {
+        if constexpr (impl::is_bitwise_movable_v<R_iter, R_iter, Alloc>) {
+            impl::bitwise_move(a, b, c - b);
+            return a + (c - b);
+        }
+
         auto overlap = std::max((c - b) - (b - a), {});
         auto it0 = b + overlap;
         auto it1 = std::move(b, it0, a);
@@ -590,6 +735,11 @@ namespace aul {
     /// \return Iterator to end of destination range
     template<class R_iter, class Alloc>
     R_iter uninitialized_destructive_move_elements_left(R_iter a, R_iter b, R_iter c, Alloc& alloc) {
+        if constexpr (impl::is_bitwise_relocatable_v<R_iter, R_iter, Alloc>) {
+            impl::bitwise_move(a, b, c - b);
+            return a + (c - b);
+        }
+
         using d_type = typename std::iterator_traits<R_iter>::difference_type;
 
         auto source_range_size = (c - b);
@@ -643,6 +793,11 @@ namespace aul {
     /// \return Iterator to beginning of destination range
     template<class R_iter, class Alloc>
     R_iter uninitialized_move_elements_right(R_iter a, R_iter b, R_iter c, Alloc& alloc) {
+        if constexpr (impl::is_bitwise_movable_v<R_iter, R_iter, Alloc>) {
+            impl::bitwise_move(c - (b - a), a, b - a);
+            return c - (b - a);
+        }
+
         auto non_overlap = std::min(c - b, b - a);
 
         auto it0 = aul::uninitialized_move_backward(b - non_overlap, b, c, alloc);
@@ -664,6 +819,11 @@ namespace aul {
     /// \param alloc Allocator to use to destroy elements with
     template<class R_iter, class Alloc>
     R_iter destructive_move_elements_right(R_iter a, R_iter b, R_iter c, Alloc& alloc) {
+        if constexpr (impl::is_bitwise_movable_v<R_iter, R_iter, Alloc>) {
+            impl::bitwise_move(c - (b - a), a, b - a);
+            return c - (b - a);
+        }
+
         auto non_overlap = std::min(c - b, b - a);
 
         auto it0 = std::move_backward(b - non_overlap, b, c);
@@ -686,6 +846,11 @@ namespace aul {
     /// \return Iterator to beginning of destination range
     template<class R_iter, class Alloc>
     R_iter uninitialized_destructive_move_elements_right(R_iter a, R_iter b, R_iter c, Alloc& alloc) {
+        if constexpr (impl::is_bitwise_relocatable_v<R_iter, R_iter, Alloc>) {
+            impl::bitwise_move(c - (b - a), a, b - a);
+            return c - (b - a);
+        }
+
         using d_type = typename std::iterator_traits<R_iter>::difference_type;
 
         auto source_range_size = (b - a);
@@ -736,7 +901,7 @@ namespace aul {
     template<class T, class A>
     class allocator_has_trivial_types {
     private:
-        using alloc_traits = std::allocator_traits<T>;
+        using alloc_traits = std::allocator_traits<A>;
 
         using value_type = typename alloc_traits::value_type;
         using default_value_type = T;
@@ -787,6 +952,31 @@ namespace aul {
         };
     };
 
+    ///
+    /// Determines whether an allocator provides a member function
+    /// reallocate(p, old_n, new_n) which resizes an allocation previously
+    /// obtained from it, preserving the bytes of its contents, and returns a
+    /// pointer to the resized allocation. If p is null, it must behave like
+    /// allocate(new_n).
+    ///
+    /// Containers may use this to grow without relocating their elements one
+    /// at a time when those elements can be relocated by copying their bytes.
+    ///
+    template<class A, class = void>
+    struct allocator_supports_reallocation : public std::false_type {};
+
+    template<class A>
+    struct allocator_supports_reallocation<A, std::void_t<decltype(
+        std::declval<typename std::allocator_traits<A>::pointer&>() = std::declval<A&>().reallocate(
+            std::declval<typename std::allocator_traits<A>::pointer>(),
+            std::declval<typename std::allocator_traits<A>::size_type>(),
+            std::declval<typename std::allocator_traits<A>::size_type>()
+        )
+    )>> : public std::true_type {};
+
+    template<class A>
+    constexpr bool allocator_supports_reallocation_v = allocator_supports_reallocation<A>::value;
+
     template<class A>
     struct is_noexcept_movable : public std::bool_constant<
         std::allocator_traits<A>::propagate_on_container_move_assignment::value ||
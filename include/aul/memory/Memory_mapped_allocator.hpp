@@ -10,11 +10,323 @@ static_assert(false, "OS not supported");
 #endif
 
 #include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
 
+#include <cerrno>
 #include <cstdint>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
 
 namespace aul {
 
+    ///
+    /// Options controlling how a Memory_mapped_allocator creates its
+    /// mappings. May be combined with operator|.
+    ///
+    enum class Mapping_flags : std::uint32_t {
+        none = 0x00,
+
+        ///
+        /// Pre-fault pages when mapping them (MAP_POPULATE) so that first
+        /// access doesn't incur page faults.
+        ///
+        populate = 0x01,
+
+        ///
+        /// Back anonymous mappings with huge pages (MAP_HUGETLB). If no huge
+        /// pages are reserved, falls back to regular pages advised with
+        /// MADV_HUGEPAGE so that transparent huge pages may be used instead.
+        /// Allocation sizes are rounded up to a multiple of the huge page size.
+        ///
+        huge_pages = 0x02
+    };
+
+    constexpr Mapping_flags operator|(const Mapping_flags lhs, const Mapping_flags rhs) {
+        return static_cast<Mapping_flags>(static_cast<std::uint32_t>(lhs) | static_cast<std::uint32_t>(rhs));
+    }
+
+    constexpr Mapping_flags operator&(const Mapping_flags lhs, const Mapping_flags rhs) {
+        return static_cast<Mapping_flags>(static_cast<std::uint32_t>(lhs) & static_cast<std::uint32_t>(rhs));
+    }
+
+    namespace impl {
+
+        inline std::size_t page_size() noexcept {
+            static const std::size_t size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+            return size;
+        }
+
+        constexpr std::size_t huge_page_size() noexcept {
+            return std::size_t{2} * 1024 * 1024;
+        }
+
+        constexpr std::size_t round_up(const std::size_t x, const std::size_t multiple) noexcept {
+            return (x + multiple - 1) / multiple * multiple;
+        }
+
+        ///
+        /// Applies advice to the range [begin, end) of a mapping
+        ///
+        inline void advise_mapping(void* p, const std::size_t begin, const std::size_t end, const Mapping_flags flags, const int advice) noexcept {
+            if (end <= begin) {
+                return;
+            }
+
+            auto* range = static_cast<char*>(p) + begin;
+
+            if (advice != MADV_NORMAL) {
+                madvise(range, end - begin, advice);
+            }
+
+            // MAP_POPULATE has no equivalent for mremap so the best that can
+            // be done for grown regions is to request read-ahead
+            if (begin != 0 && (flags & Mapping_flags::populate) != Mapping_flags::none) {
+                madvise(range, end - begin, MADV_WILLNEED);
+            }
+        }
+
+        ///
+        /// State shared between all copies of a file-backed allocator.
+        ///
+        /// Mappings are handed out from consecutive page-aligned regions of
+        /// the file, starting at the end of its original contents. Regions are
+        /// never reused once handed out so that their contents remain in the
+        /// file after they're unmapped.
+        ///
+        struct Mapped_file {
+
+            //=============================================
+            // Type aliases
+            //=============================================
+
+            using offset_map = std::map<void*, std::size_t>;
+
+            //=============================================
+            // -ctors
+            //=============================================
+
+            explicit Mapped_file(const std::string& path):
+                descriptor(open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644)) {
+
+                if (descriptor == -1) {
+                    throw std::runtime_error{"aul::Memory_mapped_allocator: Failed to open " + path + ": " + std::strerror(errno)};
+                }
+
+                struct stat info{};
+                if (fstat(descriptor, &info) == -1) {
+                    close(descriptor);
+                    throw std::runtime_error{"aul::Memory_mapped_allocator: Failed to stat " + path + ": " + std::strerror(errno)};
+                }
+
+                end_offset = round_up(static_cast<std::size_t>(info.st_size), page_size());
+            }
+
+            Mapped_file(const Mapped_file&) = delete;
+            Mapped_file(Mapped_file&&) = delete;
+
+            ~Mapped_file() {
+                close(descriptor);
+            }
+
+            //=============================================
+            // Mapping methods
+            //=============================================
+
+            void* map(const std::size_t bytes, const Mapping_flags flags, const int advice) {
+                const std::size_t offset = end_offset;
+                auto entry = make_entry(offset);
+
+                if (ftruncate(descriptor, static_cast<off_t>(offset + bytes)) == -1) {
+                    throw std::bad_alloc{};
+                }
+
+                int mmap_flags = MAP_SHARED;
+                if ((flags & Mapping_flags::populate) != Mapping_flags::none) {
+                    mmap_flags |= MAP_POPULATE;
+                }
+
+                void* ret = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, mmap_flags, descriptor, static_cast<off_t>(offset));
+                if (ret == MAP_FAILED) {
+                    ftruncate(descriptor, static_cast<off_t>(offset));
+                    throw std::bad_alloc{};
+                }
+
+                advise_mapping(ret, 0, bytes, flags, advice);
+
+                entry.key() = ret;
+                offsets.insert(std::move(entry));
+                end_offset = offset + bytes;
+                return ret;
+            }
+
+            void* map_existing(const std::size_t offset, const std::size_t bytes, const Mapping_flags flags, const int advice) {
+                if (offset % page_size() != 0) {
+                    throw std::invalid_argument{"aul::Memory_mapped_allocator: File offset is not page-aligned"};
+                }
+
+                struct stat info{};
+                if (fstat(descriptor, &info) == -1) {
+                    throw std::bad_alloc{};
+                }
+
+                const auto file_size = static_cast<std::size_t>(info.st_size);
+                if (file_size < offset || file_size - offset < bytes) {
+                    throw std::out_of_range{"aul::Memory_mapped_allocator: Region extends past end of file"};
+                }
+
+                auto entry = make_entry(offset);
+
+                int mmap_flags = MAP_SHARED;
+                if ((flags & Mapping_flags::populate) != Mapping_flags::none) {
+                    mmap_flags |= MAP_POPULATE;
+                }
+
+                void* ret = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, mmap_flags, descriptor, static_cast<off_t>(offset));
+                if (ret == MAP_FAILED) {
+                    throw std::bad_alloc{};
+                }
+
+                advise_mapping(ret, 0, bytes, flags, advice);
+
+                entry.key() = ret;
+                offsets.insert(std::move(entry));
+                return ret;
+            }
+
+            void unmap(void* p, const std::size_t bytes) noexcept {
+                munmap(p, bytes);
+                offsets.erase(p);
+            }
+
+            std::size_t offset_of(void* p) const {
+                auto it = offsets.find(p);
+                if (it == offsets.end()) {
+                    throw std::invalid_argument{"aul::Memory_mapped_allocator: Pointer was not allocated by this allocator"};
+                }
+
+                return it->second;
+            }
+
+            void* remap(void* p, const std::size_t old_bytes, const std::size_t new_bytes, const Mapping_flags flags, const int advice) {
+                auto it = offsets.find(p);
+                if (it == offsets.end()) {
+                    throw std::invalid_argument{"aul::Memory_mapped_allocator: Pointer was not allocated by this allocator"};
+                }
+
+                const std::size_t offset = it->second;
+
+                // Only the last region of the file can be resized in place.
+                // Others have to be copied to a new region at the end, leaving
+                // the old region's contents behind
+                if (offset + old_bytes != end_offset) {
+                    void* ret = map(new_bytes, flags, advice);
+                    std::memcpy(ret, p, (old_bytes < new_bytes) ? old_bytes : new_bytes);
+                    unmap(p, old_bytes);
+                    return ret;
+                }
+
+                if (old_bytes < new_bytes && ftruncate(descriptor, static_cast<off_t>(offset + new_bytes)) == -1) {
+                    throw std::bad_alloc{};
+                }
+
+                void* ret = mremap(p, old_bytes, new_bytes, MREMAP_MAYMOVE);
+                if (ret == MAP_FAILED) {
+                    ftruncate(descriptor, static_cast<off_t>(end_offset));
+                    throw std::bad_alloc{};
+                }
+
+                if (new_bytes < old_bytes) {
+                    ftruncate(descriptor, static_cast<off_t>(offset + new_bytes));
+                }
+
+                advise_mapping(ret, old_bytes, new_bytes, flags, advice);
+
+                // Reusing the existing node means the mapping can't be left
+                // untracked by a failed allocation
+                auto entry = offsets.extract(it);
+                entry.key() = ret;
+                offsets.insert(std::move(entry));
+                end_offset = offset + new_bytes;
+                return ret;
+            }
+
+            //=============================================
+            // Helper functions
+            //=============================================
+
+            ///
+            /// Allocates the node which will track a new mapping before the
+            /// mapping is created, so that inserting it can't fail afterwards
+            ///
+            /// \param offset File offset of the mapping
+            /// \return Node with a placeholder key
+            [[nodiscard]]
+            static offset_map::node_type make_entry(const std::size_t offset) {
+                offset_map temp;
+                temp.emplace(nullptr, offset);
+                return temp.extract(temp.begin());
+            }
+
+            //=============================================
+            // Instance members
+            //=============================================
+
+            std::mutex mutex;
+
+            int descriptor = -1;
+
+            ///
+            /// Offset one past the end of the last region of the file which
+            /// has been handed out
+            ///
+            std::size_t end_offset = 0;
+
+            ///
+            /// File offsets of all live mappings
+            ///
+            offset_map offsets;
+
+        };
+
+    }
+
+    ///
+    /// An allocator which obtains memory directly from the OS through mmap.
+    ///
+    /// By default, allocations are private anonymous mappings. If constructed
+    /// with a file path, allocations are instead shared mappings of
+    /// consecutive regions of that file, so their contents are written back
+    /// to it and persist beyond the lifetime of the process.
+    ///
+    /// Deallocating a file-backed allocation only unmaps it. Its contents are
+    /// left in the file and regions of the file are never reused, so the
+    /// file only shrinks when its last region is shrunk through
+    /// reallocate(). The offset of an allocation within the file can be
+    /// queried through offset_of() and the region mapped again later, e.g.
+    /// after a restart, through attach(). Containers don't record where
+    /// their allocation lives so persisting one across restarts requires
+    /// storing its offset and size separately.
+    ///
+    /// Every allocation occupies a whole number of pages so this allocator is
+    /// best suited for a small number of large allocations, such as the
+    /// backing storage of a container.
+    ///
+    /// Allocations may be grown or shrunk with reallocate(), which uses
+    /// mremap to avoid copying the allocation's contents wherever possible.
+    ///
+    /// Copies of an allocator share the same underlying file, if any.
+    ///
+    /// \tparam T Allocator value type
     template<class T>
     class Memory_mapped_allocator {
     public:
@@ -34,39 +346,298 @@ namespace aul {
         using size_type = std::size_t;
         using difference_type = std::ptrdiff_t;
 
+        using propagate_on_container_copy_assignment = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+
+        using is_always_equal = std::false_type;
+
+        template<class U>
+        struct rebind {
+            using other = Memory_mapped_allocator<U>;
+        };
+
         //=================================================
         // -ctors
         //=================================================
 
-        Memory_mapped_allocator();
+        ///
+        /// Creates an allocator which produces anonymous mappings.
+        ///
+        /// \param flags Options to apply to created mappings
+        /// \param advice Advice passed to madvise for each created mapping
+        explicit Memory_mapped_allocator(const Mapping_flags flags, const int advice = MADV_NORMAL) noexcept:
+            flags(flags),
+            advice(advice) {}
 
-        ~Memory_mapped_allocator() {
-            if (ptr) {
-                munmap(ptr, allocation_size);
-            }
-        }
+        ///
+        /// Creates an allocator which produces mappings of the file at the
+        /// specified path. The file is created if it doesn't already exist.
+        /// New allocations are placed after the file's existing contents.
+        ///
+        /// \param path Path to file to back allocations with
+        /// \param flags Options to apply to created mappings. huge_pages is
+        ///     ignored as it's not supported for regular files
+        /// \param advice Advice passed to madvise for each created mapping
+        explicit Memory_mapped_allocator(const std::string& path, const Mapping_flags flags = Mapping_flags::none, const int advice = MADV_NORMAL):
+            file(std::make_shared<impl::Mapped_file>(path)),
+            flags(flags & Mapping_flags::populate),
+            advice(advice) {}
+
+        template<class U>
+        Memory_mapped_allocator(const Memory_mapped_allocator<U>& alloc) noexcept:
+            file(alloc.file),
+            flags(alloc.flags),
+            advice(alloc.advice) {}
+
+        Memory_mapped_allocator() noexcept = default;
+        Memory_mapped_allocator(const Memory_mapped_allocator&) noexcept = default;
+        Memory_mapped_allocator(Memory_mapped_allocator&&) noexcept = default;
+        ~Memory_mapped_allocator() = default;
 
         //=================================================
         // Assignment operators
         //=================================================
 
+        Memory_mapped_allocator& operator=(const Memory_mapped_allocator&) noexcept = default;
+        Memory_mapped_allocator& operator=(Memory_mapped_allocator&&) noexcept = default;
+
+        //=================================================
+        // Comparison operators
+        //=================================================
+
+        template<class U>
+        bool operator==(const Memory_mapped_allocator<U>& rhs) const noexcept {
+            return (file == rhs.file) && (flags == rhs.flags);
+        }
+
+        template<class U>
+        bool operator!=(const Memory_mapped_allocator<U>& rhs) const noexcept {
+            return !(*this == rhs);
+        }
+
         //=================================================
         // Allocation methods
         //=================================================
 
+        ///
+        /// \param n Number of objects to allocate space for
+        /// \return Pointer to page-aligned allocation large enough to hold n
+        ///     objects. nullptr if n is zero
+        pointer allocate(const size_type n) {
+            if (n == 0) {
+                return nullptr;
+            }
+
+            if (max_size() < n) {
+                throw std::bad_array_new_length{};
+            }
+
+            const size_type bytes = allocation_size(n);
+            if (file) {
+                std::lock_guard<std::mutex> lock{file->mutex};
+                return static_cast<pointer>(file->map(bytes, flags, advice));
+            } else {
+                return static_cast<pointer>(map_anonymous(bytes));
+            }
+        }
+
+        ///
+        /// Maps an existing region of the backing file, such as one which was
+        /// allocated by a previous run of the program. The region is treated
+        /// like any other allocation made by this allocator afterwards.
+        ///
+        /// \param offset Page-aligned offset of region within file
+        /// \param n Number of objects that were requested for the allocation
+        ///     which occupied the region
+        /// \return Pointer to mapping of the region
+        pointer attach(const size_type offset, const size_type n) {
+            if (!file) {
+                throw std::logic_error{"aul::Memory_mapped_allocator: attach() called on allocator which is not file-backed"};
+            }
+
+            if (n == 0 || max_size() < n) {
+                throw std::length_error{"aul::Memory_mapped_allocator: attach() called with invalid size"};
+            }
+
+            const size_type bytes = allocation_size(n);
+
+            std::lock_guard<std::mutex> lock{file->mutex};
+            return static_cast<pointer>(file->map_existing(offset, bytes, flags, advice));
+        }
+
+        ///
+        /// Unmaps an allocation. For file-backed allocations the contents
+        /// remain in the file.
+        ///
+        /// \param p Pointer to allocation previously returned by this
+        ///     allocator or one equal to it
+        /// \param n Number of objects that were requested for the allocation
+        void deallocate(const pointer p, const size_type n) noexcept {
+            if (!p) {
+                return;
+            }
+
+            const size_type bytes = allocation_size(n);
+            if (file) {
+                std::lock_guard<std::mutex> lock{file->mutex};
+                file->unmap(p, bytes);
+            } else {
+                munmap(p, bytes);
+            }
+        }
+
+        ///
+        /// Changes the size of an allocation, preserving its contents up to
+        /// the smaller of the two sizes. The contents are not relocated
+        /// through T's move constructor so this should only be used to move
+        /// objects which are trivially relocatable.
+        ///
+        /// Anonymous mappings, and the last mapping of a file, are resized
+        /// via mremap which never copies the underlying pages.
+        ///
+        /// \param p Pointer to allocation previously returned by this
+        ///     allocator or one equal to it. May be nullptr
+        /// \param old_n Number of objects that were requested for the
+        ///     allocation
+        /// \param new_n Number of objects to resize the allocation to hold
+        /// \return Pointer to resized allocation. May differ from p, in
+        ///     which case p is no longer valid. nullptr if new_n is zero
+        pointer reallocate(const pointer p, const size_type old_n, const size_type new_n) {
+            if (!p) {
+                return allocate(new_n);
+            }
+
+            if (new_n == 0) {
+                deallocate(p, old_n);
+                return nullptr;
+            }
+
+            if (max_size() < new_n) {
+                throw std::bad_array_new_length{};
+            }
+
+            const size_type old_bytes = allocation_size(old_n);
+            const size_type new_bytes = allocation_size(new_n);
+            if (old_bytes == new_bytes) {
+                return p;
+            }
+
+            if (file) {
+                std::lock_guard<std::mutex> lock{file->mutex};
+                return static_cast<pointer>(file->remap(p, old_bytes, new_bytes, flags, advice));
+            }
+
+            void* ret = mremap(p, old_bytes, new_bytes, MREMAP_MAYMOVE);
+            if (ret == MAP_FAILED) {
+                throw std::bad_alloc{};
+            }
+
+            impl::advise_mapping(ret, old_bytes, new_bytes, flags, advice);
+            return static_cast<pointer>(ret);
+        }
+
+        //=================================================
+        // Accessors
+        //=================================================
+
+        ///
+        /// \return Largest number of objects which may be allocated at once
+        size_type max_size() const noexcept {
+            const auto limit = static_cast<size_type>(std::numeric_limits<difference_type>::max());
+            return (limit - granularity() + 1) / sizeof(T);
+        }
+
+        ///
+        /// \return True if allocations are backed by a file
+        bool is_file_backed() const noexcept {
+            return bool(file);
+        }
+
+        ///
+        /// \param p Pointer to live allocation made by this allocator or one
+        ///     equal to it. Must be file-backed
+        /// \return Offset of allocation's region within the backing file
+        size_type offset_of(const const_pointer p) const {
+            if (!file) {
+                throw std::logic_error{"aul::Memory_mapped_allocator: offset_of() called on allocator which is not file-backed"};
+            }
+
+            std::lock_guard<std::mutex> lock{file->mutex};
+            return file->offset_of(const_cast<pointer>(p));
+        }
+
+        ///
+        /// \return Options applied to created mappings
+        Mapping_flags mapping_flags() const noexcept {
+            return flags;
+        }
+
+        ///
+        /// \return Advice passed to madvise for created mappings
+        int mapping_advice() const noexcept {
+            return advice;
+        }
+
+    private:
+
+        template<class U>
+        friend class Memory_mapped_allocator;
+
         //=================================================
-        // Object creation methods
+        // Helper functions
         //=================================================
 
+        ///
+        /// \return Multiple of bytes that mappings are rounded up to
+        size_type granularity() const noexcept {
+            return ((flags & Mapping_flags::huge_pages) != Mapping_flags::none) ? impl::huge_page_size() : impl::page_size();
+        }
+
+        ///
+        /// \param n Number of objects. Must not exceed max_size()
+        /// \return Size of mapping used to hold n objects
+        size_type allocation_size(const size_type n) const noexcept {
+            return impl::round_up(n * sizeof(T), granularity());
+        }
+
+        void* map_anonymous(const size_type bytes) const {
+            int mmap_flags = MAP_PRIVATE | MAP_ANONYMOUS;
+            if ((flags & Mapping_flags::populate) != Mapping_flags::none) {
+                mmap_flags |= MAP_POPULATE;
+            }
+
+            void* ret = MAP_FAILED;
+            if ((flags & Mapping_flags::huge_pages) != Mapping_flags::none) {
+                ret = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, mmap_flags | MAP_HUGETLB, -1, 0);
+
+                if (ret == MAP_FAILED) {
+                    ret = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, mmap_flags, -1, 0);
+                    if (ret != MAP_FAILED) {
+                        madvise(ret, bytes, MADV_HUGEPAGE);
+                    }
+                }
+            } else {
+                ret = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, mmap_flags, -1, 0);
+            }
+
+            if (ret == MAP_FAILED) {
+                throw std::bad_alloc{};
+            }
+
+            impl::advise_mapping(ret, 0, bytes, flags, advice);
+            return ret;
+        }
+
         //=================================================
         // Instance members
         //=================================================
 
-    private:
+        std::shared_ptr<impl::Mapped_file> file{};
+
+        Mapping_flags flags = Mapping_flags::none;
 
-        int file_descriptor = -1;
-        size_type allocation_size = 0;
-        pointer ptr;
+        int advice = MADV_NORMAL;
 
     };
 
@@ -0,0 +1,219 @@
+#ifndef AUL_MIRRORED_ALLOCATOR_HPP
+#define AUL_MIRRORED_ALLOCATOR_HPP
+
+#ifndef __linux__
+static_assert(false, "OS not supported");
+#endif
+
+#include "Memory_mapped_allocator.hpp"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <numeric>
+#include <type_traits>
+
+namespace aul {
+
+    ///
+    /// An allocator whose allocations are followed in the address space by a
+    /// second mapping of the same physical pages. Writing to p[i] is visible
+    /// through p[i + n] and vice versa, for an allocation of n objects.
+    ///
+    /// This lets a ring buffer present any run of its elements, including
+    /// one which wraps around the end of the buffer, as a single contiguous
+    /// range, e.g. to pass to memcpy or write(). See
+    /// aul::Circular_array_mirrored_capacity.
+    ///
+    /// The mirror only begins immediately after the nth object if n objects
+    /// occupy a whole number of pages. allocation_granularity() gives the
+    /// number of objects allocation sizes should be a multiple of. Other
+    /// sizes are rounded up to the next whole page.
+    ///
+    /// Allocations are backed by an anonymous file created with
+    /// memfd_create, which is mapped twice, back to back. Each allocation
+    /// therefore consumes two mappings and a brief use of a file descriptor,
+    /// so this allocator is best suited for a small number of large
+    /// allocations.
+    ///
+    /// \tparam T Allocator value type
+    template<class T>
+    class Mirrored_allocator {
+    public:
+
+        //=================================================
+        // Type aliases
+        //=================================================
+
+        using value_type = T;
+
+        using pointer = T*;
+        using const_pointer = const T*;
+
+        using void_pointer = void*;
+        using const_void_pointer = const void*;
+
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+
+        using propagate_on_container_copy_assignment = std::false_type;
+        using propagate_on_container_move_assignment = std::false_type;
+        using propagate_on_container_swap = std::false_type;
+
+        using is_always_equal = std::true_type;
+
+        template<class U>
+        struct rebind {
+            using other = Mirrored_allocator<U>;
+        };
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+        template<class U>
+        Mirrored_allocator(const Mirrored_allocator<U>&) noexcept {}
+
+        Mirrored_allocator() noexcept = default;
+        Mirrored_allocator(const Mirrored_allocator&) noexcept = default;
+        Mirrored_allocator(Mirrored_allocator&&) noexcept = default;
+        ~Mirrored_allocator() = default;
+
+        //=================================================
+        // Assignment operators
+        //=================================================
+
+        Mirrored_allocator& operator=(const Mirrored_allocator&) noexcept = default;
+        Mirrored_allocator& operator=(Mirrored_allocator&&) noexcept = default;
+
+        //=================================================
+        // Comparison operators
+        //=================================================
+
+        template<class U>
+        bool operator==(const Mirrored_allocator<U>&) const noexcept {
+            return true;
+        }
+
+        template<class U>
+        bool operator!=(const Mirrored_allocator<U>&) const noexcept {
+            return false;
+        }
+
+        //=================================================
+        // Allocation methods
+        //=================================================
+
+        ///
+        /// \param n Number of objects to allocate space for
+        /// \return Pointer to page-aligned allocation large enough to hold n
+        ///     objects, immediately followed by a mirror of itself. nullptr if
+        ///     n is zero
+        pointer allocate(const size_type n) {
+            if (n == 0) {
+                return nullptr;
+            }
+
+            if (max_size() < n) {
+                throw std::bad_alloc{};
+            }
+
+            return static_cast<pointer>(map_mirrored(allocation_size(n)));
+        }
+
+        ///
+        /// \param p Pointer to allocation previously returned by this
+        ///     allocator or one equal to it
+        /// \param n Number of objects that were requested for the allocation
+        void deallocate(const pointer p, const size_type n) noexcept {
+            if (!p) {
+                return;
+            }
+
+            munmap(p, 2 * allocation_size(n));
+        }
+
+        //=================================================
+        // Accessors
+        //=================================================
+
+        ///
+        /// \return Largest number of objects which may be allocated at once
+        [[nodiscard]]
+        size_type max_size() const noexcept {
+            const size_type m = std::numeric_limits<difference_type>::max() / (2 * sizeof(T));
+            return m - m % allocation_granularity();
+        }
+
+        ///
+        /// \return Smallest number of objects which occupies a whole number
+        ///     of pages
+        [[nodiscard]]
+        static size_type allocation_granularity() noexcept {
+            const size_type page = impl::page_size();
+            return page / std::gcd(page, sizeof(T));
+        }
+
+    private:
+
+        //=================================================
+        // Helper functions
+        //=================================================
+
+        ///
+        /// \param n Number of objects
+        /// \return Size of each of the two mappings used to hold n objects
+        static size_type allocation_size(const size_type n) noexcept {
+            return impl::round_up(n * sizeof(T), impl::page_size());
+        }
+
+        ///
+        /// Reserves 2 * bytes of address space then maps a new anonymous file
+        /// of the given size over both halves of it.
+        ///
+        /// \param bytes Size of allocation. Must be a multiple of the page size
+        /// \return Pointer to first of the two mappings
+        static void* map_mirrored(const size_type bytes) {
+            const int descriptor = memfd_create("aul::Mirrored_allocator", MFD_CLOEXEC);
+            if (descriptor == -1) {
+                throw std::bad_alloc{};
+            }
+
+            if (ftruncate(descriptor, static_cast<off_t>(bytes)) == -1) {
+                close(descriptor);
+                throw std::bad_alloc{};
+            }
+
+            void* reservation = mmap(nullptr, 2 * bytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (reservation == MAP_FAILED) {
+                close(descriptor);
+                throw std::bad_alloc{};
+            }
+
+            auto* first = static_cast<char*>(reservation);
+            auto* second = first + bytes;
+
+            const int prot = PROT_READ | PROT_WRITE;
+            const int flags = MAP_SHARED | MAP_FIXED;
+            if (
+                mmap(first, bytes, prot, flags, descriptor, 0) == MAP_FAILED ||
+                mmap(second, bytes, prot, flags, descriptor, 0) == MAP_FAILED
+            ) {
+                munmap(reservation, 2 * bytes);
+                close(descriptor);
+                throw std::bad_alloc{};
+            }
+
+            // The mappings keep the file alive
+            close(descriptor);
+            return reservation;
+        }
+
+    };
+
+}
+
+#endif //AUL_MIRRORED_ALLOCATOR_HPP
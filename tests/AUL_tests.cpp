@@ -1,14 +1,25 @@
 #include "containers/Array_map_tests.hpp"
-//#include "containers/Circular_array_tests.hpp"
+#include "containers/Circular_array_tests.hpp"
 //#include "containers/Matrix_tests.hpp"
 //#include "containers/Random_access_iterator_tests.hpp"
-//#include "containers/Slot_map_tests.hpp"
-#include "containers/Zipperator_tests.hpp"
+#include "containers/Slot_map_tests.hpp"
+#include "containers/Zipper_iterator_tests.hpp"
+#include "containers/Soa_slot_map_tests.hpp"
+#include "containers/Concurrent_slot_map_tests.hpp"
+#include "containers/Paged_slot_map_tests.hpp"
+#include "containers/Concurrent_circular_buffer_tests.hpp"
 
-//#include "memory/Memory_tests.hpp"
+#include "memory/Memory_tests.hpp"
+#include "memory/Memory_mapped_allocator_tests.hpp"
+#include "memory/Epoch_domain_tests.hpp"
+#include "memory/Mirrored_allocator_tests.hpp"
 
-//#include "Algorithms_tests.hpp"
-//#include "Bit_tests.hpp"
+#include "concurrency/Chase_lev_deque_tests.hpp"
+#include "concurrency/Thread_pool_tests.hpp"
+
+#include "Algorithms_tests.hpp"
+#include "Parallel_algorithms_tests.hpp"
+#include "Bit_tests.hpp"
 //#include "Math_tests.hpp"
 //#include "Utility_tests.hpp"
 
@@ -7,9 +7,70 @@
 
 #include <algorithm>
 #include <numeric>
+#include <vector>
+#include <random>
+#include <cstdint>
+#include <limits>
 
 namespace aul::tests {
 
+    ///
+    /// Checks linear_search and binary_search over raw pointers, which may
+    /// use vectorized kernels, against std::find_if and std::lower_bound
+    ///
+    template<class T>
+    void test_pointer_searches(const T lowest, const T highest) {
+        std::mt19937_64 engine{0x5eed};
+        std::uniform_int_distribution<std::int64_t> distribution{0, 100};
+
+        // Spreads 101 values evenly over [lowest, highest]
+        auto value_at = [&] (const std::int64_t i) {
+            const long double range = static_cast<long double>(highest) - static_cast<long double>(lowest);
+            return static_cast<T>(static_cast<long double>(lowest) + range * static_cast<long double>(i) / 100);
+        };
+
+        for (std::size_t n = 0; n < 100; ++n) {
+            std::vector<T> vec(n);
+            for (auto& x : vec) {
+                x = value_at(distribution(engine));
+            }
+
+            std::vector<T> sorted = vec;
+            std::sort(sorted.begin(), sorted.end());
+
+            for (std::int64_t i = 0; i <= 100; ++i) {
+                const T val = value_at(i);
+
+                const T* begin = vec.data();
+                const T* end = vec.data() + vec.size();
+
+                const T* expected_linear = std::find_if(begin, end, [&] (const T x) { return !(x < val); });
+                EXPECT_EQ(aul::linear_search(begin, end, val), expected_linear);
+
+                begin = sorted.data();
+                end = sorted.data() + sorted.size();
+
+                EXPECT_EQ(aul::binary_search(begin, end, val), std::lower_bound(begin, end, val));
+            }
+        }
+    }
+
+    TEST(aul_linear_search, Pointer_arithmetic_types) {
+        test_pointer_searches<std::int32_t>(std::numeric_limits<std::int32_t>::min(), std::numeric_limits<std::int32_t>::max());
+        test_pointer_searches<std::uint32_t>(0, std::numeric_limits<std::uint32_t>::max());
+        test_pointer_searches<std::int64_t>(std::numeric_limits<std::int64_t>::min(), std::numeric_limits<std::int64_t>::max());
+        test_pointer_searches<std::uint64_t>(0, std::numeric_limits<std::uint64_t>::max());
+        test_pointer_searches<float>(-1.0e6f, 1.0e6f);
+        test_pointer_searches<double>(-1.0e9, 1.0e9);
+    }
+
+    TEST(aul_linear_search, Constant_evaluation) {
+        static constexpr int arr[] = {1, 2, 3, 5, 8, 13, 21, 34, 55, 89};
+
+        static_assert(aul::linear_search(arr, arr + 10, 8) == arr + 4);
+        static_assert(aul::binary_search(arr, arr + 10, 9) == arr + 5);
+    }
+
     TEST(aul_linear_search, empty) {
         std::vector<float> vec;
 
@@ -104,6 +165,94 @@ namespace aul::tests {
         EXPECT_EQ(vec.begin(), aul::binary_search(vec.begin(), vec.end(), 4));
     }
 
+    ///
+    /// Checks a search function against std::lower_bound over ranges of
+    /// several sizes and distributions
+    ///
+    template<class F>
+    void test_lower_bound_equivalence(F search) {
+        std::mt19937_64 engine{0x5eed};
+
+        for (std::size_t n : {0, 1, 2, 3, 17, 100, 1000, 10000}) {
+            std::vector<std::vector<std::int64_t>> ranges(4, std::vector<std::int64_t>(n));
+
+            // Evenly spaced
+            for (std::size_t i = 0; i < n; ++i) {
+                ranges[0][i] = 10 * static_cast<std::int64_t>(i);
+            }
+
+            // Uniformly distributed, with duplicates
+            std::uniform_int_distribution<std::int64_t> uniform{0, static_cast<std::int64_t>(5 * n)};
+            for (auto& x : ranges[1]) {
+                x = uniform(engine);
+            }
+            std::sort(ranges[1].begin(), ranges[1].end());
+
+            // Heavily skewed
+            for (std::size_t i = 0; i < n; ++i) {
+                ranges[2][i] = static_cast<std::int64_t>(i * i * i);
+            }
+
+            // Mostly equal with an outlier
+            std::fill(ranges[3].begin(), ranges[3].end(), 5);
+            if (n != 0) {
+                ranges[3].back() = std::numeric_limits<std::int64_t>::max() / 2;
+            }
+
+            for (const auto& range : ranges) {
+                std::vector<std::int64_t> vals = {-1, 0, 5, 6, std::numeric_limits<std::int64_t>::max() / 2 + 1};
+                for (std::size_t i = 0; i < n; i += 1 + n / 50) {
+                    vals.push_back(range[i]);
+                    vals.push_back(range[i] + 1);
+                    vals.push_back(range[i] - 1);
+                }
+
+                for (const auto val : vals) {
+                    auto expected = std::lower_bound(range.begin(), range.end(), val);
+                    ASSERT_EQ(search(range.begin(), range.end(), val), expected) << "n = " << n << ", val = " << val;
+                }
+            }
+        }
+    }
+
+    TEST(aul_exponential_search, Lower_bound_equivalence) {
+        test_lower_bound_equivalence([] (auto begin, auto end, const std::int64_t val) {
+            return aul::exponential_search(begin, end, val);
+        });
+    }
+
+    TEST(aul_exponential_search, Constant_evaluation) {
+        static constexpr int arr[] = {1, 2, 3, 5, 8, 13, 21, 34, 55, 89};
+
+        static_assert(aul::exponential_search(arr, arr + 10, 0) == arr + 0);
+        static_assert(aul::exponential_search(arr, arr + 10, 22) == arr + 7);
+        static_assert(aul::exponential_search(arr, arr + 10, 90) == arr + 10);
+    }
+
+    TEST(aul_interpolation_search, Lower_bound_equivalence) {
+        test_lower_bound_equivalence([] (auto begin, auto end, const std::int64_t val) {
+            return aul::interpolation_search(begin, end, val);
+        });
+    }
+
+    TEST(aul_interpolation_search, Descending) {
+        std::vector<double> vec(1000);
+        for (std::size_t i = 0; i < vec.size(); ++i) {
+            vec[i] = 1000.0 - static_cast<double>(i);
+        }
+
+        const auto c = std::greater<double>{};
+        for (double val : {1001.0, 1000.0, 500.5, 500.0, 1.0, 0.0}) {
+            EXPECT_EQ(aul::interpolation_search(vec.begin(), vec.end(), val, c), std::lower_bound(vec.begin(), vec.end(), val, c));
+        }
+    }
+
+    TEST(aul_interpolation_sequential_search, Lower_bound_equivalence) {
+        test_lower_bound_equivalence([] (auto begin, auto end, const std::int64_t val) {
+            return aul::interpolation_sequential_search(begin, end, val);
+        });
+    }
+
 }
 
 #endif //AUL_TESTS_ALGORITHMS_TESTS_HPP
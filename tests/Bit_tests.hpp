@@ -32,6 +32,24 @@ namespace aul::tests {
         EXPECT_EQ(aul::mod_pow2(5u, 1u), 1);
     }
 
+    TEST(Bits, Ceil2) {
+        EXPECT_EQ(aul::ceil2<std::uint8_t>(1), 1);
+        EXPECT_EQ(aul::ceil2<std::uint8_t>(3), 4);
+        EXPECT_EQ(aul::ceil2<std::uint8_t>(128), 128);
+        EXPECT_EQ(aul::ceil2<std::uint32_t>(0x40000001), 0x80000000);
+        EXPECT_EQ(aul::ceil2<std::uint64_t>(5), 8);
+        EXPECT_EQ(aul::ceil2<std::uint64_t>(0x100000001), 0x200000000);
+        EXPECT_EQ(aul::ceil2<std::uint64_t>(0x8000000000000000), 0x8000000000000000);
+    }
+
+    TEST(Bits, Floor2) {
+        EXPECT_EQ(aul::floor2<std::uint8_t>(1), 1);
+        EXPECT_EQ(aul::floor2<std::uint8_t>(255), 128);
+        EXPECT_EQ(aul::floor2<std::uint32_t>(0x7FFFFFFF), 0x40000000);
+        EXPECT_EQ(aul::floor2<std::uint64_t>(0x300000000), 0x200000000);
+        EXPECT_EQ(aul::floor2<std::uint64_t>(0xFFFFFFFFFFFFFFFF), 0x8000000000000000);
+    }
+
 }
 
 #endif //AUL_TESTS_BIT_TESTS_HPP
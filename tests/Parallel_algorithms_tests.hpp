@@ -0,0 +1,77 @@
+#ifndef AUL_TESTS_PARALLEL_ALGORITHMS_TESTS_HPP
+#define AUL_TESTS_PARALLEL_ALGORITHMS_TESTS_HPP
+
+#include <aul/Parallel_algorithms.hpp>
+#include <aul/containers/Packed_vector.hpp>
+#include <aul/containers/Slot_map.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace aul::tests {
+
+    TEST(Parallel_algorithms, Contiguous_containers) {
+        aul::Slot_map<std::uint64_t> slot_map;
+        aul::Packed_vector<std::uint64_t> packed_vector(std::size_t{100000}, std::uint64_t{0});
+        for (std::uint64_t i = 0; i < 100000; ++i) {
+            slot_map.insert(i);
+            packed_vector.data()[i] = i;
+        }
+
+        aul::Thread_pool pool{3};
+        aul::parallel_for_each(pool, slot_map, [] (std::uint64_t& x) { x *= 2; });
+        aul::parallel_for_each(packed_vector, [] (std::uint64_t& x) { x += 1; });
+
+        std::vector<std::uint64_t> out(slot_map.size());
+        auto end = aul::parallel_transform(pool, slot_map, out.begin(), [] (const std::uint64_t x) { return x + 1; });
+        EXPECT_EQ(end, out.end());
+
+        for (std::uint64_t i = 0; i < 100000; ++i) {
+            EXPECT_EQ(slot_map.data()[i], 2 * i);
+            EXPECT_EQ(packed_vector.data()[i], i + 1);
+            EXPECT_EQ(out[i], 2 * i + 1);
+        }
+    }
+
+    TEST(Parallel_algorithms, Circular_array) {
+        // Wraps around the end of its allocation
+        aul::Circular_array<std::uint32_t> arr(std::size_t{50000}, std::uint32_t{0});
+        for (std::uint32_t i = 0; i < 20000; ++i) {
+            arr.pop_front();
+        }
+        for (std::uint32_t i = 0; i < 20000; ++i) {
+            arr.push_back(0);
+        }
+        ASSERT_EQ(arr.size(), 50000);
+
+        const auto segments = aul::impl::contiguous_segments_of(arr);
+        EXPECT_EQ(segments[0].size, 30000);
+        EXPECT_EQ(segments[1].size, 20000);
+
+        std::uint32_t i = 0;
+        for (auto& x : arr) {
+            x = i++;
+        }
+
+        aul::Thread_pool pool{3};
+        aul::parallel_for_each(pool, arr, [] (std::uint32_t& x) { x = 3 * x; });
+
+        const auto& carr = arr;
+        std::vector<std::uint32_t> out(carr.size());
+        aul::parallel_transform(carr, out.begin(), [] (const std::uint32_t x) { return x + 1; });
+
+        for (std::uint32_t j = 0; j < 50000; ++j) {
+            EXPECT_EQ(arr[j], 3 * j);
+            EXPECT_EQ(out[j], 3 * j + 1);
+        }
+
+        aul::Circular_array<std::uint32_t> empty;
+        aul::parallel_for_each(empty, [] (std::uint32_t&) { FAIL(); });
+    }
+
+}
+
+#endif //AUL_TESTS_PARALLEL_ALGORITHMS_TESTS_HPP
@@ -0,0 +1,87 @@
+#ifndef AUL_CHASE_LEV_DEQUE_TESTS_HPP
+#define AUL_CHASE_LEV_DEQUE_TESTS_HPP
+
+#include <aul/concurrency/Chase_lev_deque.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace aul::tests {
+
+    TEST(Chase_lev_deque, Single_thread) {
+        aul::Chase_lev_deque<int> deque{4};
+        EXPECT_EQ(deque.capacity(), 4);
+        EXPECT_FALSE(deque.pop());
+        EXPECT_FALSE(deque.steal());
+
+        for (int i = 0; i < 10; ++i) {
+            deque.push(i);
+        }
+        EXPECT_EQ(deque.size(), 10);
+        EXPECT_GE(deque.capacity(), 10);
+
+        // Owner takes newest, thieves take oldest
+        EXPECT_EQ(*deque.pop(), 9);
+        EXPECT_EQ(*deque.steal(), 0);
+        EXPECT_EQ(*deque.steal(), 1);
+        EXPECT_EQ(*deque.pop(), 8);
+
+        for (int i = 7; i >= 2; --i) {
+            EXPECT_EQ(*deque.pop(), i);
+        }
+        EXPECT_TRUE(deque.empty());
+        EXPECT_FALSE(deque.pop());
+    }
+
+    TEST(Chase_lev_deque, Concurrent_thieves) {
+        constexpr std::uint32_t count = 100000;
+
+        aul::Chase_lev_deque<std::uint32_t> deque;
+        std::vector<std::atomic<int>> seen(count);
+        std::atomic<bool> done{false};
+
+        auto thief = [&] {
+            while (!done.load(std::memory_order_acquire) || !deque.empty()) {
+                if (auto x = deque.steal()) {
+                    seen[*x].fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        };
+
+        std::vector<std::thread> thieves;
+        for (int i = 0; i < 3; ++i) {
+            thieves.emplace_back(thief);
+        }
+
+        for (std::uint32_t i = 0; i < count; ++i) {
+            deque.push(i);
+            if (i % 3 == 0) {
+                if (auto x = deque.pop()) {
+                    seen[*x].fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        }
+        while (auto x = deque.pop()) {
+            seen[*x].fetch_add(1, std::memory_order_relaxed);
+        }
+        done.store(true, std::memory_order_release);
+
+        for (auto& t : thieves) {
+            t.join();
+        }
+
+        // Every element was taken exactly once
+        for (const auto& s : seen) {
+            EXPECT_EQ(s.load(), 1);
+        }
+    }
+
+}
+
+#endif //AUL_CHASE_LEV_DEQUE_TESTS_HPP
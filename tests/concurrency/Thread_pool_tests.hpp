@@ -0,0 +1,81 @@
+#ifndef AUL_THREAD_POOL_TESTS_HPP
+#define AUL_THREAD_POOL_TESTS_HPP
+
+#include <aul/concurrency/Thread_pool.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace aul::tests {
+
+    std::uint64_t parallel_fibonacci(aul::Thread_pool& pool, const std::uint64_t n) {
+        if (n < 2) {
+            return n;
+        }
+
+        std::uint64_t a = 0;
+        aul::Task_group group{pool};
+        group.run([&] { a = parallel_fibonacci(pool, n - 1); });
+        const std::uint64_t b = parallel_fibonacci(pool, n - 2);
+        group.wait();
+
+        return a + b;
+    }
+
+    TEST(Thread_pool, Task_group) {
+        for (std::size_t workers : {0, 1, 3}) {
+            aul::Thread_pool pool{workers};
+            EXPECT_EQ(pool.worker_count(), workers);
+            EXPECT_FALSE(pool.is_worker_thread());
+
+            // Nested fork/join
+            EXPECT_EQ(parallel_fibonacci(pool, 18), 2584);
+
+            std::atomic<int> count{0};
+            aul::Task_group group{pool};
+            for (int i = 0; i < 100; ++i) {
+                group.run([&] { count.fetch_add(1, std::memory_order_relaxed); });
+            }
+            group.wait();
+            EXPECT_EQ(count.load(), 100);
+
+            // Exceptions reach wait() and the group remains usable
+            group.run([] { throw std::runtime_error(""); });
+            group.run([&] { count.fetch_add(1, std::memory_order_relaxed); });
+            EXPECT_THROW(group.wait(), std::runtime_error);
+            EXPECT_EQ(count.load(), 101);
+            EXPECT_NO_THROW(group.wait());
+        }
+    }
+
+    TEST(Thread_pool, Parallel_for) {
+        aul::Thread_pool pool{3};
+
+        std::vector<std::atomic<int>> counts(10000);
+        aul::parallel_for(pool, 0, counts.size(), 0, [&] (const std::size_t i) {
+            counts[i].fetch_add(1, std::memory_order_relaxed);
+        });
+        aul::parallel_for(pool, 100, 200, 7, [&] (const std::size_t i) {
+            counts[i].fetch_add(1, std::memory_order_relaxed);
+        });
+        aul::parallel_for(5, 5, [&] (const std::size_t) { FAIL(); });
+
+        for (std::size_t i = 0; i < counts.size(); ++i) {
+            EXPECT_EQ(counts[i].load(), (100 <= i && i < 200) ? 2 : 1);
+        }
+
+        EXPECT_THROW(aul::parallel_for(pool, 0, 1000, 10, [] (const std::size_t i) {
+            if (i == 777) {
+                throw std::runtime_error("");
+            }
+        }), std::runtime_error);
+    }
+
+}
+
+#endif //AUL_THREAD_POOL_TESTS_HPP
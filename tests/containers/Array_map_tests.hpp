@@ -7,6 +7,13 @@
 #include <gtest/gtest.h>
 #include <string>
 #include <iostream>
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <utility>
+#include <atomic>
+#include <thread>
+#include <stdexcept>
 
 namespace aul::tests {
 
@@ -254,6 +261,119 @@ namespace aul::tests {
         EXPECT_EQ(arr[8], 48);
     }
 
+    TEST(Array_map, Insert_range) {
+        aul::Array_map<int, int> map{};
+        map.insert(4, 40);
+        map.insert(10, 100);
+
+        std::vector<int> keys{7, 3, 4, 12, 3, 0, 10, 9};
+        std::vector<int> vals{70, 30, -1, 120, -1, 0, -1, 90};
+
+        EXPECT_EQ(map.insert_range(keys.begin(), keys.end(), vals.begin()), 5);
+        EXPECT_EQ(map.size(), 7);
+
+        std::vector<int> expected_keys{0, 3, 4, 7, 9, 10, 12};
+        for (std::size_t i = 0; i < expected_keys.size(); ++i) {
+            EXPECT_EQ(map.keys()[i], expected_keys[i]);
+            EXPECT_EQ(map[expected_keys[i]], expected_keys[i] * 10);
+        }
+    }
+
+    TEST(Array_map, Insert_range_within_capacity) {
+        aul::Array_map<int, int> map{};
+        map.reserve(64);
+        map.insert(5, 50);
+        map.insert(15, 150);
+        map.insert(25, 250);
+
+        std::vector<int> keys;
+        std::vector<int> vals;
+        for (int i = 30; i-- > 0;) {
+            keys.push_back(i);
+            vals.push_back(i * 10);
+        }
+
+        EXPECT_EQ(map.insert_range(keys.begin(), keys.end(), vals.begin()), 27);
+        EXPECT_EQ(map.size(), 30);
+        EXPECT_EQ(map.capacity(), 64);
+
+        for (int i = 0; i < 30; ++i) {
+            EXPECT_EQ(map.keys()[i], i);
+            EXPECT_EQ(map[i], i * 10);
+        }
+    }
+
+    ///
+    /// Value type whose copy constructor throws once a shared budget of copies
+    /// is exhausted and whose move constructor may throw
+    ///
+    struct Limited_copy {
+
+        static inline int copies_left = -1;
+
+        Limited_copy(int v):
+            v(v) {}
+
+        Limited_copy(const Limited_copy& other):
+            v(other.v) {
+            if (copies_left == 0) {
+                throw std::runtime_error{"Copy limit reached"};
+            }
+
+            if (copies_left > 0) {
+                --copies_left;
+            }
+        }
+
+        Limited_copy(Limited_copy&& other) noexcept(false):
+            Limited_copy(static_cast<const Limited_copy&>(other)) {}
+
+        Limited_copy& operator=(const Limited_copy&) = default;
+
+        int v = 0;
+
+    };
+
+    TEST(Array_map, Insert_range_strong_guarantee) {
+        aul::Array_map<std::string, Limited_copy> map{};
+        for (int i = 0; i < 8; ++i) {
+            map.insert(std::string(32, char('a' + 2 * i)), Limited_copy{i});
+        }
+
+        std::vector<std::string> keys{std::string(32, 'b'), std::string(32, 'z')};
+        std::vector<Limited_copy> vals{Limited_copy{100}, Limited_copy{200}};
+
+        // Fail while relocating the existing elements
+        Limited_copy::copies_left = 5;
+        EXPECT_THROW(map.insert_range(keys.begin(), keys.end(), vals.begin()), std::runtime_error);
+        Limited_copy::copies_left = -1;
+
+        ASSERT_EQ(map.size(), 8);
+        for (int i = 0; i < 8; ++i) {
+            EXPECT_EQ(map.keys()[i], std::string(32, char('a' + 2 * i)));
+            EXPECT_EQ(map.values()[i].v, i);
+        }
+    }
+
+    TEST(Array_map, Insert_sorted) {
+        aul::Array_map<int, std::string> map{};
+        map.insert(2, "two");
+
+        std::vector<int> keys{0, 1, 2, 2, 3};
+        std::vector<std::string> vals{"zero", "one", "deux", "dos", "three"};
+
+        EXPECT_EQ(map.insert_sorted(keys.begin(), keys.end(), vals.begin()), 3);
+        EXPECT_EQ(map.size(), 4);
+
+        EXPECT_EQ(map[0], "zero");
+        EXPECT_EQ(map[1], "one");
+        EXPECT_EQ(map[2], "two");
+        EXPECT_EQ(map[3], "three");
+
+        EXPECT_EQ(map.insert_sorted(keys.begin(), keys.end(), vals.begin()), 0);
+        EXPECT_EQ(map.size(), 4);
+    }
+
     TEST(Array_map, Erase) {
         aul::Array_map<int, float> arr{};
         EXPECT_EQ(arr.end(), arr.erase(0));
@@ -396,6 +516,225 @@ namespace aul::tests {
         EXPECT_EQ(std::get<1>(*map.find(4)), 4.0);
     }
 
+    TEST(Array_map, Find_many) {
+        aul::Array_map<int, int> map;
+        for (int i = 0; i < 500; ++i) {
+            map.emplace(3 * i, i);
+        }
+
+        std::vector<int> keys;
+        for (int i = -5; i < 1505; ++i) {
+            keys.push_back((i * 7) % 1510);
+        }
+
+        const aul::Span<const int> key_span{keys.data(), keys.size()};
+
+        std::vector<aul::Array_map<int, int>::iterator> iterators(keys.size());
+        map.find_many(key_span, aul::Span<aul::Array_map<int, int>::iterator>{iterators.data(), iterators.size()});
+
+        std::vector<std::size_t> indices(keys.size());
+        map.find_many(key_span, aul::Span<std::size_t>{indices.data(), indices.size()});
+
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            EXPECT_EQ(iterators[i], map.find(keys[i]));
+            if (map.contains(keys[i])) {
+                EXPECT_EQ(indices[i], keys[i] / 3);
+            } else {
+                EXPECT_EQ(indices[i], map.size());
+            }
+        }
+    }
+
+    TEST(Array_map, Contains_many) {
+        aul::Array_map<int, int> map;
+        for (int i = 0; i < 100; ++i) {
+            map.emplace(2 * i, i);
+        }
+
+        std::vector<int> keys;
+        for (int i = -1; i < 250; ++i) {
+            keys.push_back(i);
+        }
+
+        std::unique_ptr<bool[]> results{new bool[keys.size()]};
+        map.contains_many({keys.data(), keys.size()}, {results.get(), keys.size()});
+
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            EXPECT_EQ(results[i], map.contains(keys[i]));
+        }
+
+        EXPECT_THROW(map.contains_many({keys.data(), keys.size()}, {results.get(), keys.size() - 1}), std::length_error);
+    }
+
+    //=====================================================
+    // Search policies
+    //=====================================================
+
+    TEST(Array_map, Eytzinger_find) {
+        aul::Array_map<int, int, std::less<int>, std::allocator<int>, aul::Eytzinger_search_policy> map;
+
+        // Even keys only, so that odd keys fall between existing keys
+        std::vector<int> keys;
+        for (int i = 0; i < 1000; ++i) {
+            keys.push_back(2 * ((i * 7919) % 1000));
+        }
+        map.insert_range(keys.begin(), keys.end(), keys.begin());
+
+        for (int i = -1; i < 2001; ++i) {
+            auto it = map.find(i);
+            if (i % 2 == 0 && 0 <= i && i < 2000) {
+                ASSERT_NE(it, map.end());
+                EXPECT_EQ(std::get<1>(*it), i);
+            } else {
+                EXPECT_EQ(it, map.end());
+            }
+        }
+
+        // Iteration order is unaffected by the search policy
+        EXPECT_TRUE(std::is_sorted(map.keys().begin(), map.keys().end()));
+    }
+
+    TEST(Array_map, Eytzinger_find_all_sizes) {
+        // Covers trees whose last level is empty, partial, and full
+        for (int n = 1; n < 70; ++n) {
+            aul::Array_map<int, int, std::less<int>, std::allocator<int>, aul::Eytzinger_search_policy> map;
+            for (int i = 0; i < n; ++i) {
+                map.emplace(2 * i, i);
+            }
+
+            for (int i = -1; i <= 2 * n; ++i) {
+                auto it = map.find(i);
+                if (i % 2 == 0 && 0 <= i && i < 2 * n) {
+                    ASSERT_NE(it, map.end()) << "n = " << n << ", key = " << i;
+                    EXPECT_EQ(std::get<1>(*it), i / 2);
+                } else {
+                    EXPECT_EQ(it, map.end()) << "n = " << n << ", key = " << i;
+                }
+            }
+        }
+    }
+
+    template<class S>
+    void test_search_policy() {
+        aul::Array_map<std::uint64_t, int, std::less<std::uint64_t>, std::allocator<int>, S> map;
+
+        // Evenly spaced keys, as with timestamps, followed by a gap
+        for (int i = 0; i < 1000; ++i) {
+            map.emplace(1'000'000 + 10 * i, i);
+        }
+        map.emplace(1'000'000'000, -1);
+
+        for (int i = 0; i < 1000; ++i) {
+            ASSERT_EQ(map.at(1'000'000 + 10 * i), i);
+            EXPECT_FALSE(map.contains(1'000'000 + 10 * i + 5));
+        }
+        EXPECT_EQ(map.at(1'000'000'000), -1);
+        EXPECT_FALSE(map.contains(0));
+        EXPECT_FALSE(map.contains(999'999'999));
+        EXPECT_FALSE(map.contains(1'000'000'001));
+
+        std::vector<std::uint64_t> keys = {0, 1'000'000, 1'000'005, 1'009'990, 1'000'000'000};
+        std::vector<std::size_t> indices(keys.size());
+        map.find_many(aul::Span<const std::uint64_t>{keys.data(), keys.size()}, aul::Span<std::size_t>{indices.data(), indices.size()});
+        EXPECT_EQ(indices, (std::vector<std::size_t>{1001, 0, 1001, 999, 1000}));
+    }
+
+    TEST(Array_map, Exponential_search_policy) {
+        test_search_policy<aul::Exponential_search_policy>();
+    }
+
+    TEST(Array_map, Interpolation_search_policy) {
+        test_search_policy<aul::Interpolation_search_policy>();
+    }
+
+    TEST(Array_map, Interpolation_sequential_search_policy) {
+        test_search_policy<aul::Interpolation_sequential_search_policy>();
+    }
+
+    TEST(Array_map, Eytzinger_find_after_modification) {
+        aul::Array_map<int, int, std::less<int>, std::allocator<int>, aul::Eytzinger_search_policy> map;
+
+        for (int i = 0; i < 100; ++i) {
+            map.emplace(i, i);
+        }
+        EXPECT_TRUE(map.contains(50));
+
+        map.erase(50);
+        EXPECT_FALSE(map.contains(50));
+        EXPECT_EQ(std::get<1>(*map.find(51)), 51);
+
+        map.emplace(1000, 1);
+        EXPECT_EQ(map.at(1000), 1);
+        EXPECT_EQ(map.at(99), 99);
+
+        auto copy = map;
+        EXPECT_EQ(copy.at(1000), 1);
+        EXPECT_FALSE(copy.contains(50));
+
+        map.clear();
+        EXPECT_FALSE(map.contains(0));
+        EXPECT_EQ(map.find(0), map.end());
+    }
+
+    TEST(Array_map, Eytzinger_concurrent_find) {
+        aul::Array_map<int, int, std::less<int>, std::allocator<int>, aul::Eytzinger_search_policy> map;
+
+        for (int i = 0; i < 1000; ++i) {
+            map.emplace(2 * i, i);
+        }
+
+        auto moved = std::move(map);
+        moved.erase(0);
+
+        // Lookups on an unmodified container don't write to it
+        const auto& view = moved;
+        std::vector<std::thread> threads;
+        std::atomic<int> mismatches{0};
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([&view, &mismatches] {
+                for (int i = 1; i < 1000; ++i) {
+                    if (!view.contains(2 * i) || view.contains(2 * i + 1)) {
+                        ++mismatches;
+                    }
+                }
+            });
+        }
+
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        EXPECT_EQ(mismatches.load(), 0);
+        EXPECT_FALSE(view.contains(0));
+        EXPECT_FALSE(map.contains(2));
+    }
+
+    TEST(Array_map, Eytzinger_find_many) {
+        using map_type = aul::Array_map<int, int, std::less<int>, std::allocator<int>, aul::Eytzinger_search_policy>;
+
+        for (int n : {0, 1, 2, 7, 8, 100, 1000}) {
+            map_type map;
+            for (int i = 0; i < n; ++i) {
+                map.emplace(2 * i, i);
+            }
+
+            std::vector<int> keys;
+            for (int i = -1; i <= 2 * n; ++i) {
+                keys.push_back(i);
+            }
+
+            std::vector<map_type::const_iterator> iterators(keys.size());
+            map.find_many(
+                aul::Span<const int>{keys.data(), keys.size()},
+                aul::Span<map_type::const_iterator>{iterators.data(), iterators.size()}
+            );
+
+            for (std::size_t i = 0; i < keys.size(); ++i) {
+                EXPECT_EQ(iterators[i], std::as_const(map).find(keys[i]));
+            }
+        }
+    }
+
 }
 
 #endif //AUL_ARRAY_MAP_TESTS_HPP
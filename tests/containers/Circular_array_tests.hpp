@@ -6,8 +6,14 @@
 #define AUL_CIRCULAR_ARRAY_TESTS_HPP
 
 #include <aul/containers/Circular_array.hpp>
+#include <aul/memory/Memory_mapped_allocator.hpp>
+#include <aul/memory/Mirrored_allocator.hpp>
 
 #include <iostream>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <type_traits>
 #include <gtest/gtest.h>
 
 namespace aul::tests {
@@ -463,6 +469,477 @@ namespace aul::tests {
         //EXPECT_TRUE(arr.empty());
     }
 
+
+    TEST(Circular_array, Grow_in_place_relocate_tail) {
+        aul::Circular_array<int, aul::Memory_mapped_allocator<int>> arr{};
+        arr.reserve(8);
+
+        for (int i = 0; i < 8; ++i) {
+            arr.push_back(i);
+        }
+        for (int i = 0; i < 2; ++i) {
+            arr.pop_front();
+        }
+        for (int i = 8; i < 11; ++i) {
+            arr.push_back(i);
+        }
+
+        EXPECT_EQ(arr.size(), 9);
+        EXPECT_GE(arr.capacity(), 9);
+        for (int i = 0; i < 9; ++i) {
+            EXPECT_EQ(arr[i], i + 2);
+        }
+    }
+
+    TEST(Circular_array, Grow_in_place_relocate_head) {
+        aul::Circular_array<int, aul::Memory_mapped_allocator<int>> arr{};
+        arr.reserve(8);
+
+        for (int i = 0; i < 8; ++i) {
+            arr.push_back(i);
+        }
+        for (int i = 0; i < 6; ++i) {
+            arr.pop_front();
+        }
+        for (int i = 8; i < 15; ++i) {
+            arr.push_back(i);
+        }
+        arr.push_front(5);
+
+        EXPECT_EQ(arr.size(), 10);
+        for (int i = 0; i < 10; ++i) {
+            EXPECT_EQ(arr[i], i + 5);
+        }
+    }
+
+    //=====================================================
+    // Segments
+    //=====================================================
+
+    TEST(Circular_array, As_spans) {
+        aul::Circular_array<int> arr{};
+        auto empty_spans = arr.as_spans();
+        EXPECT_EQ(empty_spans[0].size(), 0);
+        EXPECT_EQ(empty_spans[1].size(), 0);
+
+        arr.assign({0, 1, 2, 3, 4, 5, 6, 7});
+        auto spans = arr.as_spans();
+        EXPECT_EQ(spans[0].size(), 8);
+        EXPECT_EQ(spans[1].size(), 0);
+        EXPECT_EQ(spans[0].data(), &arr.front());
+
+        for (int i = 0; i < 3; ++i) {
+            arr.pop_front();
+        }
+        for (int i = 8; i < 11; ++i) {
+            arr.push_back(i);
+        }
+
+        const auto& carr = arr;
+        const auto cspans = carr.as_spans();
+        ASSERT_EQ(cspans[0].size(), 5);
+        ASSERT_EQ(cspans[1].size(), 3);
+        for (int i = 0; i < 5; ++i) {
+            EXPECT_EQ(cspans[0][i], i + 3);
+        }
+        for (int i = 0; i < 3; ++i) {
+            EXPECT_EQ(cspans[1][i], i + 8);
+        }
+        EXPECT_EQ(cspans[1].data(), &arr[5]);
+    }
+
+    TEST(Circular_array, Copy_wrapped) {
+        aul::Circular_array<std::string> arr{};
+        arr.reserve(6);
+        for (int i = 0; i < 6; ++i) {
+            arr.push_back(std::to_string(i));
+        }
+        arr.pop_front();
+        arr.pop_front();
+        arr.push_back("6");
+        arr.push_back("7");
+        ASSERT_EQ(arr.as_spans()[1].size(), 2);
+
+        aul::Circular_array<std::string> copy{arr};
+        ASSERT_EQ(copy.size(), 6);
+        EXPECT_EQ(copy.as_spans()[1].size(), 0);
+        for (int i = 0; i < 6; ++i) {
+            EXPECT_EQ(copy[i], std::to_string(i + 2));
+        }
+
+        // Assigning to a container with sufficient capacity reuses its
+        // allocation
+        aul::Circular_array<int> ints{};
+        ints.reserve(16);
+        ints.push_back(0);
+        const int* data = &ints.front();
+
+        aul::Circular_array<int> source{1, 2, 3, 4};
+        source.pop_front();
+        source.push_back(5);
+        ints = source;
+        EXPECT_EQ(ints.capacity(), 16);
+        EXPECT_EQ(&ints.front(), data);
+        EXPECT_TRUE(std::equal(ints.begin(), ints.end(), source.begin(), source.end()));
+
+        const std::vector<int> vec{7, 8, 9};
+        ints.assign(vec.begin(), vec.end());
+        EXPECT_EQ(ints.capacity(), 16);
+        EXPECT_EQ(&ints.front(), data);
+        EXPECT_TRUE(std::equal(ints.begin(), ints.end(), vec.begin(), vec.end()));
+    }
+
+    TEST(Circular_array, Reuse_emptied_offset_allocation) {
+        aul::Circular_array<int> arr{1, 2, 3, 4};
+        arr.pop_front();
+        arr.pop_front();
+        arr.erase(arr.begin(), arr.end());
+        ASSERT_TRUE(arr.empty());
+
+        arr = aul::Circular_array<int>{7, 8};
+        ASSERT_EQ(arr.size(), 2);
+        EXPECT_EQ(arr[0], 7);
+        EXPECT_EQ(arr[1], 8);
+
+        const aul::Circular_array<int> source{9, 10};
+        aul::Circular_array<int> copied{1, 2, 3, 4};
+        copied.pop_front();
+        copied.pop_front();
+        copied.erase(copied.begin(), copied.end());
+        copied = source;
+        ASSERT_EQ(copied.size(), 2);
+        EXPECT_EQ(copied[0], 9);
+        EXPECT_EQ(copied[1], 10);
+
+        const std::vector<int> vec{5, 6};
+        aul::Circular_array<int> assigned{1, 2, 3, 4};
+        assigned.pop_front();
+        assigned.pop_front();
+        assigned.erase(assigned.begin(), assigned.end());
+        assigned.assign(vec.begin(), vec.end());
+        ASSERT_EQ(assigned.size(), 2);
+        EXPECT_EQ(assigned[0], 5);
+        EXPECT_EQ(assigned[1], 6);
+    }
+
+    TEST(Circular_array, Insert_range) {
+        const std::vector<int> values{100, 101, 102};
+
+        for (std::size_t pos = 0; pos <= 6; ++pos) {
+            for (int wrap = 0; wrap < 5; ++wrap) {
+                aul::Circular_array<int> arr{};
+                arr.reserve(10);
+                for (int i = 0; i < 6 + wrap; ++i) {
+                    arr.push_back(i - wrap);
+                }
+                for (int i = 0; i < wrap; ++i) {
+                    arr.pop_front();
+                }
+
+                std::vector<int> expected(arr.begin(), arr.end());
+                expected.insert(expected.begin() + pos, values.begin(), values.end());
+
+                auto it = arr.insert(arr.begin() + pos, values.begin(), values.end());
+                EXPECT_EQ(it - arr.begin(), pos);
+                EXPECT_EQ(arr.capacity(), 10);
+                ASSERT_EQ(arr.size(), expected.size());
+                EXPECT_TRUE(std::equal(arr.begin(), arr.end(), expected.begin()));
+
+                // Exceed capacity
+                expected.insert(expected.begin() + pos, values.begin(), values.end());
+                arr.insert(arr.begin() + pos, values.begin(), values.end());
+                ASSERT_EQ(arr.size(), expected.size());
+                EXPECT_TRUE(std::equal(arr.begin(), arr.end(), expected.begin()));
+            }
+        }
+
+        aul::Circular_array<std::string> strings{"a", "d"};
+        std::vector<std::string> middle{"b", "c"};
+        strings.insert(strings.begin() + 1, middle.begin(), middle.end());
+        strings.insert(strings.end(), {"e", "f"});
+        strings.insert(strings.begin(), {"_"});
+        const std::vector<std::string> expected{"_", "a", "b", "c", "d", "e", "f"};
+        EXPECT_TRUE(std::equal(strings.begin(), strings.end(), expected.begin(), expected.end()));
+    }
+
+    //=====================================================
+    // Capacity policies
+    //=====================================================
+
+    TEST(Circular_array, Pow2_capacity) {
+        using array_type = aul::Circular_array<int, std::allocator<int>, aul::Circular_array_pow2_capacity>;
+        static_assert(std::is_same_v<array_type::iterator, aul::Circular_array_mask_iterator<int*>>);
+
+        array_type arr{1, 2, 3, 4, 5};
+        EXPECT_EQ(arr.capacity(), 8);
+
+        for (int i = 0; i < 4; ++i) {
+            arr.pop_front();
+        }
+        for (int i = 6; i < 12; ++i) {
+            arr.push_back(i);
+        }
+        arr.push_front(4);
+        arr.push_front(3);
+
+        // Contents now wrap around the end of the allocation
+        EXPECT_EQ(arr.size(), 9);
+        EXPECT_EQ(arr.capacity(), 16);
+        for (int i = 0; i < 9; ++i) {
+            EXPECT_EQ(arr[i], i + 3);
+        }
+
+        for (int i = 0; i < 4; ++i) {
+            arr.pop_front();
+        }
+        for (int i = 12; i < 20; ++i) {
+            arr.push_back(i);
+        }
+        EXPECT_EQ(arr.capacity(), 16);
+        EXPECT_EQ(arr.back(), 19);
+
+        std::reverse(arr.begin(), arr.end());
+        EXPECT_EQ(arr.front(), 19);
+        std::sort(arr.begin(), arr.end());
+        EXPECT_TRUE(std::is_sorted(arr.begin(), arr.end()));
+        EXPECT_EQ(arr.end() - arr.begin(), 13);
+        EXPECT_EQ(arr.begin()[12], 19);
+
+        arr.emplace(arr.begin() + 3, 100);
+        arr.erase(arr.begin());
+        EXPECT_EQ(arr[2], 100);
+        EXPECT_EQ(arr.size(), 13);
+
+        array_type copy{arr};
+        EXPECT_TRUE(std::equal(copy.begin(), copy.end(), arr.begin(), arr.end()));
+
+        arr.reserve(17);
+        EXPECT_EQ(arr.capacity(), 32);
+        EXPECT_TRUE(std::equal(copy.begin(), copy.end(), arr.begin(), arr.end()));
+    }
+
+    TEST(Circular_array, Pow2_capacity_grow_in_place) {
+        aul::Circular_array<int, aul::Memory_mapped_allocator<int>, aul::Circular_array_pow2_capacity> arr{};
+        arr.reserve(5);
+        EXPECT_EQ(arr.capacity(), 8);
+
+        for (int i = 0; i < 8; ++i) {
+            arr.push_back(i);
+        }
+        for (int i = 0; i < 6; ++i) {
+            arr.pop_front();
+        }
+        for (int i = 8; i < 15; ++i) {
+            arr.push_back(i);
+        }
+
+        EXPECT_EQ(arr.capacity(), 16);
+        for (int i = 0; i < 9; ++i) {
+            EXPECT_EQ(arr[i], i + 6);
+        }
+    }
+
+    TEST(Circular_array, Bounded_capacity) {
+        aul::Circular_array<int, std::allocator<int>, aul::Circular_array_bounded_capacity<>> window{};
+
+        // Capacity zero discards new elements
+        window.push_back(1);
+        window.push_front(1);
+        EXPECT_TRUE(window.empty());
+
+        window.reserve(5);
+        for (int i = 0; i < 13; ++i) {
+            window.push_back(i);
+            EXPECT_EQ(window.capacity(), 5);
+            EXPECT_EQ(window.back(), i);
+        }
+
+        ASSERT_EQ(window.size(), 5);
+        for (int i = 0; i < 5; ++i) {
+            EXPECT_EQ(window[i], i + 8);
+        }
+
+        window.push_front(7);
+        EXPECT_EQ(window.capacity(), 5);
+        EXPECT_EQ(window.front(), 7);
+        EXPECT_EQ(window.back(), 11);
+
+        // Copies and moves keep the size of the window
+        auto copy = window;
+        EXPECT_EQ(copy.capacity(), 5);
+        copy.pop_back();
+        copy.pop_back();
+
+        auto copy2{copy};
+        EXPECT_EQ(copy2.capacity(), 5);
+        EXPECT_EQ(copy2.size(), 3);
+        copy2.push_back(1);
+        copy2.push_back(2);
+        copy2.push_back(3);
+        EXPECT_EQ(copy2.capacity(), 5);
+        EXPECT_EQ(copy2.front(), 8);
+        EXPECT_EQ(copy2.back(), 3);
+
+        auto moved = std::move(copy);
+        EXPECT_EQ(moved.capacity(), 5);
+        EXPECT_EQ(moved.size(), 3);
+        EXPECT_TRUE(copy.empty());
+
+        decltype(window) assigned{};
+        assigned = moved;
+        EXPECT_EQ(assigned.capacity(), 5);
+        assigned = std::move(moved);
+        EXPECT_EQ(assigned.capacity(), 5);
+        EXPECT_EQ(assigned.size(), 3);
+
+        // Assignment keeps the window and only the newest elements
+        const std::vector<int> values{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+        assigned.assign(values.begin(), values.end());
+        EXPECT_EQ(assigned.capacity(), 5);
+        ASSERT_EQ(assigned.size(), 5);
+        for (int i = 0; i < 5; ++i) {
+            EXPECT_EQ(assigned[i], i + 5);
+        }
+
+        assigned.assign(values.begin(), values.begin() + 2);
+        EXPECT_EQ(assigned.capacity(), 5);
+        EXPECT_EQ(assigned.size(), 2);
+
+        assigned.assign(std::size_t{8}, 42);
+        EXPECT_EQ(assigned.capacity(), 5);
+        ASSERT_EQ(assigned.size(), 5);
+        EXPECT_EQ(assigned.front(), 42);
+
+        // Insertions elsewhere widen the window
+        window.insert(window.begin() + 2, 100);
+        EXPECT_EQ(window.size(), 6);
+        EXPECT_GT(window.capacity(), 5);
+        EXPECT_EQ(window[2], 100);
+
+        assigned.insert(assigned.begin() + 1, std::size_t{2}, 7);
+        EXPECT_EQ(assigned.size(), 7);
+        EXPECT_GE(assigned.capacity(), 7);
+        EXPECT_EQ(assigned[0], 42);
+        EXPECT_EQ(assigned[1], 7);
+        EXPECT_EQ(assigned[2], 7);
+        EXPECT_EQ(assigned[3], 42);
+
+        copy2.insert(copy2.end() - 1, values.begin(), values.begin() + 3);
+        EXPECT_EQ(copy2.size(), 8);
+        EXPECT_GE(copy2.capacity(), 8);
+        EXPECT_EQ(copy2[4], 0);
+        EXPECT_EQ(copy2.back(), 3);
+
+        aul::Circular_array<std::string, std::allocator<std::string>, aul::Circular_array_bounded_capacity<aul::Circular_array_pow2_capacity>> strings{};
+        strings.reserve(3);
+        ASSERT_EQ(strings.capacity(), 4);
+        for (int i = 0; i < 10; ++i) {
+            strings.emplace_back(std::string(32, char('a' + i)));
+        }
+        ASSERT_EQ(strings.size(), 4);
+        EXPECT_EQ(strings.front(), std::string(32, 'g'));
+        EXPECT_EQ(strings.back(), std::string(32, 'j'));
+
+        // New element may refer to the one it replaces
+        strings.push_back(strings.front());
+        EXPECT_EQ(strings.front(), std::string(32, 'h'));
+        EXPECT_EQ(strings.back(), std::string(32, 'g'));
+    }
+
+    TEST(Circular_array, Push_back_n) {
+        const std::vector<int> values{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+        aul::Circular_array<int> arr{};
+        arr.push_back_n(values.begin(), 3);
+        arr.pop_front();
+        arr.push_back_n(values.data() + 3, 7);
+        ASSERT_EQ(arr.size(), 9);
+        for (int i = 0; i < 9; ++i) {
+            EXPECT_EQ(arr[i], i + 1);
+        }
+
+        aul::Circular_array<int, std::allocator<int>, aul::Circular_array_bounded_capacity<>> window{};
+        window.reserve(6);
+        window.push_back_n(values.begin(), 4);
+        EXPECT_EQ(window.size(), 4);
+
+        // Evicts the two oldest elements and wraps around
+        window.push_back_n(values.data() + 4, 4);
+        ASSERT_EQ(window.size(), 6);
+        EXPECT_EQ(window.as_spans()[1].size(), 2);
+        for (int i = 0; i < 6; ++i) {
+            EXPECT_EQ(window[i], i + 2);
+        }
+
+        // Only the tail of an oversized batch is kept
+        window.push_back_n(values.begin(), 10);
+        EXPECT_EQ(window.capacity(), 6);
+        ASSERT_EQ(window.size(), 6);
+        for (int i = 0; i < 6; ++i) {
+            EXPECT_EQ(window[i], i + 4);
+        }
+
+        aul::Circular_array<std::string, std::allocator<std::string>, aul::Circular_array_bounded_capacity<>> strings{};
+        strings.reserve(3);
+        const std::vector<std::string> words{"one", "two", "three", "four", "five"};
+        strings.push_back_n(words.begin(), 2);
+        strings.push_back_n(words.begin() + 2, 3);
+        EXPECT_TRUE(std::equal(strings.begin(), strings.end(), words.begin() + 2, words.end()));
+    }
+
+    TEST(Circular_array, Mirrored_capacity) {
+        using array_type = aul::Circular_array<int, aul::Mirrored_allocator<int>, aul::Circular_array_mirrored_capacity>;
+
+        const std::size_t granularity = aul::Mirrored_allocator<int>::allocation_granularity();
+
+        array_type arr{};
+        arr.reserve(1);
+        ASSERT_EQ(arr.capacity(), granularity);
+
+        const int n = static_cast<int>(granularity);
+        for (int i = 0; i < n; ++i) {
+            arr.push_back(i);
+        }
+        for (int i = 0; i < n / 2; ++i) {
+            arr.pop_front();
+        }
+        for (int i = n; i < n + n / 4; ++i) {
+            arr.push_back(i);
+        }
+
+        // Contents wrap around the end of the allocation but remain
+        // contiguous through the mirror
+        ASSERT_EQ(arr.capacity(), granularity);
+        ASSERT_EQ(arr.size(), granularity / 2 + granularity / 4);
+        const int* data = arr.data();
+        for (std::size_t i = 0; i < arr.size(); ++i) {
+            EXPECT_EQ(data[i], n / 2 + int(i));
+            EXPECT_EQ(&arr[i], data + i);
+        }
+        EXPECT_EQ(&arr.back(), data + arr.size() - 1);
+        EXPECT_EQ(&*(arr.end() - 1), data + arr.size() - 1);
+
+        arr.push_front(-1);
+        arr.emplace(arr.begin() + 5, -2);
+        arr.erase(arr.begin() + 5);
+        EXPECT_EQ(arr.front(), -1);
+        EXPECT_EQ(arr[5], n / 2 + 4);
+        arr.pop_front();
+
+        // Growing past the capacity moves the elements to a new allocation
+        for (int i = n + n / 4; i < 2 * n; ++i) {
+            arr.push_back(i);
+        }
+        EXPECT_EQ(arr.capacity() % granularity, 0);
+        EXPECT_EQ(arr.size(), granularity + granularity / 2);
+        for (std::size_t i = 0; i < arr.size(); ++i) {
+            EXPECT_EQ(arr.data()[i], n / 2 + int(i));
+        }
+
+        array_type copy{arr};
+        EXPECT_TRUE(std::equal(copy.begin(), copy.end(), arr.data(), arr.data() + arr.size()));
+    }
+
 }
 
 #endif //AUL_CIRCULAR_ARRAY_TESTS_HPP
@@ -0,0 +1,186 @@
+#ifndef AUL_CONCURRENT_CIRCULAR_BUFFER_TESTS_HPP
+#define AUL_CONCURRENT_CIRCULAR_BUFFER_TESTS_HPP
+
+#include <aul/containers/Concurrent_circular_buffer.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace aul::tests {
+
+    //=====================================================
+    // Spsc_circular_buffer
+    //=====================================================
+
+    TEST(Spsc_circular_buffer, Single_thread) {
+        aul::Spsc_circular_buffer<std::string> ring{5};
+        EXPECT_EQ(ring.capacity(), 8);
+        EXPECT_TRUE(ring.empty());
+        EXPECT_FALSE(ring.try_pop());
+
+        for (int i = 0; i < 8; ++i) {
+            EXPECT_TRUE(ring.try_push(std::to_string(i)));
+        }
+        EXPECT_FALSE(ring.try_emplace("full"));
+        EXPECT_EQ(ring.size(), 8);
+
+        std::string s;
+        EXPECT_TRUE(ring.try_pop(s));
+        EXPECT_EQ(s, "0");
+        EXPECT_EQ(*ring.try_pop(), "1");
+
+        // Batches wrap around the end of the ring
+        const std::vector<std::string> in{"a", "b", "c", "d"};
+        EXPECT_EQ(ring.push_n(in.begin(), in.size()), 2);
+
+        std::vector<std::string> out(10);
+        EXPECT_EQ(ring.pop_n(out.begin(), out.size()), 8);
+        EXPECT_EQ(out[0], "2");
+        EXPECT_EQ(out[5], "7");
+        EXPECT_EQ(out[6], "a");
+        EXPECT_EQ(out[7], "b");
+        EXPECT_TRUE(ring.empty());
+
+        // Remaining elements are destroyed with the ring
+        ring.try_push(std::string(100, 'x'));
+    }
+
+    TEST(Spsc_circular_buffer, Producer_consumer) {
+        constexpr std::uint64_t count = 200000;
+
+        aul::Spsc_circular_buffer<std::uint64_t> ring{64};
+
+        std::thread producer{[&] {
+            std::uint64_t batch[7];
+            std::uint64_t i = 0;
+            while (i < count) {
+                if (i % 3 == 0) {
+                    std::uint64_t n = 0;
+                    for (; n < 7 && i + n < count; ++n) {
+                        batch[n] = i + n;
+                    }
+                    i += ring.push_n(batch, n);
+                } else if (ring.try_push(i)) {
+                    ++i;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        }};
+
+        std::uint64_t expected = 0;
+        std::uint64_t batch[5];
+        while (expected < count) {
+            const auto n = ring.pop_n(batch, 5);
+            for (std::uint64_t j = 0; j < n; ++j) {
+                ASSERT_EQ(batch[j], expected++);
+            }
+            if (n == 0) {
+                std::this_thread::yield();
+            }
+        }
+
+        producer.join();
+        EXPECT_TRUE(ring.empty());
+    }
+
+    //=====================================================
+    // Mpmc_circular_buffer
+    //=====================================================
+
+    TEST(Mpmc_circular_buffer, Single_thread) {
+        aul::Mpmc_circular_buffer<std::unique_ptr<int>> ring{4};
+        EXPECT_EQ(ring.capacity(), 4);
+
+        for (int i = 0; i < 4; ++i) {
+            EXPECT_TRUE(ring.try_emplace(new int{i}));
+        }
+        EXPECT_FALSE(ring.try_push(std::make_unique<int>(4)));
+
+        std::unique_ptr<int> p;
+        EXPECT_TRUE(ring.try_pop(p));
+        EXPECT_EQ(*p, 0);
+
+        std::unique_ptr<int> in[3]{std::make_unique<int>(10), std::make_unique<int>(11), std::make_unique<int>(12)};
+        EXPECT_EQ(ring.push_n(std::make_move_iterator(in), 3), 1);
+        EXPECT_EQ(in[0], nullptr);
+
+        std::unique_ptr<int> out[8];
+        EXPECT_EQ(ring.pop_n(out, 8), 4);
+        EXPECT_EQ(*out[0], 1);
+        EXPECT_EQ(*out[3], 10);
+        EXPECT_FALSE(ring.try_pop());
+
+        // Remaining elements are destroyed with the ring
+        ring.try_push(std::make_unique<int>(5));
+    }
+
+    TEST(Mpmc_circular_buffer, Producers_and_consumers) {
+        constexpr std::uint32_t per_producer = 20000;
+        constexpr std::uint32_t producer_count = 3;
+        constexpr std::uint32_t consumer_count = 3;
+
+        aul::Mpmc_circular_buffer<std::uint32_t> ring{128};
+        std::vector<std::atomic<int>> seen(per_producer * producer_count);
+        std::atomic<std::uint32_t> consumed{0};
+
+        std::vector<std::thread> threads;
+        for (std::uint32_t p = 0; p < producer_count; ++p) {
+            threads.emplace_back([&, p] {
+                std::uint32_t i = 0;
+                while (i < per_producer) {
+                    const std::uint32_t value = p * per_producer + i;
+                    if (p == 0) {
+                        const std::uint32_t batch[4]{value, value + 1, value + 2, value + 3};
+                        i += ring.push_n(batch, std::min<std::uint32_t>(4, per_producer - i));
+                    } else if (ring.try_push(value)) {
+                        ++i;
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        for (std::uint32_t c = 0; c < consumer_count; ++c) {
+            threads.emplace_back([&, c] {
+                std::uint32_t batch[6];
+                while (consumed.load() < per_producer * producer_count) {
+                    std::uint32_t n = 0;
+                    if (c == 0) {
+                        n = ring.pop_n(batch, 6);
+                    } else if (auto x = ring.try_pop()) {
+                        batch[0] = *x;
+                        n = 1;
+                    }
+
+                    for (std::uint32_t j = 0; j < n; ++j) {
+                        seen[batch[j]].fetch_add(1);
+                    }
+                    consumed.fetch_add(n);
+                    if (n == 0) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        for (auto& t : threads) {
+            t.join();
+        }
+
+        for (const auto& s : seen) {
+            EXPECT_EQ(s.load(), 1);
+        }
+        EXPECT_TRUE(ring.empty());
+    }
+
+}
+
+#endif //AUL_CONCURRENT_CIRCULAR_BUFFER_TESTS_HPP
@@ -0,0 +1,148 @@
+#ifndef AUL_CONCURRENT_SLOT_MAP_TESTS_HPP
+#define AUL_CONCURRENT_SLOT_MAP_TESTS_HPP
+
+#include <aul/containers/Concurrent_slot_map.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace aul::tests {
+
+    //=====================================================
+    // Single-threaded tests
+    //=====================================================
+
+    TEST(Concurrent_slot_map, Emplace_load_erase) {
+        aul::Concurrent_slot_map<std::uint64_t> map;
+        using key_type = decltype(map)::key_type;
+
+        EXPECT_TRUE(map.empty());
+        EXPECT_FALSE(map.contains(key_type{}));
+        EXPECT_FALSE(map.load(key_type{}).has_value());
+
+        std::vector<key_type> keys;
+        for (std::uint64_t i = 0; i < 100; ++i) {
+            keys.push_back(map.emplace(i * i));
+        }
+        EXPECT_EQ(map.size(), 100);
+        EXPECT_GE(map.capacity(), 100);
+
+        for (std::uint64_t i = 0; i < 100; ++i) {
+            EXPECT_TRUE(map.contains(keys[i]));
+            EXPECT_EQ(map.load(keys[i]), i * i);
+        }
+
+        for (std::uint64_t i = 0; i < 100; i += 3) {
+            EXPECT_TRUE(map.erase(keys[i]));
+            EXPECT_FALSE(map.erase(keys[i]));
+        }
+
+        for (std::uint64_t i = 0; i < 100; ++i) {
+            std::uint64_t out = 12345;
+            EXPECT_EQ(map.load(keys[i], out), i % 3 != 0);
+            EXPECT_EQ(out, (i % 3 != 0) ? i * i : 12345);
+        }
+
+        // Reused slots must not revive stale keys
+        for (std::uint64_t i = 0; i < 34; ++i) {
+            map.emplace(std::uint64_t{7});
+        }
+        for (std::uint64_t i = 0; i < 100; i += 3) {
+            EXPECT_FALSE(map.contains(keys[i]));
+        }
+
+        EXPECT_TRUE(map.modify(keys[1], [] (std::uint64_t& x) { x = 42; }));
+        EXPECT_EQ(map.load(keys[1]), 42u);
+        EXPECT_FALSE(map.modify(keys[0], [] (std::uint64_t& x) { x = 0; }));
+
+        map.clear();
+        EXPECT_TRUE(map.empty());
+        EXPECT_FALSE(map.contains(keys[1]));
+        EXPECT_EQ(map.reclaim(), 0);
+    }
+
+    //=====================================================
+    // Concurrency tests
+    //=====================================================
+
+    ///
+    /// Readers repeatedly load elements whose two halves must always agree
+    /// while the writer inserts, overwrites, erases and grows the container
+    ///
+    TEST(Concurrent_slot_map, Concurrent_readers) {
+        struct Pair {
+            std::uint64_t a;
+            std::uint64_t b;
+        };
+
+        aul::Concurrent_slot_map<Pair> map;
+        using key_type = decltype(map)::key_type;
+
+        constexpr std::size_t key_count = 4096;
+        std::vector<key_type> keys(key_count);
+        for (std::size_t i = 0; i < 64; ++i) {
+            keys[i] = map.emplace(Pair{i, ~i});
+        }
+
+        std::atomic<bool> done{false};
+        std::atomic<std::size_t> torn{0};
+        std::atomic<std::size_t> hits{0};
+
+        auto reader = [&] () {
+            std::size_t i = 0;
+            while (!done.load(std::memory_order_relaxed)) {
+                const auto& key = keys[i++ % 64];
+                if (const auto p = map.load(key)) {
+                    hits.fetch_add(1, std::memory_order_relaxed);
+                    if (p->b != ~p->a) {
+                        torn.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            }
+        };
+
+        std::vector<std::thread> readers;
+        for (int t = 0; t < 3; ++t) {
+            readers.emplace_back(reader);
+        }
+
+        while (hits.load() == 0) {
+            std::this_thread::yield();
+        }
+
+        // Keys in the first 64 entries stay valid throughout, while the rest
+        // churn and force the container to grow
+        for (std::size_t round = 0; round < 20; ++round) {
+            for (std::size_t i = 64; i < key_count; ++i) {
+                keys[i] = map.emplace(Pair{i + round, ~(i + round)});
+            }
+            for (std::size_t i = 0; i < 64; ++i) {
+                map.modify(keys[i], [&] (Pair& p) { p.a = round; p.b = ~round; });
+            }
+            for (std::size_t i = 64; i < key_count; ++i) {
+                EXPECT_TRUE(map.erase(keys[i]));
+            }
+        }
+
+        done.store(true);
+        for (auto& t : readers) {
+            t.join();
+        }
+
+        EXPECT_EQ(torn.load(), 0);
+        EXPECT_EQ(map.size(), 64);
+        for (std::size_t i = 0; i < 64; ++i) {
+            EXPECT_EQ(map.load(keys[i])->a, 19u);
+        }
+
+        map.reclaim();
+        EXPECT_EQ(map.reclaim(), 0);
+    }
+
+}
+
+#endif //AUL_CONCURRENT_SLOT_MAP_TESTS_HPP
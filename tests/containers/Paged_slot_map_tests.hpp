@@ -0,0 +1,149 @@
+#ifndef AUL_PAGED_SLOT_MAP_TESTS_HPP
+#define AUL_PAGED_SLOT_MAP_TESTS_HPP
+
+#include <aul/containers/Paged_slot_map.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace aul::tests {
+
+    template<class T>
+    using Small_paged_slot_map = aul::Paged_slot_map<T, std::allocator<T>, aul::Slot_map_anchor_layout<>, 8>;
+
+    //=====================================================
+    // -ctors
+    //=====================================================
+
+    TEST(Paged_slot_map, Default_constructor) {
+        aul::Paged_slot_map<double> map;
+
+        EXPECT_EQ(map.size(), 0);
+        EXPECT_EQ(map.capacity(), 0);
+        EXPECT_TRUE(map.empty());
+        EXPECT_EQ(map.begin(), map.end());
+        EXPECT_FALSE(map.contains(decltype(map)::key_type{}));
+    }
+
+    TEST(Paged_slot_map, Copy_and_move) {
+        Small_paged_slot_map<std::string> map0;
+        std::vector<Small_paged_slot_map<std::string>::key_type> keys;
+        for (int i = 0; i < 20; ++i) {
+            keys.push_back(map0.emplace(std::to_string(i)));
+        }
+        map0.erase(keys[3]);
+        map0.erase(keys[17]);
+
+        Small_paged_slot_map<std::string> map1{map0};
+        EXPECT_EQ(map1, map0);
+        EXPECT_EQ(map1.capacity(), map0.capacity());
+
+        // Free list must survive the copy
+        EXPECT_EQ(map0.emplace("a"), map1.emplace("a"));
+
+        Small_paged_slot_map<std::string> map2{std::move(map0)};
+        EXPECT_TRUE(map0.empty());
+        EXPECT_EQ(map0.capacity(), 0);
+        EXPECT_EQ(map2, map1);
+
+        map0 = map2;
+        EXPECT_EQ(map0, map2);
+
+        map1 = std::move(map2);
+        EXPECT_TRUE(map2.empty());
+        for (int i = 0; i < 20; ++i) {
+            EXPECT_EQ(map1.contains(keys[i]), i != 3 && i != 17);
+        }
+    }
+
+    //=====================================================
+    // Mutator tests
+    //=====================================================
+
+    TEST(Paged_slot_map, Growth_keeps_addresses) {
+        Small_paged_slot_map<std::uint64_t> map;
+        std::vector<Small_paged_slot_map<std::uint64_t>::key_type> keys;
+        std::vector<const std::uint64_t*> addresses;
+
+        for (std::uint64_t i = 0; i < 100; ++i) {
+            keys.push_back(map.emplace(i));
+            addresses.push_back(&map[keys.back()]);
+        }
+        EXPECT_EQ(map.block_count(), 13);
+        EXPECT_EQ(map.capacity(), 104);
+
+        map.reserve(1000);
+        EXPECT_GE(map.capacity(), 1000);
+
+        for (std::uint64_t i = 0; i < 100; ++i) {
+            EXPECT_EQ(&map[keys[i]], addresses[i]);
+            EXPECT_EQ(map.at(keys[i]), i);
+        }
+
+        std::uint64_t i = 0;
+        for (auto it = map.begin(); it != map.end(); ++it, ++i) {
+            EXPECT_EQ(*it, i);
+            EXPECT_EQ(map.get_key(it), keys[i]);
+        }
+        EXPECT_EQ(map.end() - map.begin(), 100);
+        EXPECT_EQ(map.begin()[42], 42u);
+    }
+
+    TEST(Paged_slot_map, Erase) {
+        Small_paged_slot_map<std::string> map;
+        std::vector<Small_paged_slot_map<std::string>::key_type> keys;
+
+        for (int i = 0; i < 30; ++i) {
+            keys.push_back(map.emplace(std::to_string(i)));
+        }
+
+        for (int i = 0; i < 30; i += 3) {
+            EXPECT_TRUE(map.erase(keys[i]));
+            EXPECT_FALSE(map.erase(keys[i]));
+        }
+        map.erase(map.begin());
+        EXPECT_EQ(map.size(), 19);
+
+        for (int i = 30; i < 40; ++i) {
+            keys.push_back(map.emplace(std::to_string(i)));
+        }
+        EXPECT_EQ(map.capacity(), 32);
+
+        for (auto it = map.cbegin(); it != map.cend(); ++it) {
+            EXPECT_EQ(map[map.get_key(it)], *it);
+        }
+        for (int i = 0; i < 30; i += 3) {
+            EXPECT_FALSE(map.contains(keys[i]));
+        }
+        for (int i = 30; i < 40; ++i) {
+            EXPECT_EQ(map[keys[i]], std::to_string(i));
+        }
+
+        EXPECT_THROW((void)map.at(keys[0]), std::runtime_error);
+
+        map.clear();
+        EXPECT_TRUE(map.empty());
+        EXPECT_EQ(map.capacity(), 0);
+    }
+
+    TEST(Paged_slot_map, Narrow_anchor_layout) {
+        aul::Paged_slot_map<int, std::allocator<int>, aul::Slot_map_anchor_layout<std::uint16_t, 4>, 8> map;
+        EXPECT_EQ(map.max_size(), 15);
+
+        for (int i = 0; i < 15; ++i) {
+            map.emplace(i);
+        }
+        EXPECT_THROW(map.emplace(15), std::length_error);
+
+        auto key = map.get_key(map.begin() + 14);
+        EXPECT_EQ(map[key], 14);
+        map.erase(key);
+        EXPECT_EQ(map[map.emplace(100)], 100);
+    }
+
+}
+
+#endif //AUL_PAGED_SLOT_MAP_TESTS_HPP
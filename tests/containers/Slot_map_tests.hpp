@@ -5,6 +5,17 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
 namespace aul::tests {
 
     //=====================================================
@@ -46,6 +57,27 @@ namespace aul::tests {
         EXPECT_TRUE(std::equal(list.begin(), list.end(), map1.begin()));
     }
 
+    TEST(Slot_map, Copy_constructor_with_free_anchors) {
+        aul::Slot_map<std::string> map0;
+        std::vector<decltype(map0)::key_type> keys;
+        for (int i = 0; i < 10; ++i) {
+            keys.push_back(map0.emplace(std::to_string(i)));
+        }
+        map0.erase(keys[2]);
+        map0.erase(keys[7]);
+
+        aul::Slot_map<std::string> map1{map0};
+        EXPECT_EQ(map1.size(), 8);
+        for (int i = 0; i < 10; ++i) {
+            EXPECT_EQ(map1.contains(keys[i]), i != 2 && i != 7);
+        }
+
+        auto key0 = map0.emplace("a");
+        auto key1 = map1.emplace("a");
+        EXPECT_EQ(key0, key1);
+        EXPECT_EQ(map1[key1], "a");
+    }
+
     //=====================================================
     // Comparison operators
     //=====================================================
@@ -168,6 +200,436 @@ namespace aul::tests {
         EXPECT_TRUE(map.empty());
     }
 
+    TEST(Slot_map, Erase_key_then_emplace) {
+        aul::Slot_map<int> map;
+        std::vector<decltype(map)::key_type> keys;
+
+        for (int i = 0; i < 16; ++i) {
+            keys.push_back(map.emplace(i));
+        }
+
+        for (int i = 0; i < 16; i += 2) {
+            EXPECT_TRUE(map.erase(keys[i]));
+            EXPECT_FALSE(map.erase(keys[i]));
+        }
+
+        for (int i = 0; i < 8; ++i) {
+            keys.push_back(map.emplace(16 + i));
+        }
+
+        EXPECT_EQ(map.size(), 16);
+        for (int i = 1; i < 16; i += 2) {
+            EXPECT_EQ(map[keys[i]], i);
+        }
+
+        for (int i = 0; i < 16; i += 2) {
+            EXPECT_FALSE(map.contains(keys[i]));
+        }
+
+        for (int i = 0; i < 8; ++i) {
+            EXPECT_EQ(map[keys[16 + i]], 16 + i);
+        }
+    }
+
+    TEST(Slot_map, Get_if) {
+        aul::Slot_map<int> map;
+        using key_type = decltype(map)::key_type;
+
+        EXPECT_EQ(map.get_if(key_type{}), nullptr);
+
+        std::vector<key_type> keys;
+        for (int i = 0; i < 16; ++i) {
+            keys.push_back(map.emplace(i));
+        }
+
+        for (int i = 0; i < 16; i += 2) {
+            map.erase(keys[i]);
+        }
+        map.emplace(100);
+
+        const auto& cmap = map;
+        for (int i = 0; i < 16; ++i) {
+            map.prefetch(keys[i]);
+            map.prefetch_element(keys[i]);
+
+            if (i % 2 == 0) {
+                EXPECT_EQ(map.get_if(keys[i]), nullptr);
+                EXPECT_EQ(cmap.get_if(keys[i]), nullptr);
+            } else {
+                ASSERT_NE(map.get_if(keys[i]), nullptr);
+                EXPECT_EQ(*map.get_if(keys[i]), i);
+                EXPECT_EQ(cmap.get_if(keys[i]), &map[keys[i]]);
+                EXPECT_EQ(map.get_unchecked(keys[i]), &map[keys[i]]);
+            }
+        }
+
+        map.prefetch(key_type{});
+        map.prefetch_element(key_type{});
+        EXPECT_EQ(map.get_if(key_type{static_cast<decltype(keys[1].index)>(keys[1].index + 1000), keys[1].version}), nullptr);
+    }
+
+    TEST(Slot_map, Emplace_n) {
+        aul::Slot_map<int> map;
+        map.emplace(-1);
+
+        std::vector<decltype(map)::key_type> keys(100);
+        auto it = map.emplace_n(100, aul::Span<decltype(map)::key_type>{keys.data(), keys.size()}, 7);
+
+        EXPECT_EQ(map.size(), 101);
+        EXPECT_EQ(it, map.begin() + 1);
+        for (const auto& key : keys) {
+            EXPECT_TRUE(map.contains(key));
+            EXPECT_EQ(map[key], 7);
+        }
+
+        std::vector<decltype(map)::key_type> too_few(2);
+        EXPECT_THROW(map.emplace_n(3, aul::Span<decltype(map)::key_type>{too_few.data(), too_few.size()}, 7), std::length_error);
+        EXPECT_EQ(map.size(), 101);
+    }
+
+    TEST(Slot_map, Emplace_range) {
+        aul::Slot_map<int> map;
+        std::vector<decltype(map)::key_type> keys(64);
+
+        std::vector<int> values(64);
+        std::iota(values.begin(), values.end(), 0);
+
+        // Reuses anchors released by the erasure
+        map.emplace_range(values.begin(), values.begin() + 32, aul::Span<decltype(map)::key_type>{keys.data(), 32});
+        for (int i = 0; i < 32; i += 2) {
+            map.erase(keys[i]);
+        }
+        map.emplace_range(values.begin() + 32, values.end(), aul::Span<decltype(map)::key_type>{keys.data() + 32, 32});
+
+        EXPECT_EQ(map.size(), 48);
+        for (int i = 0; i < 64; ++i) {
+            if (i < 32 && i % 2 == 0) {
+                EXPECT_FALSE(map.contains(keys[i]));
+            } else {
+                EXPECT_EQ(map[keys[i]], i);
+            }
+        }
+    }
+
+    TEST(Slot_map, Erase_many) {
+        aul::Slot_map<int> map;
+        std::vector<decltype(map)::key_type> keys;
+
+        for (int i = 0; i < 64; ++i) {
+            keys.push_back(map.emplace(i));
+        }
+
+        // Erase every third element, a run at the end, and repeat a key
+        std::vector<decltype(map)::key_type> to_erase;
+        for (int i = 0; i < 56; i += 3) {
+            to_erase.push_back(keys[i]);
+        }
+        for (int i = 56; i < 64; ++i) {
+            to_erase.push_back(keys[i]);
+        }
+        to_erase.push_back(keys[0]);
+        to_erase.push_back(decltype(map)::key_type{});
+
+        auto erased = map.erase_many(aul::Span<const decltype(map)::key_type>{to_erase.data(), to_erase.size()});
+        EXPECT_EQ(erased, 27);
+        EXPECT_EQ(map.size(), 37);
+
+        for (int i = 0; i < 64; ++i) {
+            const bool is_erased = (i < 56 && i % 3 == 0) || i >= 56;
+            EXPECT_EQ(map.contains(keys[i]), !is_erased);
+            if (!is_erased) {
+                EXPECT_EQ(map[keys[i]], i);
+            }
+        }
+
+        for (auto it = map.begin(); it != map.end(); ++it) {
+            EXPECT_EQ(map[map.get_key(it)], *it);
+        }
+
+        // Released anchors are reused with new versions
+        for (int i = 0; i < 27; ++i) {
+            keys.push_back(map.emplace(100 + i));
+        }
+        EXPECT_EQ(map.size(), 64);
+        for (int i = 0; i < 27; ++i) {
+            EXPECT_EQ(map[keys[64 + i]], 100 + i);
+        }
+        for (const auto& key : to_erase) {
+            EXPECT_FALSE(map.contains(key));
+        }
+
+        EXPECT_EQ(map.erase_many(aul::Span<const decltype(map)::key_type>{keys.data() + 64, 27}), 27);
+        EXPECT_EQ(map.erase_many(aul::Span<const decltype(map)::key_type>{keys.data(), keys.size()}), 37);
+        EXPECT_TRUE(map.empty());
+    }
+
+    //=====================================================
+    // Reordering tests
+    //=====================================================
+
+    TEST(Slot_map, Sort) {
+        aul::Slot_map<std::string> map;
+        std::vector<decltype(map)::key_type> keys;
+
+        std::vector<int> values(200);
+        std::iota(values.begin(), values.end(), 0);
+        std::shuffle(values.begin(), values.end(), std::mt19937{42});
+
+        for (int v : values) {
+            keys.push_back(map.emplace(std::to_string(v)));
+        }
+        map.erase(keys[5]);
+
+        auto by_value = [] (const std::string& a, const std::string& b) {
+            return std::stoi(a) < std::stoi(b);
+        };
+        map.sort(by_value);
+
+        EXPECT_EQ(map.size(), 199);
+        EXPECT_TRUE(std::is_sorted(map.begin(), map.end(), by_value));
+
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            EXPECT_EQ(map.contains(keys[i]), i != 5);
+            if (i != 5) {
+                EXPECT_EQ(map[keys[i]], std::to_string(values[i]));
+            }
+        }
+        for (auto it = map.begin(); it != map.end(); ++it) {
+            EXPECT_EQ(&map[map.get_key(it)], &*it);
+        }
+
+        map.sort(std::greater<>{});
+        EXPECT_TRUE(std::is_sorted(map.begin(), map.end(), std::greater<>{}));
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            if (i != 5) {
+                EXPECT_EQ(map[keys[i]], std::to_string(values[i]));
+            }
+        }
+    }
+
+    TEST(Slot_map, Partition) {
+        aul::Slot_map<int> map;
+        std::vector<decltype(map)::key_type> keys;
+
+        for (int i = 0; i < 100; ++i) {
+            keys.push_back(map.emplace(i));
+        }
+
+        auto is_even = [] (int x) { return x % 2 == 0; };
+        auto it = map.partition(is_even);
+
+        EXPECT_EQ(it - map.begin(), 50);
+        EXPECT_TRUE(std::all_of(map.begin(), it, is_even));
+        EXPECT_TRUE(std::none_of(it, map.end(), is_even));
+
+        for (int i = 0; i < 100; ++i) {
+            EXPECT_EQ(map[keys[i]], i);
+        }
+
+        EXPECT_EQ(map.partition([] (int) { return true; }), map.end());
+        EXPECT_EQ(map.partition([] (int) { return false; }), map.begin());
+
+        aul::Slot_map<int> empty;
+        EXPECT_EQ(empty.partition(is_even), empty.end());
+        empty.sort();
+    }
+
+    //=====================================================
+    // Anchor layout tests
+    //=====================================================
+
+    TEST(Slot_map, Packed_anchor_layout) {
+        using layout = aul::Slot_map_anchor_layout<std::uint32_t, 24>;
+        static_assert(layout::version_bits == 8);
+        static_assert(std::is_same_v<layout::index_type, std::uint32_t>);
+
+        aul::Slot_map<int, std::allocator<int>, layout> map;
+        std::vector<decltype(map)::key_type> keys;
+
+        for (int i = 0; i < 1000; ++i) {
+            keys.push_back(map.emplace(i));
+        }
+        for (int i = 0; i < 1000; i += 3) {
+            EXPECT_TRUE(map.erase(keys[i]));
+        }
+        for (int i = 0; i < 1000; ++i) {
+            EXPECT_EQ(map.contains(keys[i]), i % 3 != 0);
+            if (i % 3 != 0) {
+                EXPECT_EQ(map[keys[i]], i);
+            }
+        }
+
+        for (auto it = map.begin(); it != map.end(); ++it) {
+            EXPECT_EQ(map[map.get_key(it)], *it);
+        }
+    }
+
+    TEST(Slot_map, Anchor_layout_limits) {
+        using layout = aul::Slot_map_anchor_layout<std::uint16_t, 4>;
+        aul::Slot_map<int, std::allocator<int>, layout> map;
+
+        // One index value is reserved
+        EXPECT_EQ(map.max_size(), 15);
+        for (int i = 0; i < 15; ++i) {
+            map.emplace(i);
+        }
+        EXPECT_THROW(map.emplace(15), std::length_error);
+
+        // Versions wrap around after 2^12 reuses of an anchor
+        auto key = map.get_key(map.begin());
+        EXPECT_TRUE(map.erase(key));
+        auto new_key = map.emplace(0);
+        for (int i = 1; i < 4096; ++i) {
+            EXPECT_NE(new_key.version, key.version);
+            map.erase(new_key);
+            new_key = map.emplace(0);
+        }
+        EXPECT_EQ(new_key, key);
+    }
+
+    //=====================================================
+    // Free list policies
+    //=====================================================
+
+    TEST(Slot_map, Fifo_reuse) {
+        aul::Slot_map<int, std::allocator<int>, aul::Slot_map_anchor_layout<>, aul::Slot_map_fifo_reuse> map;
+        std::vector<decltype(map)::key_type> keys;
+
+        for (int i = 0; i < 8; ++i) {
+            keys.push_back(map.emplace(i));
+        }
+        map.reserve(map.size());
+
+        map.erase(keys[5]);
+        map.erase(keys[2]);
+        map.erase(keys[7]);
+
+        // Anchors come back in the order they were freed
+        EXPECT_EQ(map.emplace(10).index, keys[5].index);
+        map.erase(keys[0]);
+        EXPECT_EQ(map.emplace(11).index, keys[2].index);
+        EXPECT_EQ(map.emplace(12).index, keys[7].index);
+        EXPECT_EQ(map.emplace(13).index, keys[0].index);
+
+        // Free list is empty again, so growth must supply new anchors
+        auto key = map.emplace(14);
+        EXPECT_EQ(key.index, 8);
+        EXPECT_EQ(map[key], 14);
+
+        auto copy = map;
+        map.erase(keys[1]);
+        copy.erase(keys[1]);
+        map.erase(keys[3]);
+        copy.erase(keys[3]);
+        EXPECT_EQ(map.emplace(0), copy.emplace(0));
+
+        // Unused anchors from growth are handed out before freed ones
+        EXPECT_EQ(map.emplace(0).index, 10);
+    }
+
+    TEST(Slot_map, Generational_reuse) {
+        using layout = aul::Slot_map_anchor_layout<std::uint16_t, 12>;
+        static_assert(layout::version_max == 15);
+
+        aul::Slot_map<int, std::allocator<int>, layout, aul::Slot_map_generational_reuse> map;
+        std::vector<decltype(map)::key_type> stale_keys;
+
+        auto key = map.emplace(0);
+        map.emplace(1);
+
+        // Versions 1 through 15 are handed out once each, after which the
+        // anchor is retired rather than wrapping around
+        for (int i = 0; i < 15; ++i) {
+            stale_keys.push_back(key);
+            map.erase(key);
+            key = map.emplace(i);
+        }
+        EXPECT_NE(key.index, stale_keys.front().index);
+
+        for (const auto& stale : stale_keys) {
+            EXPECT_FALSE(map.contains(stale));
+            EXPECT_EQ(map.get_if(stale), nullptr);
+        }
+        EXPECT_EQ(map.size(), 2);
+        EXPECT_EQ(map[key], 14);
+
+        // Retired anchors don't count towards the free slots
+        std::vector<decltype(map)::key_type> keys(10);
+        map.emplace_n(10, aul::Span<decltype(map)::key_type>{keys.data(), keys.size()}, 7);
+        for (const auto& k : keys) {
+            EXPECT_EQ(map[k], 7);
+        }
+        for (const auto& stale : stale_keys) {
+            EXPECT_FALSE(map.contains(stale));
+        }
+    }
+
+    TEST(Slot_map, Compact_keys) {
+        using layout = aul::Slot_map_anchor_layout<std::uint32_t, 16>;
+        using map_type = aul::Slot_map<int, std::allocator<int>, layout, aul::Slot_map_generational_reuse>;
+        static_assert(sizeof(map_type::key_type) == 4);
+        static_assert(sizeof(aul::Slot_map<int>::key_type) == 8);
+
+        map_type map;
+        auto key = map.emplace(5);
+        EXPECT_EQ(map[key], 5);
+        EXPECT_FALSE(map.contains(map_type::key_type{}));
+    }
+
+    TEST(Slot_map, Snapshot) {
+        aul::Slot_map<int> map;
+        std::vector<aul::Slot_map<int>::key_type> keys;
+        for (int i = 0; i < 100; ++i) {
+            keys.push_back(map.emplace(i));
+        }
+        for (int i = 0; i < 100; i += 3) {
+            map.erase(keys[i]);
+        }
+
+        std::vector<unsigned char> image(map.snapshot_size());
+        map.snapshot_into(image.data());
+
+        auto restored = aul::Slot_map<int>::restore(image.data(), image.size());
+        EXPECT_EQ(restored, map);
+        for (int i = 0; i < 100; ++i) {
+            EXPECT_EQ(restored.contains(keys[i]), (i % 3) != 0);
+            if (i % 3 != 0) {
+                EXPECT_EQ(restored[keys[i]], i);
+            }
+        }
+
+        // Free list must be carried over
+        EXPECT_EQ(restored.emplace(-1), map.emplace(-1));
+
+        // Image read in place
+        std::vector<std::max_align_t> aligned_storage(image.size() / sizeof(std::max_align_t) + 64);
+        void* p = aligned_storage.data();
+        std::size_t space = aligned_storage.size() * sizeof(std::max_align_t);
+        std::align(64, image.size(), p, space);
+        std::memcpy(p, image.data(), image.size());
+
+        aul::Slot_map_snapshot_view<int> view{p, image.size()};
+        EXPECT_EQ(view.size(), 66);
+        EXPECT_EQ(view.at(keys[1]), 1);
+        EXPECT_EQ(view.get_if(keys[0]), nullptr);
+        EXPECT_THROW((void)view.at(keys[3]), std::runtime_error);
+        for (auto it = view.begin(); it != view.end(); ++it) {
+            EXPECT_EQ(view[view.get_key(it)], *it);
+        }
+
+        // Invalid images
+        EXPECT_THROW((void)aul::Slot_map<int>::restore(image.data(), image.size() - 1), std::runtime_error);
+        EXPECT_THROW((void)aul::Slot_map<long long>::restore(image.data(), image.size()), std::runtime_error);
+        EXPECT_THROW((void)(aul::Slot_map<int, std::allocator<int>, aul::Slot_map_anchor_layout<>, aul::Slot_map_fifo_reuse>::restore(image.data(), image.size())), std::runtime_error);
+        image[0] ^= 0xff;
+        EXPECT_THROW((void)aul::Slot_map<int>::restore(image.data(), image.size()), std::runtime_error);
+
+        aul::Slot_map<int> empty;
+        std::vector<unsigned char> empty_image(empty.snapshot_size());
+        empty.snapshot_into(empty_image.data());
+        EXPECT_TRUE(aul::Slot_map<int>::restore(empty_image.data(), empty_image.size()).empty());
+    }
+
 }
 
 #endif //AUL_SLOT_MAP_TESTS_HPP
@@ -0,0 +1,275 @@
+#ifndef AUL_SOA_SLOT_MAP_TESTS_HPP
+#define AUL_SOA_SLOT_MAP_TESTS_HPP
+
+#include <aul/containers/Soa_slot_map.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace aul::tests {
+
+    using Soa_entity = std::tuple<float, std::uint32_t, std::string>;
+
+    //=====================================================
+    // -ctors
+    //=====================================================
+
+    TEST(Soa_slot_map, Default_constructor) {
+        aul::Soa_slot_map<Soa_entity> map;
+
+        EXPECT_EQ(map.size(), 0);
+        EXPECT_EQ(map.capacity(), 0);
+        EXPECT_TRUE(map.empty());
+        EXPECT_EQ(map.begin(), map.end());
+    }
+
+    TEST(Soa_slot_map, Copy_and_move) {
+        aul::Soa_slot_map<Soa_entity> map0;
+        std::vector<aul::Soa_slot_map<Soa_entity>::key_type> keys;
+        for (std::uint32_t i = 0; i < 20; ++i) {
+            keys.push_back(map0.emplace(float(i), i, std::to_string(i)));
+        }
+        map0.erase(keys[3]);
+
+        aul::Soa_slot_map<Soa_entity> map1{map0};
+        aul::Soa_slot_map<Soa_entity> map2{std::move(map0)};
+
+        EXPECT_TRUE(map0.empty());
+        EXPECT_EQ(map1.size(), 19);
+        EXPECT_EQ(map2.size(), 19);
+
+        for (std::uint32_t i = 0; i < 20; ++i) {
+            EXPECT_EQ(map1.contains(keys[i]), i != 3);
+            EXPECT_EQ(map2.contains(keys[i]), i != 3);
+            if (i != 3) {
+                EXPECT_EQ(map1.get<2>(keys[i]), std::to_string(i));
+                EXPECT_EQ(map2.get<1>(keys[i]), i);
+            }
+        }
+
+        // Free list must survive the copy
+        auto key = map1.emplace(-1.0f, 100u, "new");
+        EXPECT_EQ(map1.get<2>(key), "new");
+
+        map0 = map1;
+        EXPECT_EQ(map0.size(), 20);
+        EXPECT_EQ(map0.get<1>(key), 100u);
+    }
+
+    ///
+    /// Member type whose copy constructor throws once a shared budget of
+    /// copies is exhausted and whose move constructor may throw
+    ///
+    struct Soa_limited_copy {
+
+        static inline int copies_left = -1;
+
+        Soa_limited_copy(int v):
+            v(v) {}
+
+        Soa_limited_copy(const Soa_limited_copy& other):
+            v(other.v) {
+            if (copies_left == 0) {
+                throw std::runtime_error{"Copy limit reached"};
+            }
+
+            if (copies_left > 0) {
+                --copies_left;
+            }
+        }
+
+        Soa_limited_copy(Soa_limited_copy&& other) noexcept(false):
+            Soa_limited_copy(static_cast<const Soa_limited_copy&>(other)) {}
+
+        Soa_limited_copy& operator=(const Soa_limited_copy&) = default;
+
+        int v = 0;
+
+    };
+
+    TEST(Soa_slot_map, Exception_safety) {
+        using map_type = aul::Soa_slot_map<std::tuple<std::string, Soa_limited_copy>>;
+
+        map_type map;
+        std::vector<map_type::key_type> keys;
+        for (int i = 0; i < 16; ++i) {
+            keys.push_back(map.emplace(std::string(32, char('a' + i)), i));
+        }
+
+        // Copying fails part way through the second column
+        Soa_limited_copy::copies_left = 7;
+        EXPECT_THROW(map_type{map}, std::runtime_error);
+
+        // Growing fails part way through relocating the second column
+        Soa_limited_copy::copies_left = 7;
+        EXPECT_THROW(map.reserve(64), std::runtime_error);
+        Soa_limited_copy::copies_left = -1;
+
+        EXPECT_EQ(map.capacity(), 16);
+        ASSERT_EQ(map.size(), 16);
+        for (int i = 0; i < 16; ++i) {
+            EXPECT_EQ(map.get<0>(keys[i]), std::string(32, char('a' + i)));
+            EXPECT_EQ(map.get<1>(keys[i]).v, i);
+        }
+
+        map.reserve(64);
+        EXPECT_EQ(map.capacity(), 64);
+        for (int i = 0; i < 16; ++i) {
+            EXPECT_EQ(map.get<0>(keys[i]), std::string(32, char('a' + i)));
+            EXPECT_EQ(map.get<1>(keys[i]).v, i);
+        }
+    }
+
+    //=====================================================
+    // Mutator tests
+    //=====================================================
+
+    TEST(Soa_slot_map, Emplace_and_access) {
+        aul::Soa_slot_map<Soa_entity> map;
+        std::vector<aul::Soa_slot_map<Soa_entity>::key_type> keys;
+
+        for (std::uint32_t i = 0; i < 100; ++i) {
+            keys.push_back(map.emplace(i * 0.5f, i, std::to_string(i)));
+        }
+        keys.push_back(map.insert(Soa_entity{-1.0f, 1000u, "inserted"}));
+
+        EXPECT_EQ(map.size(), 101);
+
+        for (std::uint32_t i = 0; i < 100; ++i) {
+            auto [f, u, s] = map[keys[i]];
+            EXPECT_EQ(f, i * 0.5f);
+            EXPECT_EQ(u, i);
+            EXPECT_EQ(s, std::to_string(i));
+        }
+
+        std::get<1>(map.at(keys[100])) = 7;
+        EXPECT_EQ(map.get<1>(keys[100]), 7u);
+        EXPECT_EQ(map.get<2>(keys[100]), "inserted");
+
+        EXPECT_THROW((void)map.at(aul::Soa_slot_map<Soa_entity>::key_type{}), std::runtime_error);
+    }
+
+    TEST(Soa_slot_map, Erase) {
+        aul::Soa_slot_map<std::pair<int, std::string>> map;
+        std::vector<decltype(map)::key_type> keys;
+
+        for (int i = 0; i < 16; ++i) {
+            keys.push_back(map.emplace(i, std::to_string(i)));
+        }
+
+        for (int i = 0; i < 16; i += 2) {
+            EXPECT_TRUE(map.erase(keys[i]));
+            EXPECT_FALSE(map.erase(keys[i]));
+        }
+
+        map.erase(map.begin());
+        EXPECT_EQ(map.size(), 7);
+
+        for (int i = 0; i < 8; ++i) {
+            keys.push_back(map.emplace(16 + i, std::to_string(16 + i)));
+        }
+
+        for (auto it = map.begin(); it != map.end(); ++it) {
+            const auto key = map.get_key(it);
+            EXPECT_EQ(map.get<0>(key), std::get<0>(*it));
+            EXPECT_EQ(std::to_string(map.get<0>(key)), map.get<1>(key));
+        }
+
+        for (int i = 0; i < 16; i += 2) {
+            EXPECT_FALSE(map.contains(keys[i]));
+        }
+        for (int i = 16; i < 24; ++i) {
+            EXPECT_EQ(map.get<0>(keys[i]), i);
+        }
+
+        map.clear();
+        EXPECT_TRUE(map.empty());
+        EXPECT_EQ(map.capacity(), 0);
+    }
+
+    TEST(Soa_slot_map, Anchor_layout) {
+        static_assert(std::is_same_v<aul::Soa_slot_map<Soa_entity>::key_type, aul::Slot_map<Soa_entity>::key_type>);
+
+        using layout = aul::Slot_map_anchor_layout<std::uint32_t, 16>;
+        using map_type = aul::Soa_slot_map<std::pair<std::uint16_t, std::uint16_t>, std::allocator<std::pair<std::uint16_t, std::uint16_t>>, layout>;
+        static_assert(std::is_same_v<map_type::key_type, aul::Slot_map<int, std::allocator<int>, layout>::key_type>);
+        static_assert(sizeof(map_type::key_type) == 4);
+
+        map_type map;
+        EXPECT_LT(map.max_size(), layout::index_mask + 1);
+
+        std::vector<map_type::key_type> keys;
+        for (std::uint16_t i = 0; i < 100; ++i) {
+            keys.push_back(map.emplace(i, std::uint16_t(2 * i)));
+        }
+
+        // Reusing an anchor increments its version
+        const auto erased = keys[10];
+        EXPECT_TRUE(map.erase(erased));
+        EXPECT_FALSE(map.erase(erased));
+
+        const auto reused = map.emplace(std::uint16_t{1000}, std::uint16_t{2000});
+        EXPECT_EQ(reused.index, erased.index);
+        EXPECT_NE(reused.version, erased.version);
+        EXPECT_FALSE(map.contains(erased));
+        EXPECT_EQ(map.get<1>(reused), 2000);
+
+        for (std::uint16_t i = 0; i < 100; ++i) {
+            if (i != 10) {
+                EXPECT_EQ(map.get<0>(keys[i]), i);
+                EXPECT_EQ(map.get_key(map.begin() + (&map.get<0>(keys[i]) - map.column<0>().data())), keys[i]);
+            }
+        }
+    }
+
+    //=====================================================
+    // Column access
+    //=====================================================
+
+    TEST(Soa_slot_map, Columns) {
+        aul::Soa_slot_map<Soa_entity> map;
+        map.reserve(64);
+        EXPECT_GE(map.capacity(), 64);
+
+        for (std::uint32_t i = 0; i < 64; ++i) {
+            map.emplace(float(i), i, std::string{});
+        }
+
+        auto floats = map.column<0>();
+        EXPECT_EQ(floats.size(), 64);
+        for (auto& f : floats) {
+            f *= 2.0f;
+        }
+
+        auto ints_and_strings = map.columns<1, 2>();
+        EXPECT_EQ(ints_and_strings.size(), 64);
+        for (auto [u, s] : ints_and_strings) {
+            s = std::to_string(u);
+        }
+
+        std::uint32_t i = 0;
+        for (auto [f, u, s] : map) {
+            EXPECT_EQ(f, 2.0f * i);
+            EXPECT_EQ(u, i);
+            EXPECT_EQ(s, std::to_string(i));
+            ++i;
+        }
+        EXPECT_EQ(i, 64);
+
+        const auto& cmap = map;
+        float sum = 0.0f;
+        for (const float f : cmap.column<0>()) {
+            sum += f;
+        }
+        EXPECT_EQ(sum, 2.0f * (63 * 64 / 2));
+    }
+
+}
+
+#endif //AUL_SOA_SLOT_MAP_TESTS_HPP
@@ -2,8 +2,8 @@
 // Created by avereniect on 1/9/22.
 //
 
-#ifndef AUL_ZIPPERATOR_TESTS_HPP
-#define AUL_ZIPPERATOR_TESTS_HPP
+#ifndef AUL_ZIPPER_ITERATOR_TESTS_HPP
+#define AUL_ZIPPER_ITERATOR_TESTS_HPP
 
 #include <gtest/gtest.h>
 
@@ -14,9 +14,9 @@ namespace aul {
     using int_it = int*;
     using float_it = float*;
 
-    using int_float_fzipit = Forward_zipperator<int*, float*>;
-    using int_float_bzipit = Bidirectional_zipperator<int*, float*>;
-    using int_float_rzipit = Random_access_zipperator<int*, float*>;
+    using int_float_fzipit = Forward_zipper_iterator<int*, float*>;
+    using int_float_bzipit = Bidirectional_zipper_iterator<int*, float*>;
+    using int_float_rzipit = Random_access_zipper_iterator<int*, float*>;
 
     //=====================================================
     // Static tests
@@ -31,7 +31,7 @@ namespace aul {
     //=====================================================
 
 
-    class Zipperator_fixture : public ::testing::Test {
+    class Zipper_iterator_fixture : public ::testing::Test {
     protected:
 
         void SetUp() override {
@@ -43,7 +43,7 @@ namespace aul {
 
     };
 
-    TEST_F(Zipperator_fixture, Forward_vector_constructor) {
+    TEST_F(Zipper_iterator_fixture, Forward_vector_constructor) {
         int_float_fzipit zip{int_arr.data(), float_arr.data()};
 
         auto [a, b] = *zip;
@@ -52,7 +52,7 @@ namespace aul {
         EXPECT_EQ(b, 4.0f);
     }
 
-    TEST_F(Zipperator_fixture, Forward_vector_incrementation) {
+    TEST_F(Zipper_iterator_fixture, Forward_vector_incrementation) {
         int_float_fzipit zip{int_arr.data(), float_arr.data()};
         ++zip;
 
@@ -62,7 +62,7 @@ namespace aul {
         EXPECT_EQ(b, 5.0f);
     }
 
-    TEST_F(Zipperator_fixture, Forward_vector_equality_comparison) {
+    TEST_F(Zipper_iterator_fixture, Forward_vector_equality_comparison) {
         int_float_fzipit zip0{int_arr.data(), float_arr.data()};
         ++zip0;
         int_float_fzipit zip1{int_arr.data() + 1, float_arr.data() + 1};
@@ -70,18 +70,18 @@ namespace aul {
         EXPECT_EQ(zip0, zip1);
     }
 
-    TEST_F(Zipperator_fixture, Forward_vector_inequality_comparison) {
+    TEST_F(Zipper_iterator_fixture, Forward_vector_inequality_comparison) {
         int_float_fzipit zip0{int_arr.data(), float_arr.data()};
         int_float_fzipit zip1{int_arr.data() + 4, float_arr.data()};
 
         EXPECT_NE(zip0, zip1);
     }
 
-    TEST_F(Zipperator_fixture, Random_access_reference_assignment) {
+    TEST_F(Zipper_iterator_fixture, Random_access_reference_assignment) {
         std::array<int, 4> arr0{4, 4, 4, 4};
         std::array<int, 4> arr1{2, 2, 2, 2};
 
-        Random_access_zipperator<int*, int*> it(arr0.data(), arr1.data());
+        Random_access_zipper_iterator<int*, int*> it(arr0.data(), arr1.data());
 
         auto [a, b] = *it;
         a = 0;
@@ -93,4 +93,4 @@ namespace aul {
 
 }
 
-#endif //AUL_ZIPPERATOR_TESTS_HPP
+#endif //AUL_ZIPPER_ITERATOR_TESTS_HPP
@@ -0,0 +1,51 @@
+#ifndef AUL_EPOCH_DOMAIN_TESTS_HPP
+#define AUL_EPOCH_DOMAIN_TESTS_HPP
+
+#include <aul/memory/Epoch_domain.hpp>
+
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <utility>
+
+namespace aul::tests {
+
+    TEST(Epoch_domain, Advance_without_readers) {
+        aul::Epoch_domain domain;
+
+        const auto tag = domain.epoch();
+        EXPECT_FALSE(domain.is_safe(tag));
+
+        EXPECT_TRUE(domain.try_advance());
+        EXPECT_FALSE(domain.is_safe(tag));
+
+        EXPECT_TRUE(domain.try_advance());
+        EXPECT_TRUE(domain.is_safe(tag));
+    }
+
+    TEST(Epoch_domain, Pinned_reader_blocks_reclamation) {
+        aul::Epoch_domain domain;
+
+        std::optional<aul::Epoch_domain::Guard> guard{domain.pin()};
+        const auto tag = domain.epoch();
+
+        // The reader pinned in the current epoch can't stop the first advance
+        // but must stop the second
+        EXPECT_TRUE(domain.try_advance());
+        EXPECT_FALSE(domain.try_advance());
+        EXPECT_FALSE(domain.is_safe(tag));
+
+        auto moved = std::move(*guard);
+        guard.reset();
+        EXPECT_FALSE(domain.try_advance());
+
+        {
+            auto released = std::move(moved);
+        }
+        EXPECT_TRUE(domain.try_advance());
+        EXPECT_TRUE(domain.is_safe(tag));
+    }
+
+}
+
+#endif //AUL_EPOCH_DOMAIN_TESTS_HPP
@@ -0,0 +1,320 @@
+#ifndef AUL_MEMORY_MAPPED_ALLOCATOR_TESTS_HPP
+#define AUL_MEMORY_MAPPED_ALLOCATOR_TESTS_HPP
+
+#include <aul/memory/Memory_mapped_allocator.hpp>
+#include <aul/containers/Packed_vector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace aul::tests {
+
+    ///
+    /// Copy construction throws if the source's value is negative
+    ///
+    struct Throwing_copy {
+        int value = 0;
+
+        explicit Throwing_copy(int v):
+            value(v) {}
+
+        Throwing_copy(const Throwing_copy& other):
+            value(other.value) {
+            if (other.value < 0) {
+                throw std::runtime_error{"Throwing_copy"};
+            }
+        }
+    };
+
+    ///
+    /// Allocator which supports reallocate(), can be made to fail shrinks,
+    /// and checks that allocations are released with the sizes they were
+    /// requested for
+    ///
+    template<class T>
+    struct Failing_shrink_allocator {
+        using value_type = T;
+
+        std::map<void*, std::size_t>* live = nullptr;
+        bool* fail_shrinks = nullptr;
+
+        T* allocate(std::size_t n) {
+            T* ret = std::allocator<T>{}.allocate(n);
+            (*live)[ret] = n;
+            return ret;
+        }
+
+        void deallocate(T* p, std::size_t n) {
+            EXPECT_EQ(live->at(p), n);
+            live->erase(p);
+            std::allocator<T>{}.deallocate(p, n);
+        }
+
+        T* reallocate(T* p, std::size_t old_n, std::size_t new_n) {
+            if (new_n < old_n && *fail_shrinks) {
+                throw std::bad_alloc{};
+            }
+
+            T* ret = allocate(new_n);
+            std::memcpy(static_cast<void*>(ret), static_cast<void*>(p), std::min(old_n, new_n) * sizeof(T));
+            deallocate(p, old_n);
+            return ret;
+        }
+
+        bool operator==(const Failing_shrink_allocator& rhs) const {
+            return live == rhs.live;
+        }
+
+        bool operator!=(const Failing_shrink_allocator& rhs) const {
+            return live != rhs.live;
+        }
+    };
+
+}
+
+namespace aul {
+
+    template<>
+    struct is_trivially_relocatable<tests::Throwing_copy> : public std::true_type {};
+
+}
+
+namespace aul::tests {
+
+    inline std::string memory_mapped_allocator_test_path() {
+        return ::testing::TempDir() + "aul_memory_mapped_allocator_test.bin";
+    }
+
+    TEST(Memory_mapped_allocator, Anonymous_allocate) {
+        aul::Memory_mapped_allocator<std::uint32_t> allocator;
+
+        EXPECT_EQ(allocator.allocate(0), nullptr);
+
+        std::uint32_t* p = allocator.allocate(1024);
+        ASSERT_NE(p, nullptr);
+
+        for (std::uint32_t i = 0; i < 1024; ++i) {
+            p[i] = i;
+        }
+        for (std::uint32_t i = 0; i < 1024; ++i) {
+            EXPECT_EQ(p[i], i);
+        }
+
+        allocator.deallocate(p, 1024);
+    }
+
+    TEST(Memory_mapped_allocator, Anonymous_reallocate) {
+        aul::Memory_mapped_allocator<std::uint64_t> allocator{aul::Mapping_flags::populate, MADV_SEQUENTIAL};
+
+        std::uint64_t* p = allocator.allocate(1000);
+        for (std::uint64_t i = 0; i < 1000; ++i) {
+            p[i] = i * i;
+        }
+
+        p = allocator.reallocate(p, 1000, 1'000'000);
+        ASSERT_NE(p, nullptr);
+        for (std::uint64_t i = 0; i < 1000; ++i) {
+            EXPECT_EQ(p[i], i * i);
+        }
+        p[999'999] = 7;
+
+        p = allocator.reallocate(p, 1'000'000, 10);
+        for (std::uint64_t i = 0; i < 10; ++i) {
+            EXPECT_EQ(p[i], i * i);
+        }
+
+        EXPECT_EQ(allocator.reallocate(p, 10, 0), nullptr);
+    }
+
+    TEST(Memory_mapped_allocator, Huge_pages) {
+        aul::Memory_mapped_allocator<char> allocator{aul::Mapping_flags::huge_pages};
+
+        char* p = allocator.allocate(100);
+        ASSERT_NE(p, nullptr);
+        p[0] = 'a';
+        p[99] = 'b';
+
+        p = allocator.reallocate(p, 100, 3 * 1024 * 1024);
+        EXPECT_EQ(p[0], 'a');
+        EXPECT_EQ(p[99], 'b');
+
+        allocator.deallocate(p, 3 * 1024 * 1024);
+    }
+
+    TEST(Memory_mapped_allocator, Comparison) {
+        aul::Memory_mapped_allocator<int> a0;
+        aul::Memory_mapped_allocator<float> a1;
+        aul::Memory_mapped_allocator<int> a2{aul::Mapping_flags::huge_pages};
+
+        EXPECT_TRUE(a0 == a1);
+        EXPECT_TRUE(a0 != a2);
+
+        const auto path = memory_mapped_allocator_test_path();
+        std::remove(path.c_str());
+
+        aul::Memory_mapped_allocator<int> f0{path};
+        aul::Memory_mapped_allocator<int> f1{path};
+        aul::Memory_mapped_allocator<double> f2{f0};
+
+        EXPECT_TRUE(f0 != a0);
+        EXPECT_TRUE(f0 != f1);
+        EXPECT_TRUE(f0 == f2);
+
+        std::remove(path.c_str());
+    }
+
+    TEST(Memory_mapped_allocator, File_backed_persistence) {
+        const auto path = memory_mapped_allocator_test_path();
+        std::remove(path.c_str());
+
+        std::size_t p1_offset = 0;
+        {
+            aul::Memory_mapped_allocator<std::uint32_t> allocator{path};
+            EXPECT_TRUE(allocator.is_file_backed());
+
+            std::uint32_t* p0 = allocator.allocate(16);
+            std::uint32_t* p1 = allocator.allocate(16);
+            EXPECT_EQ(allocator.offset_of(p0), 0);
+
+            p1_offset = allocator.offset_of(p1);
+            EXPECT_EQ(p1_offset, sysconf(_SC_PAGESIZE));
+
+            for (std::uint32_t i = 0; i < 16; ++i) {
+                p0[i] = i;
+                p1[i] = 100 + i;
+            }
+
+            // p0 is not the last region in the file so must be relocated
+            p0 = allocator.reallocate(p0, 16, 4096);
+            for (std::uint32_t i = 0; i < 16; ++i) {
+                EXPECT_EQ(p0[i], i);
+            }
+
+            // p0 is now the last region and may be grown in place
+            p0 = allocator.reallocate(p0, 4096, 8192);
+            for (std::uint32_t i = 0; i < 16; ++i) {
+                EXPECT_EQ(p0[i], i);
+            }
+
+            // Deallocation leaves contents in the file
+            allocator.deallocate(p0, 8192);
+            allocator.deallocate(p1, 16);
+        }
+
+        std::ifstream stream{path, std::ios::binary};
+        ASSERT_TRUE(stream.is_open());
+
+        stream.seekg(static_cast<std::streamoff>(p1_offset));
+
+        std::vector<std::uint32_t> contents(16);
+        stream.read(reinterpret_cast<char*>(contents.data()), contents.size() * sizeof(std::uint32_t));
+        for (std::uint32_t i = 0; i < 16; ++i) {
+            EXPECT_EQ(contents[i], 100 + i);
+        }
+
+        stream.close();
+
+        // A new allocator may map the region again
+        {
+            aul::Memory_mapped_allocator<std::uint32_t> allocator{path};
+
+            std::uint32_t* p1 = allocator.attach(p1_offset, 16);
+            ASSERT_NE(p1, nullptr);
+            EXPECT_EQ(allocator.offset_of(p1), p1_offset);
+            for (std::uint32_t i = 0; i < 16; ++i) {
+                EXPECT_EQ(p1[i], 100 + i);
+            }
+
+            // New allocations don't overlap existing contents
+            std::uint32_t* p2 = allocator.allocate(16);
+            EXPECT_GT(allocator.offset_of(p2), p1_offset);
+            allocator.deallocate(p2, 16);
+
+            p1[0] = 42;
+            allocator.deallocate(p1, 16);
+
+            EXPECT_THROW((void)allocator.attach(p1_offset + 1, 16), std::invalid_argument);
+            EXPECT_THROW((void)allocator.attach(1 << 30, 16), std::out_of_range);
+        }
+
+        {
+            aul::Memory_mapped_allocator<std::uint32_t> allocator{path};
+            std::uint32_t* p1 = allocator.attach(p1_offset, 16);
+            EXPECT_EQ(p1[0], 42);
+            allocator.deallocate(p1, 16);
+        }
+
+        std::remove(path.c_str());
+    }
+
+    TEST(Memory_mapped_allocator, Max_size) {
+        aul::Memory_mapped_allocator<std::uint64_t> allocator;
+
+        EXPECT_THROW((void)allocator.allocate(allocator.max_size() + 1), std::bad_array_new_length);
+        EXPECT_THROW((void)allocator.allocate(std::numeric_limits<std::size_t>::max()), std::bad_array_new_length);
+
+        std::uint64_t* p = allocator.allocate(1);
+        EXPECT_THROW((void)allocator.reallocate(p, 1, allocator.max_size() + 1), std::bad_array_new_length);
+        allocator.deallocate(p, 1);
+
+        EXPECT_THROW((void)allocator.attach(0, 1), std::logic_error);
+    }
+
+    TEST(Memory_mapped_allocator, Packed_vector) {
+        using allocator_type = aul::Memory_mapped_allocator<int>;
+
+        aul::Packed_vector<int, allocator_type> vec(std::size_t{1000}, 5, allocator_type{});
+        EXPECT_EQ(vec.size(), 1000);
+
+        vec.resize(100'000, 7);
+        EXPECT_EQ(vec[0], 5);
+        EXPECT_EQ(vec[999], 5);
+        EXPECT_EQ(vec[1000], 7);
+        EXPECT_EQ(vec[99'999], 7);
+
+        vec.resize(10);
+        EXPECT_EQ(vec.size(), 10);
+        EXPECT_EQ(vec[9], 5);
+    }
+
+    TEST(Memory_mapped_allocator, Packed_vector_failed_shrink) {
+        using allocator_type = Failing_shrink_allocator<Throwing_copy>;
+
+        std::map<void*, std::size_t> live;
+        bool fail_shrinks = true;
+
+        {
+            aul::Packed_vector<Throwing_copy, allocator_type> vec(std::size_t{4}, Throwing_copy{1}, allocator_type{&live, &fail_shrinks});
+
+            // Growth fails part way through and the allocation can't be
+            // shrunk back down either
+            EXPECT_THROW(vec.resize(8, Throwing_copy{-1}), std::runtime_error);
+            ASSERT_EQ(vec.size(), 4);
+            for (const auto& x : vec) {
+                EXPECT_EQ(x.value, 1);
+            }
+
+            fail_shrinks = false;
+            vec.resize(6, Throwing_copy{2});
+            ASSERT_EQ(vec.size(), 6);
+            EXPECT_EQ(vec[3].value, 1);
+            EXPECT_EQ(vec[5].value, 2);
+        }
+
+        EXPECT_TRUE(live.empty());
+    }
+
+}
+
+#endif //AUL_MEMORY_MAPPED_ALLOCATOR_TESTS_HPP
@@ -2,12 +2,30 @@
 #define AUL_MEMORY_TESTS_HPP
 
 #include <aul/memory/Memory.hpp>
+#include <aul/memory/Memory_mapped_allocator.hpp>
 
 #include <gtest/gtest.h>
 
 #include <algorithm>
 #include <memory>
 #include <cstdint>
+#include <string>
+#include <vector>
+
+namespace aul::tests {
+
+    struct Relocatable_handle {
+        std::unique_ptr<int> ptr;
+    };
+
+}
+
+namespace aul {
+
+    template<>
+    struct is_trivially_relocatable<tests::Relocatable_handle> : public std::true_type {};
+
+}
 
 namespace aul::tests {
 
@@ -18,6 +36,84 @@ namespace aul::tests {
         typename allocator_type::pointer allocation = std::allocator_traits<allocator_type>::allocate(allocator, 32);
 
         aul::default_construct_n<typename allocator_type::pointer, int, allocator_type>(allocation, 16, allocator);
+        EXPECT_TRUE(std::all_of(allocation, allocation + 16, [] (uint32_t x) { return x == 0; }));
+
+        aul::destroy_n(allocation, 16, allocator);
+        std::allocator_traits<allocator_type>::deallocate(allocator, allocation, 32);
+    }
+
+    TEST(Memory, allocator_supports_reallocation) {
+        EXPECT_FALSE(aul::allocator_supports_reallocation_v<std::allocator<int>>);
+        EXPECT_TRUE(aul::allocator_supports_reallocation_v<aul::Memory_mapped_allocator<int>>);
+    }
+
+    TEST(Memory, is_trivially_relocatable) {
+        EXPECT_TRUE(aul::is_trivially_relocatable_v<int>);
+        EXPECT_FALSE(aul::is_trivially_relocatable_v<std::string>);
+        EXPECT_TRUE(aul::is_trivially_relocatable_v<Relocatable_handle>);
+
+        EXPECT_TRUE((aul::allocator_has_trivial_types<int, std::allocator<int>>::value));
+    }
+
+    TEST(Memory, uninitialized_destructive_move_relocatable) {
+        using allocator_type = std::allocator<Relocatable_handle>;
+        allocator_type allocator{};
+
+        Relocatable_handle* src = std::allocator_traits<allocator_type>::allocate(allocator, 4);
+        Relocatable_handle* dst = std::allocator_traits<allocator_type>::allocate(allocator, 4);
+
+        for (int i = 0; i < 4; ++i) {
+            std::allocator_traits<allocator_type>::construct(allocator, src + i, Relocatable_handle{std::make_unique<int>(i)});
+        }
+
+        auto* end = aul::uninitialized_destructive_move(src, src + 4, dst, allocator);
+        EXPECT_EQ(end, dst + 4);
+        for (int i = 0; i < 4; ++i) {
+            EXPECT_EQ(*dst[i].ptr, i);
+        }
+
+        aul::destroy(dst, dst + 4, allocator);
+        std::allocator_traits<allocator_type>::deallocate(allocator, src, 4);
+        std::allocator_traits<allocator_type>::deallocate(allocator, dst, 4);
+    }
+
+    TEST(Memory, uninitialized_destructive_move_elements_overlapping) {
+        using allocator_type = std::allocator<int>;
+        allocator_type allocator{};
+
+        std::vector<int> ints{0, 1, 2, 3, 4, 5, 6, 7};
+
+        auto* end = aul::uninitialized_destructive_move_elements_left(ints.data(), ints.data() + 2, ints.data() + 8, allocator);
+        EXPECT_EQ(end, ints.data() + 6);
+        for (int i = 0; i < 6; ++i) {
+            EXPECT_EQ(ints[i], i + 2);
+        }
+
+        auto* begin = aul::uninitialized_destructive_move_elements_right(ints.data(), ints.data() + 6, ints.data() + 8, allocator);
+        EXPECT_EQ(begin, ints.data() + 2);
+        for (int i = 2; i < 8; ++i) {
+            EXPECT_EQ(ints[i], i);
+        }
+    }
+
+    TEST(Memory, destructive_move_backward) {
+        using allocator_type = std::allocator<std::string>;
+        allocator_type allocator{};
+
+        std::string* src = std::allocator_traits<allocator_type>::allocate(allocator, 3);
+        for (int i = 0; i < 3; ++i) {
+            std::allocator_traits<allocator_type>::construct(allocator, src + i, std::string(32, char('a' + i)));
+        }
+
+        std::vector<std::string> dst(3);
+        auto it = aul::destructive_move_backward(src, src + 3, dst.data() + 3, allocator);
+
+        EXPECT_EQ(it, dst.data());
+        EXPECT_EQ(dst[0], std::string(32, 'a'));
+        EXPECT_EQ(dst[1], std::string(32, 'b'));
+        EXPECT_EQ(dst[2], std::string(32, 'c'));
+
+        std::allocator_traits<allocator_type>::deallocate(allocator, src, 3);
     }
 
 }
@@ -0,0 +1,58 @@
+#ifndef AUL_MIRRORED_ALLOCATOR_TESTS_HPP
+#define AUL_MIRRORED_ALLOCATOR_TESTS_HPP
+
+#include <aul/memory/Mirrored_allocator.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+
+namespace aul::tests {
+
+    TEST(Mirrored_allocator, Allocation_granularity) {
+        const std::size_t page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+
+        EXPECT_EQ(aul::Mirrored_allocator<std::uint8_t>::allocation_granularity(), page);
+        EXPECT_EQ(aul::Mirrored_allocator<std::uint64_t>::allocation_granularity(), page / 8);
+
+        // 24 byte objects only fill a whole number of pages in groups of
+        // page / 8
+        struct Triple { std::uint64_t x, y, z; };
+        EXPECT_EQ(aul::Mirrored_allocator<Triple>::allocation_granularity(), page / 8);
+    }
+
+    TEST(Mirrored_allocator, Mirror) {
+        aul::Mirrored_allocator<std::uint32_t> allocator;
+
+        EXPECT_EQ(allocator.allocate(0), nullptr);
+
+        const std::size_t n = 4 * allocator.allocation_granularity();
+        std::uint32_t* p = allocator.allocate(n);
+        ASSERT_NE(p, nullptr);
+
+        for (std::uint32_t i = 0; i < n; ++i) {
+            p[i] = i;
+        }
+        for (std::uint32_t i = 0; i < n; ++i) {
+            EXPECT_EQ(p[n + i], i);
+        }
+
+        // Writes through the mirror are visible in the original
+        p[n + 3] = 12345;
+        EXPECT_EQ(p[3], 12345);
+
+        // A range straddling the end of the allocation is contiguous
+        std::uint32_t out[8];
+        std::memcpy(out, p + n - 4, sizeof(out));
+        EXPECT_EQ(out[0], n - 4);
+        EXPECT_EQ(out[3], n - 1);
+        EXPECT_EQ(out[4], 0);
+        EXPECT_EQ(out[7], 12345);
+
+        allocator.deallocate(p, n);
+    }
+
+}
+
+#endif //AUL_MIRRORED_ALLOCATOR_TESTS_HPP